@@ -651,9 +651,10 @@ static void bgn(void) {
 }
 
 static void bls(void) {
-	uint8_t msg[5] = { 0, 1, 2, 3, 4 };
-	g1_t s;
-	g2_t p;
+	uint8_t msg[5] = { 0, 1, 2, 3, 4 }, *msgs[16];
+	int lens[16], ok[16];
+	g1_t s, _s[16];
+	g2_t p, _p[16];
 	bn_t d;
 
 	g1_null(s);
@@ -663,6 +664,16 @@ static void bls(void) {
 	g1_new(s);
 	g2_new(p);
 	bn_new(d);
+	for (int i = 0; i < 16; i++) {
+		g1_null(_s[i]);
+		g2_null(_p[i]);
+		g1_new(_s[i]);
+		g2_new(_p[i]);
+		msgs[i] = msg;
+		lens[i] = sizeof(msg);
+		cp_bls_gen(d, _p[i]);
+		cp_bls_sig(_s[i], msg, sizeof(msg), d);
+	}
 
 	BENCH_BEGIN("cp_bls_gen") {
 		BENCH_ADD(cp_bls_gen(d, p));
@@ -679,9 +690,24 @@ static void bls(void) {
 	}
 	BENCH_END;
 
+	BENCH_SMALL("cp_bls_ver_batch (16)",
+			cp_bls_ver_batch(ok, _s, msgs, lens, _p, 16));
+
+	BENCH_BEGIN("cp_bls_agg_sig (16)") {
+		BENCH_ADD(cp_bls_agg_sig(s, _s, 16));
+	}
+	BENCH_END;
+
+	BENCH_SMALL("cp_bls_fast_agg_ver (16)",
+			cp_bls_fast_agg_ver(s, msg, sizeof(msg), _p, 16));
+
 	g1_free(s);
 	bn_free(d);
 	g2_free(p);
+	for (int i = 0; i < 16; i++) {
+		g1_free(_s[i]);
+		g2_free(_p[i]);
+	}
 }
 
 static void bbs(void) {
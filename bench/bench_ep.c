@@ -30,6 +30,7 @@
  */
 
 #include <stdio.h>
+#include <stdlib.h>
 
 #include "relic.h"
 #include "relic_bench.h"
@@ -558,6 +559,14 @@ static void arith(void) {
 		BENCH_ADD(ep_map(p, msg, 5));
 	} BENCH_END;
 
+	BENCH_BEGIN("ep_map_dst_ctx") {
+		uint8_t msg[5];
+		md_xmd_ctx_t ctx;
+		md_xmd_ctx_init(ctx, (const uint8_t *)"RELIC", 5);
+		rand_bytes(msg, 5);
+		BENCH_ADD(ep_map_dst_ctx(p, msg, 5, ctx));
+	} BENCH_END;
+
 	BENCH_BEGIN("ep_pck") {
 		ep_rand(p);
 		BENCH_ADD(ep_pck(q, p));
@@ -576,6 +585,92 @@ static void arith(void) {
 	bn_free(n);
 }
 
+static void lot(void) {
+	const int max = 65536;
+	bn_t n, *k = (bn_t *)malloc(max * sizeof(bn_t));
+	ep_t r, *p = (ep_t *)malloc(max * sizeof(ep_t));
+	uint8_t m[256][5], *s[256], b[256 * (RLC_FP_BYTES + 1)];
+	int l[256], v[256];
+
+	bn_null(n);
+	ep_null(r);
+
+	bn_new(n);
+	ep_new(r);
+	for (int i = 0; i < max; i++) {
+		bn_null(k[i]);
+		ep_null(p[i]);
+		bn_new(k[i]);
+		ep_new(p[i]);
+	}
+
+	/* Derive the points from a random one to keep setup time reasonable. */
+	ep_curve_get_ord(n);
+	ep_rand(p[0]);
+	ep_curve_get_gen(r);
+	for (int i = 0; i < max; i++) {
+		if (i > 0) {
+			ep_add(p[i], p[i - 1], r);
+		}
+		bn_rand_mod(k[i], n);
+	}
+	ep_norm_sim(p, (const ep_t *)p, max);
+
+	BENCH_SMALL("ep_add_sim (256)", ep_add_sim(r, p, 256));
+	BENCH_ONCE("ep_add_sim (65536)", ep_add_sim(r, p, 65536));
+
+	BENCH_SMALL("ep_mul_sim_lot (2)", ep_mul_sim_lot(r, p, k, 2));
+	BENCH_SMALL("ep_mul_sim_lot (4)", ep_mul_sim_lot(r, p, k, 4));
+	BENCH_SMALL("ep_mul_sim_lot (8)", ep_mul_sim_lot(r, p, k, 8));
+	BENCH_SMALL("ep_mul_sim_lot (16)", ep_mul_sim_lot(r, p, k, 16));
+	BENCH_SMALL("ep_mul_sim_lot (32)", ep_mul_sim_lot(r, p, k, 32));
+	BENCH_SMALL("ep_mul_sim_lot (64)", ep_mul_sim_lot(r, p, k, 64));
+	BENCH_SMALL("ep_mul_sim_lot (128)", ep_mul_sim_lot(r, p, k, 128));
+	BENCH_SMALL("ep_mul_sim_lot (256)", ep_mul_sim_lot(r, p, k, 256));
+	BENCH_ONCE("ep_mul_sim_lot (1024)", ep_mul_sim_lot(r, p, k, 1024));
+	BENCH_ONCE("ep_mul_sim_lot (4096)", ep_mul_sim_lot(r, p, k, 4096));
+	BENCH_ONCE("ep_mul_sim_lot (16384)", ep_mul_sim_lot(r, p, k, 16384));
+	BENCH_ONCE("ep_mul_sim_lot (65536)", ep_mul_sim_lot(r, p, k, 65536));
+
+	BENCH_ONCE("ep_mul_sim_lot_projc (256)", ep_mul_sim_lot_projc(r, p, k, 256));
+	BENCH_ONCE("ep_mul_sim_lot_projc (1024)", ep_mul_sim_lot_projc(r, p, k, 1024));
+	BENCH_ONCE("ep_mul_sim_lot_projc (4096)", ep_mul_sim_lot_projc(r, p, k, 4096));
+	BENCH_ONCE("ep_mul_sim_lot_projc (16384)", ep_mul_sim_lot_projc(r, p, k, 16384));
+	BENCH_ONCE("ep_mul_sim_lot_projc (65536)", ep_mul_sim_lot_projc(r, p, k, 65536));
+	BENCH_ONCE("ep_mul_sim_lot_basic (256)", ep_mul_sim_lot_basic(r, p, k, 256));
+	BENCH_ONCE("ep_mul_sim_lot_basic (1024)", ep_mul_sim_lot_basic(r, p, k, 1024));
+	BENCH_ONCE("ep_mul_sim_lot_basic (4096)", ep_mul_sim_lot_basic(r, p, k, 4096));
+	BENCH_ONCE("ep_mul_sim_lot_basic (16384)", ep_mul_sim_lot_basic(r, p, k, 16384));
+	BENCH_ONCE("ep_mul_sim_lot_basic (65536)", ep_mul_sim_lot_basic(r, p, k, 65536));
+
+	for (int i = 0; i < 256; i++) {
+		s[i] = m[i];
+		l[i] = sizeof(m[i]);
+		rand_bytes(m[i], l[i]);
+	}
+	BENCH_SMALL("ep_map_dst_batch (16)", ep_map_dst_batch(p, s, l, 16,
+			(const uint8_t *)"RELIC", 5));
+	BENCH_ONCE("ep_map_dst_batch (256)", ep_map_dst_batch(p, s, l, 256,
+			(const uint8_t *)"RELIC", 5));
+
+	for (int i = 0; i < 256; i++) {
+		ep_write_bin(b + i * (RLC_FP_BYTES + 1), RLC_FP_BYTES + 1, p[i], 1);
+	}
+	BENCH_SMALL("ep_read_bin_batch (16)", ep_read_bin_batch(p, v, b,
+			RLC_FP_BYTES + 1, 16));
+	BENCH_ONCE("ep_read_bin_batch (256)", ep_read_bin_batch(p, v, b,
+			RLC_FP_BYTES + 1, 256));
+
+	bn_free(n);
+	ep_free(r);
+	for (int i = 0; i < max; i++) {
+		bn_free(k[i]);
+		ep_free(p[i]);
+	}
+	free(k);
+	free(p);
+}
+
 static void bench(void) {
 	ep_param_print();
 	util_banner("Utilities:", 1);
@@ -583,6 +678,7 @@ static void bench(void) {
 	util();
 	util_banner("Arithmetic:", 1);
 	arith();
+	lot();
 }
 
 int main(void) {
@@ -30,6 +30,7 @@
  */
 
 #include <stdio.h>
+#include <stdlib.h>
 
 #include "relic.h"
 #include "relic_bench.h"
@@ -532,6 +533,14 @@ static void arith(void) {
 		BENCH_ADD(ep2_map(p, msg, 5));
 	} BENCH_END;
 
+	BENCH_BEGIN("ep2_map_dst_ctx") {
+		uint8_t msg[5];
+		md_xmd_ctx_t ctx;
+		md_xmd_ctx_init(ctx, (const uint8_t *)"RELIC", 5);
+		rand_bytes(msg, 5);
+		BENCH_ADD(ep2_map_dst_ctx(p, msg, 5, ctx));
+	} BENCH_END;
+
 	BENCH_BEGIN("ep2_pck") {
 		ep2_rand(p);
 		BENCH_ADD(ep2_pck(q, p));
@@ -551,6 +560,90 @@ static void arith(void) {
 	fp2_free(s);
 }
 
+static void lot(void) {
+	const int max = 16384;
+	bn_t n, *k = (bn_t *)malloc(max * sizeof(bn_t));
+	ep2_t r, *p = (ep2_t *)malloc(max * sizeof(ep2_t));
+	uint8_t m[256][5], *s[256], b[256 * (2 * RLC_FP_BYTES + 1)];
+	int l[256], v[256];
+
+	bn_null(n);
+	ep2_null(r);
+
+	bn_new(n);
+	ep2_new(r);
+	for (int i = 0; i < max; i++) {
+		bn_null(k[i]);
+		ep2_null(p[i]);
+		bn_new(k[i]);
+		ep2_new(p[i]);
+	}
+
+	/* Derive the points from a random one to keep setup time reasonable. */
+	ep2_curve_get_ord(n);
+	ep2_rand(p[0]);
+	ep2_curve_get_gen(r);
+	for (int i = 0; i < max; i++) {
+		if (i > 0) {
+			ep2_add(p[i], p[i - 1], r);
+		}
+		bn_rand_mod(k[i], n);
+	}
+	ep2_norm_sim(p, p, max);
+
+	BENCH_SMALL("ep2_add_sim (256)", ep2_add_sim(r, p, 256));
+	BENCH_ONCE("ep2_add_sim (16384)", ep2_add_sim(r, p, 16384));
+
+	BENCH_SMALL("ep2_mul_sim_lot (2)", ep2_mul_sim_lot(r, p, k, 2));
+	BENCH_SMALL("ep2_mul_sim_lot (4)", ep2_mul_sim_lot(r, p, k, 4));
+	BENCH_SMALL("ep2_mul_sim_lot (8)", ep2_mul_sim_lot(r, p, k, 8));
+	BENCH_SMALL("ep2_mul_sim_lot (16)", ep2_mul_sim_lot(r, p, k, 16));
+	BENCH_SMALL("ep2_mul_sim_lot (32)", ep2_mul_sim_lot(r, p, k, 32));
+	BENCH_SMALL("ep2_mul_sim_lot (64)", ep2_mul_sim_lot(r, p, k, 64));
+	BENCH_SMALL("ep2_mul_sim_lot (128)", ep2_mul_sim_lot(r, p, k, 128));
+	BENCH_SMALL("ep2_mul_sim_lot (256)", ep2_mul_sim_lot(r, p, k, 256));
+	BENCH_ONCE("ep2_mul_sim_lot (1024)", ep2_mul_sim_lot(r, p, k, 1024));
+	BENCH_ONCE("ep2_mul_sim_lot (4096)", ep2_mul_sim_lot(r, p, k, 4096));
+	BENCH_ONCE("ep2_mul_sim_lot (16384)", ep2_mul_sim_lot(r, p, k, 16384));
+
+	BENCH_ONCE("ep2_mul_sim_lot_projc (256)", ep2_mul_sim_lot_projc(r, p, k, 256));
+	BENCH_ONCE("ep2_mul_sim_lot_projc (1024)", ep2_mul_sim_lot_projc(r, p, k, 1024));
+	BENCH_ONCE("ep2_mul_sim_lot_projc (4096)", ep2_mul_sim_lot_projc(r, p, k, 4096));
+	BENCH_ONCE("ep2_mul_sim_lot_projc (16384)", ep2_mul_sim_lot_projc(r, p, k, 16384));
+	BENCH_ONCE("ep2_mul_sim_lot_basic (256)", ep2_mul_sim_lot_basic(r, p, k, 256));
+	BENCH_ONCE("ep2_mul_sim_lot_basic (1024)", ep2_mul_sim_lot_basic(r, p, k, 1024));
+	BENCH_ONCE("ep2_mul_sim_lot_basic (4096)", ep2_mul_sim_lot_basic(r, p, k, 4096));
+	BENCH_ONCE("ep2_mul_sim_lot_basic (16384)", ep2_mul_sim_lot_basic(r, p, k, 16384));
+
+	for (int i = 0; i < 256; i++) {
+		s[i] = m[i];
+		l[i] = sizeof(m[i]);
+		rand_bytes(m[i], l[i]);
+	}
+	BENCH_SMALL("ep2_map_dst_batch (16)", ep2_map_dst_batch(p, s, l, 16,
+			(const uint8_t *)"RELIC", 5));
+	BENCH_ONCE("ep2_map_dst_batch (256)", ep2_map_dst_batch(p, s, l, 256,
+			(const uint8_t *)"RELIC", 5));
+
+	for (int i = 0; i < 256; i++) {
+		ep2_write_bin(b + i * (2 * RLC_FP_BYTES + 1), 2 * RLC_FP_BYTES + 1,
+				p[i], 1);
+	}
+	BENCH_SMALL("ep2_read_bin_batch (16)", ep2_read_bin_batch(p, v, b,
+			2 * RLC_FP_BYTES + 1, 16));
+	BENCH_ONCE("ep2_read_bin_batch (256)", ep2_read_bin_batch(p, v, b,
+			2 * RLC_FP_BYTES + 1, 256));
+
+	bn_free(n);
+	ep2_free(r);
+	for (int i = 0; i < max; i++) {
+		bn_free(k[i]);
+		ep2_free(p[i]);
+	}
+	free(k);
+	free(p);
+}
+
 int main(void) {
 	if (core_init() != RLC_OK) {
 		core_clean();
@@ -581,6 +674,7 @@ int main(void) {
 
 	util_banner("Arithmetic:", 1);
 	arith();
+	lot();
 
 	core_clean();
 	return 0;
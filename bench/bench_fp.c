@@ -166,7 +166,7 @@ static void util(void) {
 }
 
 static void arith(void) {
-	fp_t a, b, c, f[2];
+	fp_t a, b, c, f[2], g[16], h[16];
 	dv_t d;
 	bn_t e;
 
@@ -177,6 +177,10 @@ static void arith(void) {
 	bn_null(e);
 	fp_null(f[0]);
 	fp_null(f[1]);
+	for (int j = 0; j < 16; j++) {
+		fp_null(g[j]);
+		fp_null(h[j]);
+	}
 
 	fp_new(a);
 	fp_new(b);
@@ -185,6 +189,10 @@ static void arith(void) {
 	bn_new(e);
 	fp_new(f[0]);
 	fp_new(f[1]);
+	for (int j = 0; j < 16; j++) {
+		fp_new(g[j]);
+		fp_new(h[j]);
+	}
 
 	dv_zero(d, RLC_DV_DIGS);
 
@@ -368,6 +376,32 @@ static void arith(void) {
 	BENCH_END;
 #endif
 
+	BENCH_BEGIN("fp_add_vec (16)") {
+		for (int j = 0; j < 16; j++) {
+			fp_rand(g[j]);
+			fp_rand(h[j]);
+		}
+		BENCH_ADD(fp_add_vec(g, (const fp_t *)g, (const fp_t *)h, 16));
+	}
+	BENCH_END;
+
+	BENCH_BEGIN("fp_mul_vec (16)") {
+		for (int j = 0; j < 16; j++) {
+			fp_rand(g[j]);
+			fp_rand(h[j]);
+		}
+		BENCH_ADD(fp_mul_vec(g, (const fp_t *)g, (const fp_t *)h, 16));
+	}
+	BENCH_END;
+
+	BENCH_BEGIN("fp_sqr_vec (16)") {
+		for (int j = 0; j < 16; j++) {
+			fp_rand(g[j]);
+		}
+		BENCH_ADD(fp_sqr_vec(g, (const fp_t *)g, 16));
+	}
+	BENCH_END;
+
 	BENCH_BEGIN("fp_dbl") {
 		fp_rand(a);
 		BENCH_ADD(fp_dbl(c, a));
@@ -575,6 +609,12 @@ static void arith(void) {
 	BENCH_END;
 #endif
 
+	BENCH_BEGIN("fp_exp_chain") {
+		fp_rand(a);
+		BENCH_ADD(fp_exp_chain(c, a, RLC_FP_EXP_INV));
+	}
+	BENCH_END;
+
 	BENCH_BEGIN("fp_srt") {
 		fp_rand(a);
 		fp_sqr(a, a);
@@ -582,6 +622,28 @@ static void arith(void) {
 	}
 	BENCH_END;
 
+	BENCH_BEGIN("fp_smb") {
+		fp_rand(a);
+		BENCH_ADD(fp_smb(a));
+	}
+	BENCH_END;
+
+#if FP_SMB == BASIC || !defined(STRIP)
+	BENCH_BEGIN("fp_smb_basic") {
+		fp_rand(a);
+		BENCH_ADD(fp_smb_basic(a));
+	}
+	BENCH_END;
+#endif
+
+#if FP_SMB == BINAR || !defined(STRIP)
+	BENCH_BEGIN("fp_smb_binar") {
+		fp_rand(a);
+		BENCH_ADD(fp_smb_binar(a));
+	}
+	BENCH_END;
+#endif
+
 	BENCH_BEGIN("fp_prime_conv") {
 		bn_rand(e, RLC_POS, RLC_FP_BITS);
 		BENCH_ADD(fp_prime_conv(a, e));
@@ -607,6 +669,10 @@ static void arith(void) {
 	bn_free(e);
 	fp_free(f[0]);
 	fp_free(f[1]);
+	for (int j = 0; j < 16; j++) {
+		fp_free(g[j]);
+		fp_free(h[j]);
+	}
 }
 
 int main(void) {
@@ -391,6 +391,12 @@ static void arith2(void) {
 	}
 	BENCH_END;
 
+	BENCH_BEGIN("fp2_smb") {
+		fp2_rand(a);
+		BENCH_ADD(fp2_smb(a));
+	}
+	BENCH_END;
+
 	BENCH_BEGIN("fp2_pck") {
 		fp2_rand(a);
 		fp2_conv_cyc(a, a);
@@ -338,7 +338,8 @@ static void pairing12(void) {
 	ep2_t p[2], r;
 	ep_t q[2];
 	fp12_t e;
-	int j;
+	fp2_t *t[2];
+	int i, j;
 
 	bn_null(k);
 	bn_null(n);
@@ -357,6 +358,11 @@ static void pairing12(void) {
 		ep_null(q[j]);
 		ep2_new(p[j]);
 		ep_new(q[j]);
+		t[j] = RLC_ALLOCA(fp2_t, RLC_PP_TABLE_K12);
+		for (i = 0; i < RLC_PP_TABLE_K12; i++) {
+			fp2_null(t[j][i]);
+			fp2_new(t[j][i]);
+		}
 	}
 
 	ep2_curve_get_ord(n);
@@ -539,6 +545,33 @@ static void pairing12(void) {
 	BENCH_END;
 #endif
 
+#if PP_MAP == OATEP || !defined(STRIP)
+	BENCH_BEGIN("pp_map_pre_k12") {
+		ep2_rand(p[0]);
+		BENCH_ADD(pp_map_pre_k12(t[0], p[0]));
+	}
+	BENCH_END;
+
+	BENCH_BEGIN("pp_map_sim_oatep_k12_pre (1)") {
+		ep2_rand(p[0]);
+		ep_rand(q[0]);
+		pp_map_pre_k12(t[0], p[0]);
+		BENCH_ADD(pp_map_sim_oatep_k12_pre(e, q, t, 1));
+	}
+	BENCH_END;
+
+	BENCH_BEGIN("pp_map_sim_oatep_k12_pre (2)") {
+		ep2_rand(p[0]);
+		ep_rand(q[0]);
+		ep2_rand(p[1]);
+		ep_rand(q[1]);
+		pp_map_pre_k12(t[0], p[0]);
+		pp_map_pre_k12(t[1], p[1]);
+		BENCH_ADD(pp_map_sim_oatep_k12_pre(e, q, t, 2));
+	}
+	BENCH_END;
+#endif
+
 	bn_free(k);
 	bn_free(n);
 	bn_free(l);
@@ -547,6 +580,10 @@ static void pairing12(void) {
 	for (j = 0; j < 2; j++) {
 		ep2_free(p[j]);
 		ep_free(q[j]);
+		for (i = 0; i < RLC_PP_TABLE_K12; i++) {
+			fp2_free(t[j][i]);
+		}
+		RLC_FREE(t[j]);
 	}
 }
 
@@ -8,7 +8,7 @@ message("      FP_PMERS=[off|on] Prefer Pseudo-Mersenne primes over random prime
 message("      FP_QNRES=[off|on] Use -1 as quadratic non-residue (make sure that p = 3 mod 8).")
 message("      FP_WIDTH=w        Width w in [2,6] of window processing for exponentiation methods.\n")
 
-message("   ** Available prime field arithmetic methods (default = BASIC;COMBA;COMBA;MONTY;MONTY;SLIDE):")
+message("   ** Available prime field arithmetic methods (default = BASIC;COMBA;COMBA;MONTY;MONTY;SLIDE;BINAR):")
 
 message("      Field addition")
 message("      FP_METHD=BASIC    Schoolbook addition.")
@@ -43,6 +43,10 @@ message("      FP_METHD=BASIC    Binary exponentiation.")
 message("      FP_METHD=SLIDE    Sliding window exponentiation.")
 message("      FP_METHD=MONTY    Constant-time Montgomery powering ladder.\n")
 
+message("      Legendre symbol (optional, default = BINAR)")
+message("      FP_METHD=BASIC    Legendre symbol by Euler's criterion.")
+message("      FP_METHD=BINAR    Constant-time binary Legendre symbol algorithm.\n")
+
 # Choose the prime field size.
 if (NOT FP_PRIME)
 	set(FP_PRIME 256)
@@ -65,12 +69,16 @@ option(FP_QNRES "Use -1 as quadratic non-residue." off)
 
 # Choose the arithmetic methods.
 if (NOT FP_METHD)
-	set(FP_METHD "INTEG;INTEG;INTEG;MONTY;MONTY;SLIDE")
+	set(FP_METHD "INTEG;INTEG;INTEG;MONTY;MONTY;SLIDE;BINAR")
 endif(NOT FP_METHD)
 list(LENGTH FP_METHD FP_LEN)
 if (FP_LEN LESS 6)
 	message(FATAL_ERROR "Incomplete FP_METHD specification: ${FP_METHD}")
 endif(FP_LEN LESS 6)
+# The Legendre symbol method was added later, so keep older lists working.
+if (FP_LEN LESS 7)
+	list(APPEND FP_METHD "BINAR")
+endif(FP_LEN LESS 7)
 
 list(GET FP_METHD 0 FP_ADD)
 list(GET FP_METHD 1 FP_MUL)
@@ -78,4 +86,5 @@ list(GET FP_METHD 2 FP_SQR)
 list(GET FP_METHD 3 FP_RDC)
 list(GET FP_METHD 4 FP_INV)
 list(GET FP_METHD 5 FP_EXP)
+list(GET FP_METHD 6 FP_SMB)
 set(FP_METHD ${FP_METHD} CACHE STRING "Method for prime field arithmetic.")
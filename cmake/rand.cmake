@@ -1,6 +1,7 @@
 message(STATUS "Available pseudo-random number generators (default = HASHD):\n")
 
 message("   RAND=HASHD     Use the HASH-DRBG generator. (recommended)")
+message("   RAND=CTRDR     Use the CTR-DRBG generator with AES-256 (requires BC).")
 message("   RAND=RDRND     Use Intel RdRand instruction directly.")
 message("   RAND=UDEV      Use the operating system underlying generator.")
 message("   RAND=CALL      Override the generator with a callback.\n")
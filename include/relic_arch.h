@@ -43,6 +43,28 @@
 #include <avr/pgmspace.h>
 #endif
 
+/*============================================================================*/
+/* Constant definitions                                                       */
+/*============================================================================*/
+
+/**
+ * Instruction set extensions detected at runtime.
+ */
+enum {
+	/** SHA extensions. */
+	RLC_ARCH_SHA = 1,
+	/** Advanced Vector Extensions 2. */
+	RLC_ARCH_AVX2 = 2,
+	/** AES new instructions together with carry-less multiplication. */
+	RLC_ARCH_AES = 4,
+	/** AVX-512 integer fused multiply-add on 52-bit limbs. */
+	RLC_ARCH_IFMA = 8,
+	/** Flag-preserving multiplication (MULX). */
+	RLC_ARCH_BMI2 = 16,
+	/** Independent carry chains (ADCX and ADOX). */
+	RLC_ARCH_ADX = 32
+};
+
 /*============================================================================*/
 /* Macro definitions                                                          */
 /*============================================================================*/
@@ -76,12 +98,14 @@
 /*============================================================================*/
 
 /**
- * Performs architecture-dependent initialization.
+ * Performs architecture-dependent initialization. The processor is queried
+ * only once, and the selection is shared by all threads.
  */
 void arch_init(void);
 
 /**
- * Performs architecture-dependent finalization.
+ * Performs architecture-dependent finalization. The selection made by
+ * arch_init() is kept, since other threads may still be using it.
  */
 void arch_clean(void);
 
@@ -95,6 +119,42 @@ ull_t arch_cycles(void);
  */
 uint_t arch_lzcnt(dig_t);
 
+/**
+ * Tests if an instruction set extension was detected by arch_init().
+ *
+ * @param[in] ext			- the extension, a RLC_ARCH_* value.
+ * @return 1 if the extension can be used, 0 otherwise.
+ */
+int arch_cpu_has(int ext);
+
+/**
+ * Hides instruction set extensions from arch_cpu_has(), so that the portable
+ * code runs instead. Only meant for testing, and must not be called while
+ * other threads are using the library.
+ *
+ * @param[in] ext			- the extensions to hide, as RLC_ARCH_* flags, or 0
+ * 							to restore all the detected ones.
+ */
+void arch_cpu_mask(int ext);
+
+#ifdef ARITH_ALT
+/**
+ * Selects the low-level arithmetic backend used by the library, among the
+ * preferred and the fallback ones, according to the extensions detected by
+ * arch_init().
+ */
+void arch_arith(void);
+
+/**
+ * Forces the fallback low-level arithmetic backend. Only meant for testing,
+ * and must not be called while other threads are using the library.
+ *
+ * @param[in] alt			- 1 to force the fallback backend, 0 to restore the
+ * 							selection made by arch_init().
+ */
+void arch_arith_force(int alt);
+#endif
+
 #if ARCH == AVR
 
 /**
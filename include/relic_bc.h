@@ -49,6 +49,16 @@
  */
 #define RLC_BC_LEN					16
 
+/**
+ * Length in bytes of the nonce used in GCM.
+ */
+#define RLC_BC_GCM_IV				12
+
+/**
+ * Length in bytes of the authentication tag produced in GCM.
+ */
+#define RLC_BC_GCM_TAG				16
+
 /*============================================================================*/
 /* Function prototypes                                                        */
 /*============================================================================*/
@@ -81,4 +91,73 @@ int bc_aes_cbc_enc(uint8_t *out, int *out_len, uint8_t *in,
 int bc_aes_cbc_dec(uint8_t *out, int *out_len, uint8_t *in,
 		int in_len, uint8_t *key, int key_len, uint8_t *iv);
 
+/**
+ * Encrypts with AES in CTR mode. The counter block is incremented as a 128-bit
+ * big-endian integer.
+ *
+ * @param[out] out			- the resulting ciphertext.
+ * @param[in,out] out_len	- the buffer capacity and number of bytes written.
+ * @param[in] in			- the bytes to be encrypted.
+ * @param[in] in_len		- the number of bytes to encrypt.
+ * @param[in] key			- the key.
+ * @param[in] key_len		- the key size in bytes.
+ * @param[in] iv			- the initial counter block.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int bc_aes_ctr_enc(uint8_t *out, int *out_len, const uint8_t *in, int in_len,
+		const uint8_t *key, int key_len, const uint8_t *iv);
+
+/**
+ * Decrypts with AES in CTR mode.
+ *
+ * @param[out] out			- the resulting plaintext.
+ * @param[in,out] out_len	- the buffer capacity and number of bytes written.
+ * @param[in] in			- the bytes to be decrypted.
+ * @param[in] in_len		- the number of bytes to decrypt.
+ * @param[in] key			- the key.
+ * @param[in] key_len		- the key size in bytes.
+ * @param[in] iv			- the initial counter block.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int bc_aes_ctr_dec(uint8_t *out, int *out_len, const uint8_t *in, int in_len,
+		const uint8_t *key, int key_len, const uint8_t *iv);
+
+/**
+ * Encrypts and authenticates with AES in GCM mode. The authentication tag is
+ * appended to the ciphertext.
+ *
+ * @param[out] out			- the resulting ciphertext and tag.
+ * @param[in,out] out_len	- the buffer capacity and number of bytes written.
+ * @param[in] in			- the bytes to be encrypted.
+ * @param[in] in_len		- the number of bytes to encrypt.
+ * @param[in] key			- the key.
+ * @param[in] key_len		- the key size in bytes.
+ * @param[in] iv			- the nonce with RLC_BC_GCM_IV bytes.
+ * @param[in] ad			- the associated data to authenticate.
+ * @param[in] ad_len		- the number of bytes of associated data.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int bc_aes_gcm_enc(uint8_t *out, int *out_len, const uint8_t *in, int in_len,
+		const uint8_t *key, int key_len, const uint8_t *iv,
+		const uint8_t *ad, int ad_len);
+
+/**
+ * Verifies and decrypts with AES in GCM mode. No plaintext is written if the
+ * authentication tag at the end of the ciphertext is invalid.
+ *
+ * @param[out] out			- the resulting plaintext.
+ * @param[in,out] out_len	- the buffer capacity and number of bytes written.
+ * @param[in] in			- the ciphertext and tag to be decrypted.
+ * @param[in] in_len		- the number of bytes to decrypt.
+ * @param[in] key			- the key.
+ * @param[in] key_len		- the key size in bytes.
+ * @param[in] iv			- the nonce with RLC_BC_GCM_IV bytes.
+ * @param[in] ad			- the associated data to authenticate.
+ * @param[in] ad_len		- the number of bytes of associated data.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int bc_aes_gcm_dec(uint8_t *out, int *out_len, const uint8_t *in, int in_len,
+		const uint8_t *key, int key_len, const uint8_t *iv,
+		const uint8_t *ad, int ad_len);
+
 #endif /* !RLC_BC_H */
@@ -130,24 +130,15 @@
 /*============================================================================*/
 
 /**
- * Library context.
+ * Library context holding the parameters configured for the library. The
+ * context can be shared by many threads once set up, each thread keeping its
+ * mutable state in a separate thr_t structure.
  */
 typedef struct _ctx_t {
-	/** The value returned by the last call, can be RLC_OK or RLC_ERR. */
-	int code;
-
-#ifdef CHECK
-	/** The state of the last error caught. */
-	sts_t *last;
-	/** Error state to be used outside try-catch blocks. */
-	sts_t error;
-	/** Error number to be used outside try-catch blocks. */
-	err_t number;
-	/** The error message respective to the last error. */
-	char *reason[ERR_MAX];
-	/** A flag to indicate if the last error was already caught. */
-	int caught;
-#endif /* CHECK */
+	/** Number of threads sharing the context. */
+	int refs;
+	/** Flag to indicate if the context was allocated by the library. */
+	int alloc;
 
 #ifdef WITH_FB
 	/** Identifier of the currently configured binary field. */
@@ -240,6 +231,12 @@ typedef struct _ctx_t {
 	int cnr;
 	/** 2-adicity. */
 	int ad2;
+	/** Sliding-window recodings of the fixed exponents. */
+	uint8_t exp_win[RLC_FP_EXPS][RLC_FP_BITS + 1];
+	/** Number of windows in each recoding. */
+	int exp_len[RLC_FP_EXPS];
+	/** Number of precomputed odd powers needed by each recoding. */
+	int exp_tab[RLC_FP_EXPS];
 #if FP_RDC == QUICK || !defined(STRIP)
 	/** Sparse representation of prime modulus. */
 	int sps[RLC_TERMS + 1];
@@ -387,6 +384,31 @@ typedef struct _ctx_t {
 #if defined(WITH_PC)
 	gt_t gt_g;
 #endif
+} ctx_t;
+
+/**
+ * State private to each thread using the library.
+ */
+typedef struct _thr_t {
+	/** Flag to indicate if the state was initialized. */
+	int init;
+	/** The library context the thread holds a reference to. */
+	ctx_t *ctx;
+	/** The value returned by the last call, can be RLC_OK or RLC_ERR. */
+	int code;
+
+#ifdef CHECK
+	/** The state of the last error caught. */
+	sts_t *last;
+	/** Error state to be used outside try-catch blocks. */
+	sts_t error;
+	/** Error number to be used outside try-catch blocks. */
+	err_t number;
+	/** The error message respective to the last error. */
+	char *reason[ERR_MAX];
+	/** A flag to indicate if the last error was already caught. */
+	int caught;
+#endif /* CHECK */
 
 #if BENCH > 0
 	/** Stores the time measured before the execution of the benchmark. */
@@ -407,31 +429,50 @@ typedef struct _ctx_t {
 #else
 	void (*rand_call)(uint8_t *, int, void *);
 	void *rand_args;
+#endif
+#if RAND == CTRDR
+	/** Number of buffered pseudo-random bytes not yet consumed. */
+	int rand_left;
 #endif
 	/** Flag to indicate if PRNG is seed. */
 	int seeded;
 	/** Counter to keep track of number of calls since last seeding. */
 	int counter;
-} ctx_t;
+} thr_t;
 
 /*============================================================================*/
 /* Function prototypes                                                        */
 /*============================================================================*/
 
 /**
- * Initializes the library.
+ * Initializes the library. If the calling thread has no library context, a new
+ * one is created.
  *
  * @return RLC_OK if no error occurs, RLC_ERR otherwise.
  */
 int core_init(void);
 
 /**
- * Finalizes the library.
+ * Finalizes the library for the calling thread. The library context is
+ * finalized when the last thread sharing it is finalized.
  *
  * @return RLC_OK if no error occurs, RLC_ERR otherwise.
  */
 int core_clean(void);
 
+/**
+ * Makes the calling thread share a library context already initialized by
+ * another thread, without setting up the parameters again. The thread must
+ * call core_clean() when done. Since the parameters are shared, they should
+ * not be changed while other threads are using the context. Threads already
+ * holding a library context must call core_clean() first.
+ *
+ * @param[in] ctx					- the library context to share.
+ * @return RLC_OK if no error occurs, RLC_ERR if the context is NULL or the
+ * thread already holds one.
+ */
+int core_attach(ctx_t *ctx);
+
 /**
  * Returns a pointer to the current library context.
  *
@@ -446,6 +487,14 @@ ctx_t *core_get(void);
  */
 void core_set(ctx_t *ctx);
 
+/**
+ * Returns a pointer to the state of the calling thread, initializing it if
+ * needed.
+ *
+ * @return a pointer to the thread state.
+ */
+thr_t *core_thr(void);
+
 #if MULTI != RELIC_NONE
 /**
  * Set an initializer function which is called when the context
@@ -455,6 +504,44 @@ void core_set(ctx_t *ctx);
  * @param[in] init_ptr a pointer which is passed to the initialized
  */
 void core_set_thread_initializer(void (*init)(void *init_ptr), void *init_ptr);
+
+/**
+ * Sets the number of threads among which large multi-point operations are
+ * split. The default is CORES.
+ *
+ * @param[in] n						- the number of threads.
+ */
+void core_set_threads(int n);
+
+/**
+ * Returns the number of threads among which large multi-point operations are
+ * split.
+ *
+ * @return the number of threads.
+ */
+int core_get_threads(void);
+
+/**
+ * Computes a share of an operation split among threads.
+ *
+ * @param[in,out] args				- the arguments of the operation.
+ * @param[in] i						- the index of the share.
+ * @param[in] c						- the number of shares.
+ */
+typedef void (*core_job_t)(void *args, int i, int c);
+
+/**
+ * Computes an operation split into shares among threads that share the library
+ * context of the caller. With POSIX threads, the shares are taken by a pool of
+ * persistent workers created on first use and stopped when the last library
+ * context is finalized. Shares that no other thread computed are computed by
+ * the caller.
+ *
+ * @param[in] job					- the function computing each share.
+ * @param[in,out] args				- the arguments of the operation.
+ * @param[in] c						- the number of shares.
+ */
+void core_run(core_job_t job, void *args, int c);
 #endif
 
 #endif /* !RLC_CORE_H */
@@ -1164,6 +1164,61 @@ int cp_bls_sig(g1_t s, uint8_t *msg, int len, bn_t d);
  */
 int cp_bls_ver(g1_t s, uint8_t *msg, int len, g2_t q);
 
+/**
+ * Verifies a batch of messages signed with the BLS protocol. The signatures
+ * are combined with random small exponents, such that all of them are checked
+ * with a single product of pairings. If the batch is invalid, it is bisected
+ * to locate the invalid signatures. Signatures and public keys are checked to
+ * be valid group elements, and those that are not are flagged as invalid.
+ *
+ * @param[out] ok			- the flags indicating valid signatures, or NULL.
+ * @param[in] s				- the signatures.
+ * @param[in] msgs			- the signed messages.
+ * @param[in] lens			- the message lengths in bytes.
+ * @param[in] q				- the public keys.
+ * @param[in] n				- the number of signatures.
+ * @return a boolean value indicating if all signatures are valid.
+ */
+int cp_bls_ver_batch(int ok[], g1_t s[], uint8_t *msgs[], int lens[],
+		g2_t q[], int n);
+
+/**
+ * Aggregates signatures produced with the BLS protocol.
+ *
+ * @param[out] a			- the aggregate signature.
+ * @param[in] s				- the signatures to aggregate.
+ * @param[in] n				- the number of signatures.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int cp_bls_agg_sig(g1_t a, g1_t s[], int n);
+
+/**
+ * Verifies an aggregate signature over distinct messages signed with the BLS
+ * protocol, using a single product of n + 1 pairings.
+ *
+ * @param[in] a				- the aggregate signature.
+ * @param[in] msgs			- the signed messages.
+ * @param[in] lens			- the message lengths in bytes.
+ * @param[in] q				- the public keys.
+ * @param[in] n				- the number of signers.
+ * @return a boolean value indicating if the signature is valid.
+ */
+int cp_bls_agg_ver(g1_t a, uint8_t *msgs[], int lens[], g2_t q[], int n);
+
+/**
+ * Verifies an aggregate signature over the same message signed with the BLS
+ * protocol, by aggregating the public keys and computing two pairings. The
+ * public keys must come with proofs of possession of the private keys.
+ *
+ * @param[in] a				- the aggregate signature.
+ * @param[in] msg			- the signed message.
+ * @param[in] len			- the message length in bytes.
+ * @param[in] q				- the public keys.
+ * @param[in] n				- the number of signers.
+ * @return a boolean value indicating if the signature is valid.
+ */
+int cp_bls_fast_agg_ver(g1_t a, uint8_t *msg, int len, g2_t q[], int n);
+
 /**
  * Generates a key pair for the Boneh-Boyen (BB) signature protocol.
  *
@@ -38,6 +38,7 @@
 
 #include "relic_fp.h"
 #include "relic_bn.h"
+#include "relic_md.h"
 #include "relic_types.h"
 #include "relic_label.h"
 
@@ -159,6 +160,36 @@ enum {
  */
 #define RLC_EP_MTYPE		2
 
+/**
+ * Number of points from which simultaneous multiplication accumulates buckets
+ * in affine coordinates with batched inversions.
+ */
+#define RLC_EP_LOT_BASIC		1024
+
+/**
+ * Number of points from which simultaneous multiplication is split among
+ * core_get_threads() threads when multithreading is enabled.
+ */
+#define RLC_EP_LOT_MULTI		256
+
+/**
+ * Number of byte arrays from which batch hashing is split among
+ * core_get_threads() threads when multithreading is enabled.
+ */
+#define RLC_EP_MAP_MULTI		32
+
+/**
+ * Number of points from which batch deserialization is split among
+ * core_get_threads() threads when multithreading is enabled.
+ */
+#define RLC_EP_READ_MULTI		32
+
+/**
+ * Number of points added at a time by the addition tree in simultaneous
+ * addition.
+ */
+#define RLC_EP_ADD_SIM		1024
+
 /**
  * Size of a precomputation table using the binary method.
  */
@@ -768,6 +799,17 @@ int ep_on_curve(const ep_t p);
  */
 void ep_tab(ep_t *t, const ep_t p, int w);
 
+/**
+ * Applies the efficient endomorphism of the currently configured prime
+ * elliptic curve to a point. The endomorphism maps (x, y) to (beta * x, y)
+ * if a = 0 and to (-x, beta * y) otherwise.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the point to map.
+ * @throw ERR_NO_CONFIG		- if the curve does not have an endomorphism.
+ */
+void ep_psi(ep_t r, const ep_t p);
+
 /**
  * Prints a prime elliptic curve point.
  *
@@ -796,6 +838,24 @@ int ep_size_bin(const ep_t a, int pack);
  */
 void ep_read_bin(ep_t a, const uint8_t *bin, int len);
 
+/**
+ * Reads many prime elliptic curve points stored contiguously in a byte vector,
+ * each encoded in len bytes as accepted by ep_read_bin(). Each point is
+ * decompressed and checked to be in the curve. Invalid points are set to the
+ * point at infinity and flagged instead of throwing an error. If
+ * multithreading is enabled, at least RLC_EP_READ_MULTI points are split among
+ * core_get_threads() threads.
+ *
+ * @param[out] a			- the results.
+ * @param[out] r			- the flags indicating which points are valid.
+ * @param[in] bin			- the byte vector with n * len bytes.
+ * @param[in] len			- the buffer capacity of each point.
+ * @param[in] n				- the number of points.
+ * @return the number of valid points.
+ * @throw ERR_NO_BUFFER		- if the buffer capacity is invalid.
+ */
+int ep_read_bin_batch(ep_t *a, int *r, const uint8_t *bin, int len, int n);
+
 /**
  * Writes a prime elliptic curve point to a byte vector in big-endian format
  * with optional point compression.
@@ -863,6 +923,16 @@ void ep_add_jacob(ep_t r, const ep_t p, const ep_t q);
  */
 void ep_sub(ep_t r, const ep_t p, const ep_t q);
 
+/**
+ * Adds many prime elliptic curve points. Computes R = \sum P_i. The points are
+ * added in affine coordinates with an addition tree sharing inversions.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the points to add.
+ * @param[in] n				- the number of points to add.
+ */
+void ep_add_sim(ep_t r, const ep_t p[], int n);
+
 /**
  * Doubles a prime elliptic curve point represented in affine coordinates.
  *
@@ -1139,6 +1209,46 @@ void ep_mul_sim_joint(ep_t r, const ep_t p, const bn_t k, const ep_t q,
  */
 void ep_mul_sim_gen(ep_t r, const bn_t k, const ep_t q, const bn_t m);
 
+/**
+ * Multiplies and adds many prime elliptic curve points simultaneously.
+ * Computes R = \sum k_iP_i. Small sets are processed by interleaving window
+ * NAFs, while larger sets use the bucket method with a window size chosen
+ * according to the number of points, switching to affine buckets from
+ * RLC_EP_LOT_BASIC points on. If multithreading is enabled, sets of at least
+ * RLC_EP_LOT_MULTI points are split among core_get_threads() threads with
+ * core_run(), which share the library context of the caller. Both split the
+ * scalars with the GLV method when the curve has an efficient endomorphism.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the points to multiply.
+ * @param[in] k				- the integer scalars.
+ * @param[in] n				- the number of points to multiply.
+ */
+void ep_mul_sim_lot(ep_t r, const ep_t p[], const bn_t k[], int n);
+
+/**
+ * Multiplies and adds many prime elliptic curve points simultaneously using
+ * the bucket method with buckets kept in projective coordinates.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the points to multiply.
+ * @param[in] k				- the integer scalars.
+ * @param[in] n				- the number of points to multiply.
+ */
+void ep_mul_sim_lot_projc(ep_t r, const ep_t p[], const bn_t k[], int n);
+
+/**
+ * Multiplies and adds many prime elliptic curve points simultaneously using
+ * the bucket method with buckets kept in affine coordinates, such that the
+ * additions into distinct buckets share a simultaneous inversion.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the points to multiply.
+ * @param[in] k				- the integer scalars.
+ * @param[in] n				- the number of points to multiply.
+ */
+void ep_mul_sim_lot_basic(ep_t r, const ep_t p[], const bn_t k[], int n);
+
 /**
  * Multiplies prime elliptic curve points by small scalars.
  * Computes R = \sum k_iP_i.
@@ -1200,6 +1310,49 @@ void ep_map_dst(ep_t p, const uint8_t *msg, int len, const uint8_t *dst, int dst
  */
 void ep_map_dst(ep_t p, const uint8_t *msg, int len, const uint8_t *dst, int dst_len);
 
+/**
+ * Maps many byte arrays to points in a prime elliptic curve with the same
+ * domain separation tag. The results are the same as calling ep_map_dst() on
+ * each array, but the inversions are shared and, if multithreading is enabled,
+ * at least RLC_EP_MAP_MULTI arrays are split among core_get_threads() threads.
+ * When MD_MAP is SH256, the arrays are expanded eight at a time; other hash
+ * functions expand them one by one.
+ *
+ * @param[out] p			- the results.
+ * @param[in] msg			- the byte arrays to map.
+ * @param[in] len			- the array lengths in bytes.
+ * @param[in] n				- the number of byte arrays.
+ * @param[in] dst			- the domain separation tag.
+ * @param[in] dst_len		- the domain separation tag length in bytes.
+ */
+void ep_map_dst_batch(ep_t *p, uint8_t *msg[], int len[], int n,
+		const uint8_t *dst, int dst_len);
+
+/**
+ * Maps a byte array to a point in a prime elliptic curve using a domain
+ * separation tag prepared with md_xmd_ctx_init(). The result is the same as
+ * calling ep_map_dst() with the tag.
+ *
+ * @param[out] p			- the result.
+ * @param[in] msg			- the byte array to map.
+ * @param[in] len			- the array length in bytes.
+ * @param[in] ctx			- the prepared domain separation tag.
+ */
+void ep_map_dst_ctx(ep_t p, const uint8_t *msg, int len,
+		const md_xmd_ctx_t ctx);
+
+/**
+ * Maps a byte array absorbed with md_xmd_init() and md_xmd_update() to a point
+ * in a prime elliptic curve. The result is the same as calling ep_map_dst()
+ * on the whole byte array.
+ *
+ * @param[out] p			- the result.
+ * @param[in,out] ctx		- the hash state.
+ * @param[in] dst			- the domain separation tag.
+ * @param[in] dst_len		- the domain separation tag length in bytes.
+ */
+void ep_map_dst_stream(ep_t p, md_ctx_t ctx, const uint8_t *dst, int dst_len);
+
 /**
  * Compresses a point.
  *
@@ -45,6 +45,37 @@
 /* Constant definitions                                                       */
 /*============================================================================*/
 
+/**
+ * Number of points from which simultaneous multiplication in G_2 accumulates
+ * buckets in affine coordinates with batched inversions.
+ */
+#define RLC_EPX_LOT_BASIC		256
+
+/**
+ * Number of points from which simultaneous multiplication in G_2 is split
+ * among core_get_threads() threads when multithreading is enabled.
+ */
+#define RLC_EPX_LOT_MULTI		64
+
+/**
+ * Number of byte arrays from which batch hashing to G_2 is split among
+ * core_get_threads() threads when multithreading is enabled.
+ */
+#define RLC_EPX_MAP_MULTI		16
+
+/**
+ * Number of points from which batch deserialization of points over a
+ * quadratic extension is split among core_get_threads() threads when
+ * multithreading is enabled.
+ */
+#define RLC_EPX_READ_MULTI		16
+
+/**
+ * Number of points added at a time by the addition tree in simultaneous
+ * addition over a quadratic extension.
+ */
+#define RLC_EPX_ADD_SIM		1024
+
 /**
  * Size of a precomputation table using the binary method.
  */
@@ -569,6 +600,25 @@ int ep2_size_bin(ep2_t a, int pack);
  */
 void ep2_read_bin(ep2_t a, const uint8_t *bin, int len);
 
+/**
+ * Reads many prime elliptic curve points over a quadratic extension stored
+ * contiguously in a byte vector, each encoded in len bytes as accepted by
+ * ep2_read_bin(). Each point is decompressed and checked to be in the curve.
+ * Invalid points are set to the point at infinity and flagged instead of
+ * throwing an error. If multithreading is enabled, at least
+ * RLC_EPX_READ_MULTI points are split among core_get_threads() threads.
+ *
+ * @param[out] a			- the results.
+ * @param[out] r			- the flags indicating which points are valid.
+ * @param[in] bin			- the byte vector with n * len bytes.
+ * @param[in] len			- the buffer capacity of each point.
+ * @param[in] n				- the number of points.
+ * @return the number of valid points.
+ * @throw ERR_NO_BUFFER		- if the buffer capacity is invalid.
+ */
+int ep2_read_bin_batch(ep2_t *a, int *r, const uint8_t *bin, int len,
+		int n);
+
 /**
  * Writes a prime elliptic curve pointer over a quadratic extension to a byte
  * vector in big-endian format with optional point compression.
@@ -631,6 +681,17 @@ void ep2_add_projc(ep2_t r, ep2_t p, ep2_t q);
   */
  void ep2_sub(ep2_t r, ep2_t p, ep2_t q);
 
+/**
+ * Adds many points in an elliptic curve over a quadratic extension.
+ * Computes R = \sum P_i. The points are added in affine coordinates with an
+ * addition tree sharing inversions.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the points to add.
+ * @param[in] n				- the number of points to add.
+ */
+void ep2_add_sim(ep2_t r, ep2_t p[], int n);
+
 /**
  * Doubles a points represented in affine coordinates in an elliptic curve over
  * a quadratic extension.
@@ -887,14 +948,42 @@ void ep2_mul_sim_joint(ep2_t r, ep2_t p, bn_t k, ep2_t q, bn_t m);
 
 /**
  * Multiplies simultaneously elements from G_2. Computes R = \Sum_i=0..n k_iP_i.
+ * Small sets are processed by interleaving NAFs, while larger sets use the
+ * bucket method, switching to affine buckets from RLC_EPX_LOT_BASIC elements
+ * on. If multithreading is enabled, sets of at least RLC_EPX_LOT_MULTI
+ * elements are split among core_get_threads() threads, as in
+ * ep_mul_sim_lot().
  *
  * @param[out] r			- the result.
- * @param[out] p			- the G_2 elements to multiply.
- * @param[out] k			- the integer scalars.
- * @param[out] n			- the number of elements to multiply.
+ * @param[in] p				- the G_2 elements to multiply.
+ * @param[in] k				- the integer scalars.
+ * @param[in] n				- the number of elements to multiply.
  */
 void ep2_mul_sim_lot(ep2_t r, ep2_t p[], const bn_t k[], int n);
 
+/**
+ * Multiplies simultaneously elements from G_2 using the bucket method with
+ * buckets kept in projective coordinates.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the G_2 elements to multiply.
+ * @param[in] k				- the integer scalars.
+ * @param[in] n				- the number of elements to multiply.
+ */
+void ep2_mul_sim_lot_projc(ep2_t r, ep2_t p[], const bn_t k[], int n);
+
+/**
+ * Multiplies simultaneously elements from G_2 using the bucket method with
+ * buckets kept in affine coordinates, such that the additions into distinct
+ * buckets share a simultaneous inversion.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the G_2 elements to multiply.
+ * @param[in] k				- the integer scalars.
+ * @param[in] n				- the number of elements to multiply.
+ */
+void ep2_mul_sim_lot_basic(ep2_t r, ep2_t p[], const bn_t k[], int n);
+
 /**
  * Multiplies and adds the generator and a prime elliptic curve point
  * simultaneously. Computes R = kG + lQ.
@@ -955,6 +1044,51 @@ void ep2_map(ep2_t p, const uint8_t *msg, int len);
  */
 void ep2_map_dst(ep2_t p, const uint8_t *msg, int len, const uint8_t *dst, int dst_len);
 
+/**
+ * Maps many byte arrays to points in an elliptic curve over a quadratic
+ * extension with the same domain separation tag. The results are the same as
+ * calling ep2_map_dst() on each array, but the inversions are shared and, if
+ * multithreading is enabled, at least RLC_EPX_MAP_MULTI arrays are split
+ * among core_get_threads() threads.
+ * When MD_MAP is SH256, the arrays are expanded eight at a time; other hash
+ * functions expand them one by one.
+ *
+ * @param[out] p			- the results.
+ * @param[in] msg			- the byte arrays to map.
+ * @param[in] len			- the array lengths in bytes.
+ * @param[in] n				- the number of byte arrays.
+ * @param[in] dst			- the domain separation tag.
+ * @param[in] dst_len		- the domain separation tag length in bytes.
+ */
+void ep2_map_dst_batch(ep2_t *p, uint8_t *msg[], int len[], int n,
+		const uint8_t *dst, int dst_len);
+
+/**
+ * Maps a byte array to a point in an elliptic curve over a quadratic extension
+ * using a domain separation tag prepared with md_xmd_ctx_init(). The result is
+ * the same as calling ep2_map_dst() with the tag.
+ *
+ * @param[out] p			- the result.
+ * @param[in] msg			- the byte array to map.
+ * @param[in] len			- the array length in bytes.
+ * @param[in] ctx			- the prepared domain separation tag.
+ */
+void ep2_map_dst_ctx(ep2_t p, const uint8_t *msg, int len,
+		const md_xmd_ctx_t ctx);
+
+/**
+ * Maps a byte array absorbed with md_xmd_init() and md_xmd_update() to a point
+ * in an elliptic curve over a
+ * quadratic extension. The result is the same as calling ep2_map_dst()
+ * on the whole byte array.
+ *
+ * @param[out] p			- the result.
+ * @param[in,out] ctx		- the hash state.
+ * @param[in] dst			- the domain separation tag.
+ * @param[in] dst_len		- the domain separation tag length in bytes.
+ */
+void ep2_map_dst_stream(ep2_t p, md_ctx_t ctx, const uint8_t *dst, int dst_len);
+
 /**
  * Computes a power of the Gailbraith-Lin-Scott homomorphism of a point
  * represented in affine coordinates on a twisted elliptic curve over a
@@ -112,7 +112,7 @@ typedef struct _sts_t {
 /**
  * Implements the TRY clause of the error-handling routines.
  *
- * This macro copies the last error from the current library context to
+ * This macro copies the last error from the state of the calling thread to
  * a temporary variable and handles the current error. The loop is used so
  * the CATCH facility is called first to store the address of the error
  * being caught. The setjmp() function is then called to store the current
@@ -123,10 +123,10 @@ typedef struct _sts_t {
 #define RLC_ERR_TRY														\
 	{																	\
 		sts_t *_last, _this;											\
-		ctx_t *_ctx = core_get();										\
-		_last = _ctx->last; 											\
+		thr_t *_thr = core_thr();										\
+		_last = _thr->last; 											\
 		_this.block = 1;												\
-		_ctx->last = &_this; 											\
+		_thr->last = &_this; 											\
 		for (int _z = 0; ; _z = 1) 										\
 			if (_z) { 													\
 				if (setjmp(_this.addr) == 0) { 							\
@@ -144,18 +144,18 @@ typedef struct _sts_t {
  */
 #define RLC_ERR_CATCH(ADDR)												\
 					else { } 											\
-					_ctx->caught = 0; 									\
+					_thr->caught = 0; 									\
 				} else {												\
-					_ctx->caught = 1; 									\
+					_thr->caught = 1; 									\
 				}														\
-				_ctx->last = _last;										\
+				_thr->last = _last;										\
 				break; 													\
 			} else {													\
 				_this.error = ADDR; 									\
 			}															\
 	} 																	\
 	for (int _z = 0; _z < 2; _z++) 										\
-		if (_z == 1 && core_get()->caught) 								\
+		if (_z == 1 && core_thr()->caught) 								\
 
 /**
  * Implements the THROW clause of the error-handling routines.
@@ -176,23 +176,23 @@ typedef struct _sts_t {
  */
 #define RLC_ERR_THROW(E)												\
 	{																	\
-		ctx_t *_ctx = core_get();										\
-		_ctx->code = RLC_ERR;											\
-		if (_ctx->last != NULL && _ctx->last->block == 0) {				\
+		thr_t *_thr = core_thr();										\
+		_thr->code = RLC_ERR;											\
+		if (_thr->last != NULL && _thr->last->block == 0) {				\
 			exit(E);													\
 		}																\
-		if (_ctx->last == NULL) {										\
-			_ctx->last = &(_ctx->error);								\
-			_ctx->error.error = &(_ctx->number);						\
-			_ctx->error.block = 0;										\
-			_ctx->number = E;											\
+		if (_thr->last == NULL) {										\
+			_thr->last = &(_thr->error);								\
+			_thr->error.error = &(_thr->number);						\
+			_thr->error.block = 0;										\
+			_thr->number = E;											\
 			RLC_ERR_PRINT(E);											\
 		} else {														\
-			for (; ; longjmp(_ctx->last->addr, 1)) {					\
+			for (; ; longjmp(_thr->last->addr, 1)) {					\
 				RLC_ERR_PRINT(E);										\
-				if (_ctx->last->error) {								\
+				if (_thr->last->error) {								\
 					if (E != ERR_CAUGHT) {								\
-						*(_ctx->last->error) = E;						\
+						*(_thr->last->error) = E;						\
 					}													\
 				}														\
 			}															\
@@ -257,10 +257,10 @@ typedef struct _sts_t {
  * Stub for the THROW clause.
  */
 #ifdef QUIET
-#define RLC_THROW(E)			core_get()->code = RLC_ERR;
+#define RLC_THROW(E)			core_thr()->code = RLC_ERR;
 #else
 #define RLC_THROW(E)														\
-	core_get()->code = RLC_ERR; 											\
+	core_thr()->code = RLC_ERR; 											\
 	util_print("FATAL ERROR in %s:%d\n", RLC_FILE, __LINE__);				\
 
 #endif
@@ -136,6 +136,27 @@ enum {
 	SS_1536,
 };
 
+/*
+ * Identifiers of fixed exponents derived from the prime modulus.
+ */
+enum {
+	/** Exponent p - 2, used for inversion. */
+	RLC_FP_EXP_INV,
+	/** Exponent (p - 1)/2, used for testing quadratic residuosity. */
+	RLC_FP_EXP_LEG,
+	/** Exponent (p + 1)/4, used for square roots when p = 3 mod 4. */
+	RLC_FP_EXP_SRT,
+	/** Exponent (p - 3)/4, used for inverse square roots when p = 3 mod 4. */
+	RLC_FP_EXP_ISR,
+	/** Number of fixed exponents. */
+	RLC_FP_EXPS
+};
+
+/**
+ * Maximum window width used to recode the fixed exponents.
+ */
+#define RLC_FP_EXP_WIDTH	6
+
 /**
  * Constant used to indicate that there's some room left in the storage of
  * prime field elements. This can be used to avoid carries.
@@ -376,6 +397,18 @@ typedef rlc_align dig_t fp_st[RLC_FP_DIGS + RLC_PAD(RLC_FP_BYTES)/(RLC_DIG / 8)]
 #define fp_exp(C, A, B)		fp_exp_monty(C, A, B)
 #endif
 
+/**
+ * Computes the Legendre symbol of a prime field element modulo the prime.
+ *
+ * @param[in] A				- the prime field element.
+ * @return 1 if A is a nonzero square, -1 if it is not a square, 0 if zero.
+ */
+#if FP_SMB == BASIC
+#define fp_smb(A)		fp_smb_basic(A)
+#elif FP_SMB == BINAR
+#define fp_smb(A)		fp_smb_binar(A)
+#endif
+
 /*============================================================================*/
 /* Function prototypes                                                        */
 /*============================================================================*/
@@ -918,6 +951,38 @@ void fp_sqr_integ(fp_t c, const fp_t a);
  */
 void fp_sqr_karat(fp_t c, const fp_t a);
 
+/**
+ * Adds prime field elements pairwise. Computes c[i] = a[i] + b[i] for
+ * 0 <= i < n.
+ *
+ * @param[out] c			- the results.
+ * @param[in] a				- the first prime field elements to add.
+ * @param[in] b				- the second prime field elements to add.
+ * @param[in] n				- the number of elements.
+ */
+void fp_add_vec(fp_t *c, const fp_t *a, const fp_t *b, int n);
+
+/**
+ * Multiplies prime field elements pairwise. Computes c[i] = a[i] * b[i] for
+ * 0 <= i < n, eight elements at a time with AVX-512 IFMA when available.
+ *
+ * @param[out] c			- the results.
+ * @param[in] a				- the first prime field elements to multiply.
+ * @param[in] b				- the second prime field elements to multiply.
+ * @param[in] n				- the number of elements.
+ */
+void fp_mul_vec(fp_t *c, const fp_t *a, const fp_t *b, int n);
+
+/**
+ * Squares prime field elements. Computes c[i] = a[i]^2 for 0 <= i < n, eight
+ * elements at a time with AVX-512 IFMA when available.
+ *
+ * @param[out] c			- the results.
+ * @param[in] a				- the prime field elements to square.
+ * @param[in] n				- the number of elements.
+ */
+void fp_sqr_vec(fp_t *c, const fp_t *a, int n);
+
 /**
  * Shifts a prime field element number to the left. Computes
  * c = a * 2^bits.
@@ -1066,6 +1131,47 @@ void fp_exp_slide(fp_t c, const fp_t a, const bn_t b);
  */
 void fp_exp_monty(fp_t c, const fp_t a, const bn_t b);
 
+/**
+ * Exponentiates a prime field element by one of the fixed exponents derived
+ * from the prime modulus, using the addition chain precomputed when the prime
+ * was configured.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the basis.
+ * @param[in] id			- the identifier of the exponent.
+ */
+void fp_exp_chain(fp_t c, const fp_t a, int id);
+
+/**
+ * Exponentiates many prime field elements by the same fixed exponent, walking
+ * the precomputed addition chain on all elements at once with fp_sqr_vec() and
+ * fp_mul_vec().
+ *
+ * @param[out] c			- the results.
+ * @param[in] a				- the bases.
+ * @param[in] id			- the identifier of the exponent.
+ * @param[in] n				- the number of elements.
+ */
+void fp_exp_chain_vec(fp_t *c, const fp_t *a, int id, int n);
+
+/**
+ * Computes the Legendre symbol of a prime field element using Euler's
+ * criterion.
+ *
+ * @param[in] a				- the prime field element.
+ * @return 1 if a is a nonzero square, -1 if it is not a square, 0 if zero.
+ */
+int fp_smb_basic(const fp_t a);
+
+/**
+ * Computes the Legendre symbol of a prime field element in constant time
+ * using a binary variant of the Jacobi symbol algorithm.
+ *
+ * @param[in] a				- the prime field element.
+ * @return 1 if a is a nonzero square, -1 if it is not a square, 0 if zero.
+ */
+int fp_smb_binar(const fp_t a);
+
 /**
  * Extracts the square root of a prime field element. Computes c = sqrt(a). The
  * other square root is the negation of c.
@@ -1586,6 +1586,15 @@ void fp2_frb(fp2_t c, fp2_t a, int i);
  */
 int fp2_srt(fp2_t c, fp2_t a);
 
+/**
+ * Computes the quadratic character of a quadratic extension field element,
+ * that is, the Legendre symbol of its norm in the prime field.
+ *
+ * @param[in] a				- the extension field element.
+ * @return 1 if a is a nonzero square, -1 if it is not a square, 0 if zero.
+ */
+int fp2_smb(fp2_t a);
+
 /**
  * Compresses an extension field element.
  *
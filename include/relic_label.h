@@ -48,28 +48,48 @@
 #define first_ctx     RLC_PREFIX(first_ctx)
 #undef core_ctx
 #define core_ctx      RLC_PREFIX(core_ctx)
+#undef core_thr_ctx
+#define core_thr_ctx  RLC_PREFIX(core_thr_ctx)
 
 #undef core_init
 #undef core_clean
+#undef core_attach
 #undef core_get
 #undef core_set
+#undef core_thr
+#undef core_set_threads
+#undef core_get_threads
+#undef core_run
 
 #define core_init 	RLC_PREFIX(core_init)
 #define core_clean 	RLC_PREFIX(core_clean)
+#define core_attach 	RLC_PREFIX(core_attach)
 #define core_get 	RLC_PREFIX(core_get)
 #define core_set 	RLC_PREFIX(core_set)
+#define core_thr 	RLC_PREFIX(core_thr)
+#define core_set_threads 	RLC_PREFIX(core_set_threads)
+#define core_get_threads 	RLC_PREFIX(core_get_threads)
+#define core_run 	RLC_PREFIX(core_run)
 
 #undef arch_init
 #undef arch_clean
 #undef arch_cycles
 #undef arch_lzcnt
+#undef arch_cpu_has
+#undef arch_cpu_mask
 #undef arch_copy_rom
+#undef arch_arith
+#undef arch_arith_force
 
 #define arch_init 	RLC_PREFIX(arch_init)
 #define arch_clean 	RLC_PREFIX(arch_clean)
 #define arch_cycles 	RLC_PREFIX(arch_cycles)
 #define arch_lzcnt 	RLC_PREFIX(arch_lzcnt)
+#define arch_cpu_has 	RLC_PREFIX(arch_cpu_has)
+#define arch_cpu_mask 	RLC_PREFIX(arch_cpu_mask)
 #define arch_copy_rom 	RLC_PREFIX(arch_copy_rom)
+#define arch_arith 	RLC_PREFIX(arch_arith)
+#define arch_arith_force 	RLC_PREFIX(arch_arith_force)
 
 #undef bench_overhead
 #undef bench_reset
@@ -486,6 +506,9 @@
 #undef fp_sqr_comba
 #undef fp_sqr_integ
 #undef fp_sqr_karat
+#undef fp_add_vec
+#undef fp_mul_vec
+#undef fp_sqr_vec
 #undef fp_lsh
 #undef fp_rsh
 #undef fp_rdc_basic
@@ -502,6 +525,10 @@
 #undef fp_exp_basic
 #undef fp_exp_slide
 #undef fp_exp_monty
+#undef fp_exp_chain
+#undef fp_exp_chain_vec
+#undef fp_smb_basic
+#undef fp_smb_binar
 #undef fp_srt
 
 #define fp_prime_init 	RLC_PREFIX(fp_prime_init)
@@ -569,6 +596,9 @@
 #define fp_sqr_comba 	RLC_PREFIX(fp_sqr_comba)
 #define fp_sqr_integ 	RLC_PREFIX(fp_sqr_integ)
 #define fp_sqr_karat 	RLC_PREFIX(fp_sqr_karat)
+#define fp_add_vec 	RLC_PREFIX(fp_add_vec)
+#define fp_mul_vec 	RLC_PREFIX(fp_mul_vec)
+#define fp_sqr_vec 	RLC_PREFIX(fp_sqr_vec)
 #define fp_lsh 	RLC_PREFIX(fp_lsh)
 #define fp_rsh 	RLC_PREFIX(fp_rsh)
 #define fp_rdc_basic 	RLC_PREFIX(fp_rdc_basic)
@@ -585,6 +615,10 @@
 #define fp_exp_basic 	RLC_PREFIX(fp_exp_basic)
 #define fp_exp_slide 	RLC_PREFIX(fp_exp_slide)
 #define fp_exp_monty 	RLC_PREFIX(fp_exp_monty)
+#define fp_exp_chain 	RLC_PREFIX(fp_exp_chain)
+#define fp_exp_chain_vec 	RLC_PREFIX(fp_exp_chain_vec)
+#define fp_smb_basic 	RLC_PREFIX(fp_smb_basic)
+#define fp_smb_binar 	RLC_PREFIX(fp_smb_binar)
 #define fp_srt 	RLC_PREFIX(fp_srt)
 
 #undef fp_add1_low
@@ -895,9 +929,11 @@
 #undef ep_rhs
 #undef ep_on_curve
 #undef ep_tab
+#undef ep_psi
 #undef ep_print
 #undef ep_size_bin
 #undef ep_read_bin
+#undef ep_read_bin_batch
 #undef ep_write_bin
 #undef ep_neg
 #undef ep_add_basic
@@ -905,6 +941,7 @@
 #undef ep_add_projc
 #undef ep_add_jacob
 #undef ep_sub
+#undef ep_add_sim
 #undef ep_dbl_basic
 #undef ep_dbl_slp_basic
 #undef ep_dbl_projc
@@ -934,10 +971,16 @@
 #undef ep_mul_sim_joint
 #undef ep_mul_sim_gen
 #undef ep_mul_sim_dig
+#undef ep_mul_sim_lot
+#undef ep_mul_sim_lot_projc
+#undef ep_mul_sim_lot_basic
 #undef ep_norm
 #undef ep_norm_sim
 #undef ep_map
 #undef ep_map_dst
+#undef ep_map_dst_batch
+#undef ep_map_dst_ctx
+#undef ep_map_dst_stream
 #undef ep_pck
 #undef ep_upk
 
@@ -985,9 +1028,11 @@
 #define ep_rhs 	RLC_PREFIX(ep_rhs)
 #define ep_on_curve 	RLC_PREFIX(ep_on_curve)
 #define ep_tab 	RLC_PREFIX(ep_tab)
+#define ep_psi 	RLC_PREFIX(ep_psi)
 #define ep_print 	RLC_PREFIX(ep_print)
 #define ep_size_bin 	RLC_PREFIX(ep_size_bin)
 #define ep_read_bin 	RLC_PREFIX(ep_read_bin)
+#define ep_read_bin_batch 	RLC_PREFIX(ep_read_bin_batch)
 #define ep_write_bin 	RLC_PREFIX(ep_write_bin)
 #define ep_neg 	RLC_PREFIX(ep_neg)
 #define ep_add_basic 	RLC_PREFIX(ep_add_basic)
@@ -995,6 +1040,7 @@
 #define ep_add_projc 	RLC_PREFIX(ep_add_projc)
 #define ep_add_jacob 	RLC_PREFIX(ep_add_jacob)
 #define ep_sub 	RLC_PREFIX(ep_sub)
+#define ep_add_sim 	RLC_PREFIX(ep_add_sim)
 #define ep_dbl_basic 	RLC_PREFIX(ep_dbl_basic)
 #define ep_dbl_slp_basic 	RLC_PREFIX(ep_dbl_slp_basic)
 #define ep_dbl_projc 	RLC_PREFIX(ep_dbl_projc)
@@ -1024,10 +1070,16 @@
 #define ep_mul_sim_joint 	RLC_PREFIX(ep_mul_sim_joint)
 #define ep_mul_sim_gen 	RLC_PREFIX(ep_mul_sim_gen)
 #define ep_mul_sim_dig 	RLC_PREFIX(ep_mul_sim_dig)
+#define ep_mul_sim_lot 	RLC_PREFIX(ep_mul_sim_lot)
+#define ep_mul_sim_lot_projc 	RLC_PREFIX(ep_mul_sim_lot_projc)
+#define ep_mul_sim_lot_basic 	RLC_PREFIX(ep_mul_sim_lot_basic)
 #define ep_norm 	RLC_PREFIX(ep_norm)
 #define ep_norm_sim 	RLC_PREFIX(ep_norm_sim)
 #define ep_map 	RLC_PREFIX(ep_map)
 #define ep_map_dst 	RLC_PREFIX(ep_map_dst)
+#define ep_map_dst_batch 	RLC_PREFIX(ep_map_dst_batch)
+#define ep_map_dst_ctx 	RLC_PREFIX(ep_map_dst_ctx)
+#define ep_map_dst_stream 	RLC_PREFIX(ep_map_dst_stream)
 #define ep_pck 	RLC_PREFIX(ep_pck)
 #define ep_upk 	RLC_PREFIX(ep_upk)
 
@@ -1351,12 +1403,14 @@
 #undef ep2_print
 #undef ep2_size_bin
 #undef ep2_read_bin
+#undef ep2_read_bin_batch
 #undef ep2_write_bin
 #undef ep2_neg
 #undef ep2_add_basic
 #undef ep2_add_slp_basic
 #undef ep2_add_projc
  #undef ep2_sub
+#undef ep2_add_sim
 #undef ep2_dbl_basic
 #undef ep2_dbl_slp_basic
 #undef ep2_dbl_projc
@@ -1385,10 +1439,16 @@
 #undef ep2_mul_sim_joint
 #undef ep2_mul_sim_gen
 #undef ep2_mul_sim_dig
+#undef ep2_mul_sim_lot
+#undef ep2_mul_sim_lot_projc
+#undef ep2_mul_sim_lot_basic
 #undef ep2_norm
 #undef ep2_norm_sim
 #undef ep2_map
 #undef ep2_map_dst
+#undef ep2_map_dst_batch
+#undef ep2_map_dst_ctx
+#undef ep2_map_dst_stream
 #undef ep2_frb
 #undef ep2_pck
 #undef ep2_upk
@@ -1420,12 +1480,14 @@
 #define ep2_print 	RLC_PREFIX(ep2_print)
 #define ep2_size_bin 	RLC_PREFIX(ep2_size_bin)
 #define ep2_read_bin 	RLC_PREFIX(ep2_read_bin)
+#define ep2_read_bin_batch 	RLC_PREFIX(ep2_read_bin_batch)
 #define ep2_write_bin 	RLC_PREFIX(ep2_write_bin)
 #define ep2_neg 	RLC_PREFIX(ep2_neg)
 #define ep2_add_basic 	RLC_PREFIX(ep2_add_basic)
 #define ep2_add_slp_basic 	RLC_PREFIX(ep2_add_slp_basic)
 #define ep2_add_projc 	RLC_PREFIX(ep2_add_projc)
  #define ep2_sub 	RLC_PREFIX(ep2_sub)
+#define ep2_add_sim 	RLC_PREFIX(ep2_add_sim)
 #define ep2_dbl_basic 	RLC_PREFIX(ep2_dbl_basic)
 #define ep2_dbl_slp_basic 	RLC_PREFIX(ep2_dbl_slp_basic)
 #define ep2_dbl_projc 	RLC_PREFIX(ep2_dbl_projc)
@@ -1454,10 +1516,16 @@
 #define ep2_mul_sim_joint 	RLC_PREFIX(ep2_mul_sim_joint)
 #define ep2_mul_sim_gen 	RLC_PREFIX(ep2_mul_sim_gen)
 #define ep2_mul_sim_dig 	RLC_PREFIX(ep2_mul_sim_dig)
+#define ep2_mul_sim_lot 	RLC_PREFIX(ep2_mul_sim_lot)
+#define ep2_mul_sim_lot_projc 	RLC_PREFIX(ep2_mul_sim_lot_projc)
+#define ep2_mul_sim_lot_basic 	RLC_PREFIX(ep2_mul_sim_lot_basic)
 #define ep2_norm 	RLC_PREFIX(ep2_norm)
 #define ep2_norm_sim 	RLC_PREFIX(ep2_norm_sim)
 #define ep2_map 	RLC_PREFIX(ep2_map)
 #define ep2_map_dst 	RLC_PREFIX(ep2_map_dst)
+#define ep2_map_dst_batch 	RLC_PREFIX(ep2_map_dst_batch)
+#define ep2_map_dst_ctx 	RLC_PREFIX(ep2_map_dst_ctx)
+#define ep2_map_dst_stream 	RLC_PREFIX(ep2_map_dst_stream)
 #define ep2_frb 	RLC_PREFIX(ep2_frb)
 #define ep2_pck 	RLC_PREFIX(ep2_pck)
 #define ep2_upk 	RLC_PREFIX(ep2_upk)
@@ -1564,6 +1632,7 @@
 #undef fp2_exp_cyc
 #undef fp2_frb
 #undef fp2_srt
+#undef fp2_smb
 #undef fp2_pck
 #undef fp2_upk
 
@@ -1608,6 +1677,7 @@
 #define fp2_exp_cyc 	RLC_PREFIX(fp2_exp_cyc)
 #define fp2_frb 	RLC_PREFIX(fp2_frb)
 #define fp2_srt 	RLC_PREFIX(fp2_srt)
+#define fp2_smb 	RLC_PREFIX(fp2_smb)
 #define fp2_pck 	RLC_PREFIX(fp2_pck)
 #define fp2_upk 	RLC_PREFIX(fp2_upk)
 
@@ -2410,6 +2480,8 @@
 #undef pp_map_sim_weilp_k12
 #undef pp_map_oatep_k12
 #undef pp_map_sim_oatep_k12
+#undef pp_map_pre_k12
+#undef pp_map_sim_oatep_k12_pre
 #undef pp_map_k48
 #undef pp_map_k54
 
@@ -2462,6 +2534,8 @@
 #define pp_map_sim_weilp_k12 	RLC_PREFIX(pp_map_sim_weilp_k12)
 #define pp_map_oatep_k12 	RLC_PREFIX(pp_map_oatep_k12)
 #define pp_map_sim_oatep_k12 	RLC_PREFIX(pp_map_sim_oatep_k12)
+#define pp_map_pre_k12 	RLC_PREFIX(pp_map_pre_k12)
+#define pp_map_sim_oatep_k12_pre 	RLC_PREFIX(pp_map_sim_oatep_k12_pre)
 #define pp_map_k48 	RLC_PREFIX(pp_map_k48)
 #define pp_map_k54 	RLC_PREFIX(pp_map_k54)
 
@@ -2526,6 +2600,10 @@
 #undef cp_bls_gen
 #undef cp_bls_sig
 #undef cp_bls_ver
+#undef cp_bls_ver_batch
+#undef cp_bls_agg_sig
+#undef cp_bls_agg_ver
+#undef cp_bls_fast_agg_ver
 #undef cp_bbs_gen
 #undef cp_bbs_sig
 #undef cp_bbs_ver
@@ -2613,6 +2691,10 @@
 #define cp_bls_gen 	RLC_PREFIX(cp_bls_gen)
 #define cp_bls_sig 	RLC_PREFIX(cp_bls_sig)
 #define cp_bls_ver 	RLC_PREFIX(cp_bls_ver)
+#define cp_bls_ver_batch 	RLC_PREFIX(cp_bls_ver_batch)
+#define cp_bls_agg_sig 	RLC_PREFIX(cp_bls_agg_sig)
+#define cp_bls_agg_ver 	RLC_PREFIX(cp_bls_agg_ver)
+#define cp_bls_fast_agg_ver 	RLC_PREFIX(cp_bls_fast_agg_ver)
 #define cp_bbs_gen 	RLC_PREFIX(cp_bbs_gen)
 #define cp_bbs_sig 	RLC_PREFIX(cp_bbs_sig)
 #define cp_bbs_ver 	RLC_PREFIX(cp_bbs_ver)
@@ -2654,6 +2736,7 @@
 
 #undef md_map_sh224
 #undef md_map_sh256
+#undef md_map_sh256_many
 #undef md_map_sh384
 #undef md_map_sh512
 #undef md_map_b2s160
@@ -2663,11 +2746,39 @@
 #undef md_hmac
 #undef md_xmd_sh224
 #undef md_xmd_sh256
+#undef md_xmd_sh256_many
 #undef md_xmd_sh384
 #undef md_xmd_sh512
+#undef md_xmd_ctx_init
+#undef md_xmd_ctx_run
+#undef md_init_sh224
+#undef md_update_sh224
+#undef md_final_sh224
+#undef md_init_sh256
+#undef md_update_sh256
+#undef md_final_sh256
+#undef md_init_sh384
+#undef md_update_sh384
+#undef md_final_sh384
+#undef md_init_sh512
+#undef md_update_sh512
+#undef md_final_sh512
+#undef md_init_b2s160
+#undef md_update_b2s160
+#undef md_final_b2s160
+#undef md_init_b2s256
+#undef md_update_b2s256
+#undef md_final_b2s256
+#undef md_hmac_init
+#undef md_hmac_update
+#undef md_hmac_final
+#undef md_xmd_init
+#undef md_xmd_update
+#undef md_xmd_final
 
 #define md_map_sh224 	RLC_PREFIX(md_map_sh224)
 #define md_map_sh256 	RLC_PREFIX(md_map_sh256)
+#define md_map_sh256_many 	RLC_PREFIX(md_map_sh256_many)
 #define md_map_sh384 	RLC_PREFIX(md_map_sh384)
 #define md_map_sh512 	RLC_PREFIX(md_map_sh512)
 #define md_map_b2s160 	RLC_PREFIX(md_map_b2s160)
@@ -2677,9 +2788,231 @@
 #define md_hmac 	RLC_PREFIX(md_hmac)
 #define md_xmd_sh224 	RLC_PREFIX(md_xmd_sh224)
 #define md_xmd_sh256 	RLC_PREFIX(md_xmd_sh256)
+#define md_xmd_sh256_many 	RLC_PREFIX(md_xmd_sh256_many)
 #define md_xmd_sh384 	RLC_PREFIX(md_xmd_sh384)
 #define md_xmd_sh512 	RLC_PREFIX(md_xmd_sh512)
+#define md_xmd_ctx_init 	RLC_PREFIX(md_xmd_ctx_init)
+#define md_xmd_ctx_run 	RLC_PREFIX(md_xmd_ctx_run)
+#define md_init_sh224 	RLC_PREFIX(md_init_sh224)
+#define md_update_sh224 	RLC_PREFIX(md_update_sh224)
+#define md_final_sh224 	RLC_PREFIX(md_final_sh224)
+#define md_init_sh256 	RLC_PREFIX(md_init_sh256)
+#define md_update_sh256 	RLC_PREFIX(md_update_sh256)
+#define md_final_sh256 	RLC_PREFIX(md_final_sh256)
+#define md_init_sh384 	RLC_PREFIX(md_init_sh384)
+#define md_update_sh384 	RLC_PREFIX(md_update_sh384)
+#define md_final_sh384 	RLC_PREFIX(md_final_sh384)
+#define md_init_sh512 	RLC_PREFIX(md_init_sh512)
+#define md_update_sh512 	RLC_PREFIX(md_update_sh512)
+#define md_final_sh512 	RLC_PREFIX(md_final_sh512)
+#define md_init_b2s160 	RLC_PREFIX(md_init_b2s160)
+#define md_update_b2s160 	RLC_PREFIX(md_update_b2s160)
+#define md_final_b2s160 	RLC_PREFIX(md_final_b2s160)
+#define md_init_b2s256 	RLC_PREFIX(md_init_b2s256)
+#define md_update_b2s256 	RLC_PREFIX(md_update_b2s256)
+#define md_final_b2s256 	RLC_PREFIX(md_final_b2s256)
+#define md_hmac_init 	RLC_PREFIX(md_hmac_init)
+#define md_hmac_update 	RLC_PREFIX(md_hmac_update)
+#define md_hmac_final 	RLC_PREFIX(md_hmac_final)
+#define md_xmd_init 	RLC_PREFIX(md_xmd_init)
+#define md_xmd_update 	RLC_PREFIX(md_xmd_update)
+#define md_xmd_final 	RLC_PREFIX(md_xmd_final)
 
 #endif /* LABEL */
 
+/*============================================================================*/
+/* Low-level backend renaming                                                 */
+/*============================================================================*/
+
+/*
+ * When more than one low-level backend is linked into the library, each of
+ * them is compiled with a distinct LOW_LABEL and reached through the dispatch
+ * functions in relic_arch_arith.c.
+ */
+#ifdef LOW_LABEL
+
+#define RLC_LOW_PREFIX(F)		_RLC_PREFIX(LOW_LABEL, F)
+
+#undef bn_add1_low
+#undef bn_addn_low
+#undef bn_sub1_low
+#undef bn_subn_low
+#undef bn_cmp1_low
+#undef bn_cmpn_low
+#undef bn_lsh1_low
+#undef bn_lshb_low
+#undef bn_lshd_low
+#undef bn_rsh1_low
+#undef bn_rshb_low
+#undef bn_rshd_low
+#undef bn_mula_low
+#undef bn_mul1_low
+#undef bn_muln_low
+#undef bn_muld_low
+#undef bn_sqra_low
+#undef bn_sqrn_low
+#undef bn_divn_low
+#undef bn_div1_low
+#undef bn_modn_low
+
+#define bn_add1_low 	RLC_LOW_PREFIX(bn_add1_low)
+#define bn_addn_low 	RLC_LOW_PREFIX(bn_addn_low)
+#define bn_sub1_low 	RLC_LOW_PREFIX(bn_sub1_low)
+#define bn_subn_low 	RLC_LOW_PREFIX(bn_subn_low)
+#define bn_cmp1_low 	RLC_LOW_PREFIX(bn_cmp1_low)
+#define bn_cmpn_low 	RLC_LOW_PREFIX(bn_cmpn_low)
+#define bn_lsh1_low 	RLC_LOW_PREFIX(bn_lsh1_low)
+#define bn_lshb_low 	RLC_LOW_PREFIX(bn_lshb_low)
+#define bn_lshd_low 	RLC_LOW_PREFIX(bn_lshd_low)
+#define bn_rsh1_low 	RLC_LOW_PREFIX(bn_rsh1_low)
+#define bn_rshb_low 	RLC_LOW_PREFIX(bn_rshb_low)
+#define bn_rshd_low 	RLC_LOW_PREFIX(bn_rshd_low)
+#define bn_mula_low 	RLC_LOW_PREFIX(bn_mula_low)
+#define bn_mul1_low 	RLC_LOW_PREFIX(bn_mul1_low)
+#define bn_muln_low 	RLC_LOW_PREFIX(bn_muln_low)
+#define bn_muld_low 	RLC_LOW_PREFIX(bn_muld_low)
+#define bn_sqra_low 	RLC_LOW_PREFIX(bn_sqra_low)
+#define bn_sqrn_low 	RLC_LOW_PREFIX(bn_sqrn_low)
+#define bn_divn_low 	RLC_LOW_PREFIX(bn_divn_low)
+#define bn_div1_low 	RLC_LOW_PREFIX(bn_div1_low)
+#define bn_modn_low 	RLC_LOW_PREFIX(bn_modn_low)
+
+#undef fp_add1_low
+#undef fp_addn_low
+#undef fp_addm_low
+#undef fp_addd_low
+#undef fp_addc_low
+#undef fp_sub1_low
+#undef fp_subn_low
+#undef fp_subm_low
+#undef fp_subd_low
+#undef fp_subc_low
+#undef fp_negm_low
+#undef fp_dbln_low
+#undef fp_dblm_low
+#undef fp_hlvm_low
+#undef fp_hlvd_low
+#undef fp_lsh1_low
+#undef fp_lshb_low
+#undef fp_lshd_low
+#undef fp_rsh1_low
+#undef fp_rshb_low
+#undef fp_rshd_low
+#undef fp_mula_low
+#undef fp_mul1_low
+#undef fp_muln_low
+#undef fp_mulm_low
+#undef fp_sqrn_low
+#undef fp_sqrm_low
+#undef fp_rdcs_low
+#undef fp_rdcn_low
+#undef fp_invm_low
+
+#define fp_add1_low 	RLC_LOW_PREFIX(fp_add1_low)
+#define fp_addn_low 	RLC_LOW_PREFIX(fp_addn_low)
+#define fp_addm_low 	RLC_LOW_PREFIX(fp_addm_low)
+#define fp_addd_low 	RLC_LOW_PREFIX(fp_addd_low)
+#define fp_addc_low 	RLC_LOW_PREFIX(fp_addc_low)
+#define fp_sub1_low 	RLC_LOW_PREFIX(fp_sub1_low)
+#define fp_subn_low 	RLC_LOW_PREFIX(fp_subn_low)
+#define fp_subm_low 	RLC_LOW_PREFIX(fp_subm_low)
+#define fp_subd_low 	RLC_LOW_PREFIX(fp_subd_low)
+#define fp_subc_low 	RLC_LOW_PREFIX(fp_subc_low)
+#define fp_negm_low 	RLC_LOW_PREFIX(fp_negm_low)
+#define fp_dbln_low 	RLC_LOW_PREFIX(fp_dbln_low)
+#define fp_dblm_low 	RLC_LOW_PREFIX(fp_dblm_low)
+#define fp_hlvm_low 	RLC_LOW_PREFIX(fp_hlvm_low)
+#define fp_hlvd_low 	RLC_LOW_PREFIX(fp_hlvd_low)
+#define fp_lsh1_low 	RLC_LOW_PREFIX(fp_lsh1_low)
+#define fp_lshb_low 	RLC_LOW_PREFIX(fp_lshb_low)
+#define fp_lshd_low 	RLC_LOW_PREFIX(fp_lshd_low)
+#define fp_rsh1_low 	RLC_LOW_PREFIX(fp_rsh1_low)
+#define fp_rshb_low 	RLC_LOW_PREFIX(fp_rshb_low)
+#define fp_rshd_low 	RLC_LOW_PREFIX(fp_rshd_low)
+#define fp_mula_low 	RLC_LOW_PREFIX(fp_mula_low)
+#define fp_mul1_low 	RLC_LOW_PREFIX(fp_mul1_low)
+#define fp_muln_low 	RLC_LOW_PREFIX(fp_muln_low)
+#define fp_mulm_low 	RLC_LOW_PREFIX(fp_mulm_low)
+#define fp_sqrn_low 	RLC_LOW_PREFIX(fp_sqrn_low)
+#define fp_sqrm_low 	RLC_LOW_PREFIX(fp_sqrm_low)
+#define fp_rdcs_low 	RLC_LOW_PREFIX(fp_rdcs_low)
+#define fp_rdcn_low 	RLC_LOW_PREFIX(fp_rdcn_low)
+#define fp_invm_low 	RLC_LOW_PREFIX(fp_invm_low)
+
+#undef fp2_addn_low
+#undef fp2_addm_low
+#undef fp2_addd_low
+#undef fp2_addc_low
+#undef fp2_subn_low
+#undef fp2_subm_low
+#undef fp2_subd_low
+#undef fp2_subc_low
+#undef fp2_dbln_low
+#undef fp2_dblm_low
+#undef fp2_norm_low
+#undef fp2_norh_low
+#undef fp2_nord_low
+#undef fp2_muln_low
+#undef fp2_mulc_low
+#undef fp2_mulm_low
+#undef fp2_sqrn_low
+#undef fp2_sqrm_low
+#undef fp2_rdcn_low
+#undef fp3_addn_low
+#undef fp3_addm_low
+#undef fp3_addd_low
+#undef fp3_addc_low
+#undef fp3_subn_low
+#undef fp3_subm_low
+#undef fp3_subd_low
+#undef fp3_subc_low
+#undef fp3_dbln_low
+#undef fp3_dblm_low
+#undef fp3_nord_low
+#undef fp3_muln_low
+#undef fp3_mulc_low
+#undef fp3_mulm_low
+#undef fp3_sqrn_low
+#undef fp3_sqrm_low
+#undef fp3_rdcn_low
+
+#define fp2_addn_low 	RLC_LOW_PREFIX(fp2_addn_low)
+#define fp2_addm_low 	RLC_LOW_PREFIX(fp2_addm_low)
+#define fp2_addd_low 	RLC_LOW_PREFIX(fp2_addd_low)
+#define fp2_addc_low 	RLC_LOW_PREFIX(fp2_addc_low)
+#define fp2_subn_low 	RLC_LOW_PREFIX(fp2_subn_low)
+#define fp2_subm_low 	RLC_LOW_PREFIX(fp2_subm_low)
+#define fp2_subd_low 	RLC_LOW_PREFIX(fp2_subd_low)
+#define fp2_subc_low 	RLC_LOW_PREFIX(fp2_subc_low)
+#define fp2_dbln_low 	RLC_LOW_PREFIX(fp2_dbln_low)
+#define fp2_dblm_low 	RLC_LOW_PREFIX(fp2_dblm_low)
+#define fp2_norm_low 	RLC_LOW_PREFIX(fp2_norm_low)
+#define fp2_norh_low 	RLC_LOW_PREFIX(fp2_norh_low)
+#define fp2_nord_low 	RLC_LOW_PREFIX(fp2_nord_low)
+#define fp2_muln_low 	RLC_LOW_PREFIX(fp2_muln_low)
+#define fp2_mulc_low 	RLC_LOW_PREFIX(fp2_mulc_low)
+#define fp2_mulm_low 	RLC_LOW_PREFIX(fp2_mulm_low)
+#define fp2_sqrn_low 	RLC_LOW_PREFIX(fp2_sqrn_low)
+#define fp2_sqrm_low 	RLC_LOW_PREFIX(fp2_sqrm_low)
+#define fp2_rdcn_low 	RLC_LOW_PREFIX(fp2_rdcn_low)
+#define fp3_addn_low 	RLC_LOW_PREFIX(fp3_addn_low)
+#define fp3_addm_low 	RLC_LOW_PREFIX(fp3_addm_low)
+#define fp3_addd_low 	RLC_LOW_PREFIX(fp3_addd_low)
+#define fp3_addc_low 	RLC_LOW_PREFIX(fp3_addc_low)
+#define fp3_subn_low 	RLC_LOW_PREFIX(fp3_subn_low)
+#define fp3_subm_low 	RLC_LOW_PREFIX(fp3_subm_low)
+#define fp3_subd_low 	RLC_LOW_PREFIX(fp3_subd_low)
+#define fp3_subc_low 	RLC_LOW_PREFIX(fp3_subc_low)
+#define fp3_dbln_low 	RLC_LOW_PREFIX(fp3_dbln_low)
+#define fp3_dblm_low 	RLC_LOW_PREFIX(fp3_dblm_low)
+#define fp3_nord_low 	RLC_LOW_PREFIX(fp3_nord_low)
+#define fp3_muln_low 	RLC_LOW_PREFIX(fp3_muln_low)
+#define fp3_mulc_low 	RLC_LOW_PREFIX(fp3_mulc_low)
+#define fp3_mulm_low 	RLC_LOW_PREFIX(fp3_mulm_low)
+#define fp3_sqrn_low 	RLC_LOW_PREFIX(fp3_sqrn_low)
+#define fp3_sqrm_low 	RLC_LOW_PREFIX(fp3_sqrm_low)
+#define fp3_rdcn_low 	RLC_LOW_PREFIX(fp3_rdcn_low)
+
+#endif /* LOW_LABEL */
+
 #endif /* !RLC_LABEL_H */
@@ -76,6 +76,63 @@ enum {
 #define RLC_MD_LEN					RLC_MD_LEN_B2S256
 #endif
 
+/*============================================================================*/
+/* Type definitions                                                           */
+/*============================================================================*/
+
+/**
+ * Represents the state of a hash function computed incrementally. The state
+ * is large enough to hold any of the supported hash functions.
+ */
+typedef struct {
+	/** The internal state of the hash function. */
+	uint64_t state[32];
+} md_ctx_st;
+
+/**
+ * Pointer to the state of a hash function.
+ */
+typedef md_ctx_st md_ctx_t[1];
+
+/**
+ * Represents the state of a message authentication code computed
+ * incrementally.
+ */
+typedef struct {
+	/** The state of the inner hash. */
+	md_ctx_t ctx;
+	/** The key added to the outer padding. */
+	uint8_t opad[128];
+} md_hmac_ctx_st;
+
+/**
+ * Pointer to the state of a message authentication code.
+ */
+typedef md_hmac_ctx_st md_hmac_ctx_t[1];
+
+/**
+ * Represents a domain separation tag prepared for md_xmd(). With SHA-256, it
+ * also keeps the hash state after the zero padding block and the padded tail
+ * shared by every b_i block.
+ */
+typedef struct {
+	/** The domain separation tag followed by its length. */
+	uint8_t dst[256];
+	/** The domain separation tag length in bytes. */
+	int dst_len;
+	/** The SHA-256 intermediate hash after the zero padding block. */
+	uint32_t mid[8];
+	/** The padded input of a b_i block, starting with room for b_0 ^ b_i. */
+	uint8_t pad[320];
+	/** The number of blocks in the padded input. */
+	int blocks;
+} md_xmd_ctx_st;
+
+/**
+ * Pointer to a prepared domain separation tag.
+ */
+typedef md_xmd_ctx_st md_xmd_ctx_t[1];
+
 /*============================================================================*/
 /* Macro definitions                                                          */
 /*============================================================================*/
@@ -102,6 +159,66 @@ enum {
 #define md_map(H, M, L)			md_map_b2s256(H, M, L)
 #endif
 
+/**
+ * Initializes the incremental computation of the chosen hash function.
+ *
+ * @param[out] C				- the hash state.
+ */
+#if MD_MAP == SH224
+#define md_init(C)				md_init_sh224(C)
+#elif MD_MAP == SH256
+#define md_init(C)				md_init_sh256(C)
+#elif MD_MAP == SH384
+#define md_init(C)				md_init_sh384(C)
+#elif MD_MAP == SH512
+#define md_init(C)				md_init_sh512(C)
+#elif MD_MAP == B2S160
+#define md_init(C)				md_init_b2s160(C)
+#elif MD_MAP == B2S256
+#define md_init(C)				md_init_b2s256(C)
+#endif
+
+/**
+ * Absorbs part of a message into the chosen hash function.
+ *
+ * @param[in,out] C				- the hash state.
+ * @param[in] M					- the message part to hash.
+ * @param[in] L					- the message part length in bytes.
+ */
+#if MD_MAP == SH224
+#define md_update(C, M, L)		md_update_sh224(C, M, L)
+#elif MD_MAP == SH256
+#define md_update(C, M, L)		md_update_sh256(C, M, L)
+#elif MD_MAP == SH384
+#define md_update(C, M, L)		md_update_sh384(C, M, L)
+#elif MD_MAP == SH512
+#define md_update(C, M, L)		md_update_sh512(C, M, L)
+#elif MD_MAP == B2S160
+#define md_update(C, M, L)		md_update_b2s160(C, M, L)
+#elif MD_MAP == B2S256
+#define md_update(C, M, L)		md_update_b2s256(C, M, L)
+#endif
+
+/**
+ * Finishes the incremental computation of the chosen hash function.
+ *
+ * @param[out] H				- the digest.
+ * @param[in,out] C				- the hash state.
+ */
+#if MD_MAP == SH224
+#define md_final(H, C)			md_final_sh224(H, C)
+#elif MD_MAP == SH256
+#define md_final(H, C)			md_final_sh256(H, C)
+#elif MD_MAP == SH384
+#define md_final(H, C)			md_final_sh384(H, C)
+#elif MD_MAP == SH512
+#define md_final(H, C)			md_final_sh512(H, C)
+#elif MD_MAP == B2S160
+#define md_final(H, C)			md_final_b2s160(H, C)
+#elif MD_MAP == B2S256
+#define md_final(H, C)			md_final_b2s256(H, C)
+#endif
+
 /**
  * Maps a byte vector and optional domain separation tag to an arbitrary-length
  * pseudorandom output using the chosen hash function.
@@ -136,6 +253,30 @@ enum {
  */
 void md_map_sh224(uint8_t *hash, const uint8_t *msg, int len);
 
+/**
+ * Initializes the incremental computation of the SHA-224 hash function.
+ *
+ * @param[out] ctx				- the hash state.
+ */
+void md_init_sh224(md_ctx_t ctx);
+
+/**
+ * Absorbs part of a message into the SHA-224 hash function.
+ *
+ * @param[in,out] ctx			- the hash state.
+ * @param[in] msg				- the message part to hash.
+ * @param[in] len				- the message part length in bytes.
+ */
+void md_update_sh224(md_ctx_t ctx, const uint8_t *msg, int len);
+
+/**
+ * Finishes the incremental computation of the SHA-224 hash function.
+ *
+ * @param[out] hash				- the digest.
+ * @param[in,out] ctx			- the hash state.
+ */
+void md_final_sh224(uint8_t *hash, md_ctx_t ctx);
+
 /**
  * Computes the SHA-256 hash function.
  *
@@ -145,6 +286,42 @@ void md_map_sh224(uint8_t *hash, const uint8_t *msg, int len);
  */
 void md_map_sh256(uint8_t *hash, const uint8_t *msg, int len);
 
+/**
+ * Computes the SHA-256 hash function of many messages at once, hashing up to
+ * eight messages in parallel when the processor supports it.
+ *
+ * @param[out] hash				- the concatenated digests.
+ * @param[in] msg				- the messages to hash.
+ * @param[in] len				- the message lengths in bytes.
+ * @param[in] n					- the number of messages.
+ */
+void md_map_sh256_many(uint8_t *hash, const uint8_t *msg[], const int len[],
+		int n);
+
+/**
+ * Initializes the incremental computation of the SHA-256 hash function.
+ *
+ * @param[out] ctx				- the hash state.
+ */
+void md_init_sh256(md_ctx_t ctx);
+
+/**
+ * Absorbs part of a message into the SHA-256 hash function.
+ *
+ * @param[in,out] ctx			- the hash state.
+ * @param[in] msg				- the message part to hash.
+ * @param[in] len				- the message part length in bytes.
+ */
+void md_update_sh256(md_ctx_t ctx, const uint8_t *msg, int len);
+
+/**
+ * Finishes the incremental computation of the SHA-256 hash function.
+ *
+ * @param[out] hash				- the digest.
+ * @param[in,out] ctx			- the hash state.
+ */
+void md_final_sh256(uint8_t *hash, md_ctx_t ctx);
+
 /**
  * Computes the SHA-384 hash function.
  *
@@ -154,6 +331,30 @@ void md_map_sh256(uint8_t *hash, const uint8_t *msg, int len);
  */
 void md_map_sh384(uint8_t *hash, const uint8_t *msg, int len);
 
+/**
+ * Initializes the incremental computation of the SHA-384 hash function.
+ *
+ * @param[out] ctx				- the hash state.
+ */
+void md_init_sh384(md_ctx_t ctx);
+
+/**
+ * Absorbs part of a message into the SHA-384 hash function.
+ *
+ * @param[in,out] ctx			- the hash state.
+ * @param[in] msg				- the message part to hash.
+ * @param[in] len				- the message part length in bytes.
+ */
+void md_update_sh384(md_ctx_t ctx, const uint8_t *msg, int len);
+
+/**
+ * Finishes the incremental computation of the SHA-384 hash function.
+ *
+ * @param[out] hash				- the digest.
+ * @param[in,out] ctx			- the hash state.
+ */
+void md_final_sh384(uint8_t *hash, md_ctx_t ctx);
+
 /**
  * Computes the SHA-512 hash function.
  *
@@ -163,6 +364,30 @@ void md_map_sh384(uint8_t *hash, const uint8_t *msg, int len);
  */
 void md_map_sh512(uint8_t *hash, const uint8_t *msg, int len);
 
+/**
+ * Initializes the incremental computation of the SHA-512 hash function.
+ *
+ * @param[out] ctx				- the hash state.
+ */
+void md_init_sh512(md_ctx_t ctx);
+
+/**
+ * Absorbs part of a message into the SHA-512 hash function.
+ *
+ * @param[in,out] ctx			- the hash state.
+ * @param[in] msg				- the message part to hash.
+ * @param[in] len				- the message part length in bytes.
+ */
+void md_update_sh512(md_ctx_t ctx, const uint8_t *msg, int len);
+
+/**
+ * Finishes the incremental computation of the SHA-512 hash function.
+ *
+ * @param[out] hash				- the digest.
+ * @param[in,out] ctx			- the hash state.
+ */
+void md_final_sh512(uint8_t *hash, md_ctx_t ctx);
+
 /**
  * Computes the BLAKE2s-160 hash function.
  *
@@ -172,6 +397,30 @@ void md_map_sh512(uint8_t *hash, const uint8_t *msg, int len);
  */
 void md_map_b2s160(uint8_t *hash, const uint8_t *msg, int len);
 
+/**
+ * Initializes the incremental computation of the BLAKE2s-160 hash function.
+ *
+ * @param[out] ctx				- the hash state.
+ */
+void md_init_b2s160(md_ctx_t ctx);
+
+/**
+ * Absorbs part of a message into the BLAKE2s-160 hash function.
+ *
+ * @param[in,out] ctx			- the hash state.
+ * @param[in] msg				- the message part to hash.
+ * @param[in] len				- the message part length in bytes.
+ */
+void md_update_b2s160(md_ctx_t ctx, const uint8_t *msg, int len);
+
+/**
+ * Finishes the incremental computation of the BLAKE2s-160 hash function.
+ *
+ * @param[out] hash				- the digest.
+ * @param[in,out] ctx			- the hash state.
+ */
+void md_final_b2s160(uint8_t *hash, md_ctx_t ctx);
+
 /**
  * Computes the BLAKE2s-256 hash function.
  *
@@ -181,6 +430,30 @@ void md_map_b2s160(uint8_t *hash, const uint8_t *msg, int len);
  */
 void md_map_b2s256(uint8_t *hash, const uint8_t *msg, int len);
 
+/**
+ * Initializes the incremental computation of the BLAKE2s-256 hash function.
+ *
+ * @param[out] ctx				- the hash state.
+ */
+void md_init_b2s256(md_ctx_t ctx);
+
+/**
+ * Absorbs part of a message into the BLAKE2s-256 hash function.
+ *
+ * @param[in,out] ctx			- the hash state.
+ * @param[in] msg				- the message part to hash.
+ * @param[in] len				- the message part length in bytes.
+ */
+void md_update_b2s256(md_ctx_t ctx, const uint8_t *msg, int len);
+
+/**
+ * Finishes the incremental computation of the BLAKE2s-256 hash function.
+ *
+ * @param[out] hash				- the digest.
+ * @param[in,out] ctx			- the hash state.
+ */
+void md_final_b2s256(uint8_t *hash, md_ctx_t ctx);
+
 /**
  * Derives a key from shared secret material through the standardized KDF2
  * function.
@@ -215,6 +488,34 @@ void md_mgf(uint8_t *mask, int mask_len, const uint8_t *in, int in_len);
 void md_hmac(uint8_t *mac, const uint8_t *in, int in_len, const uint8_t *key,
 		int key_len);
 
+/**
+ * Initializes the incremental computation of a Message Authentication Code
+ * through HMAC.
+ *
+ * @param[out] ctx				- the authentication state.
+ * @param[in] key				- the cryptographic key.
+ * @param[in] key_len			- the size of the key in bytes.
+ */
+void md_hmac_init(md_hmac_ctx_t ctx, const uint8_t *key, int key_len);
+
+/**
+ * Absorbs part of the data into a Message Authentication Code.
+ *
+ * @param[in,out] ctx			- the authentication state.
+ * @param[in] in				- the data part to authenticate.
+ * @param[in] in_len			- the number of bytes to authenticate.
+ */
+void md_hmac_update(md_hmac_ctx_t ctx, const uint8_t *in, int in_len);
+
+/**
+ * Finishes the incremental computation of a Message Authentication Code.
+ * The key-dependent state is zeroed afterwards.
+ *
+ * @param[out] mac				- the authentication.
+ * @param[in,out] ctx			- the authentication state.
+ */
+void md_hmac_final(uint8_t *mac, md_hmac_ctx_t ctx);
+
 /**
  * Map a byte vector and optional domain separation tag to an arbitrary-length
  * pseudorandom output using the SHA-224 hash function.
@@ -243,6 +544,22 @@ void md_xmd_sh224(uint8_t *buf, int buf_len, const uint8_t *in, int in_len,
 void md_xmd_sh256(uint8_t *buf, int buf_len, const uint8_t *in, int in_len,
 		const uint8_t *dst, int dst_len);
 
+/**
+ * Map many byte vectors and a common domain separation tag to arbitrary-length
+ * pseudorandom outputs using the SHA-256 hash function, computing the
+ * intermediate blocks of all messages with the multi-buffer hash.
+ *
+ * @param[out] buf					- the concatenated output buffers.
+ * @param[in] buf_len				- the requested size of each output.
+ * @param[in] in					- the messages to hash.
+ * @param[in] in_len				- the message lengths in bytes.
+ * @param[in] n						- the number of messages.
+ * @param[in] dst					- the domain separation tag.
+ * @param[in] dst_len				- the domain separation tag length in bytes.
+ */
+void md_xmd_sh256_many(uint8_t *buf, int buf_len, const uint8_t *in[],
+		const int in_len[], int n, const uint8_t *dst, int dst_len);
+
 /**
  * Map a byte vector and optional domain separation tag to an arbitrary-length
  * pseudorandom output using the SHA-384 hash function.
@@ -271,4 +588,58 @@ void md_xmd_sh384(uint8_t *buf, int buf_len, const uint8_t *in, int in_len,
 void md_xmd_sh512(uint8_t *buf, int buf_len, const uint8_t *in, int in_len,
 		const uint8_t *dst, int dst_len);
 
+/**
+ * Prepares a domain separation tag for repeated use with md_xmd_ctx_run().
+ *
+ * @param[out] ctx					- the prepared domain separation tag.
+ * @param[in] dst					- the domain separation tag.
+ * @param[in] dst_len				- the domain separation tag length in bytes.
+ */
+void md_xmd_ctx_init(md_xmd_ctx_t ctx, const uint8_t *dst, int dst_len);
+
+/**
+ * Map a byte vector to an arbitrary-length pseudorandom output using the
+ * chosen hash function and a prepared domain separation tag. The result is
+ * the same as calling md_xmd() with the tag.
+ *
+ * @param[out] buf					- the output buffer.
+ * @param[in] buf_len				- the requested size of the output.
+ * @param[in] in					- the message to hash.
+ * @param[in] in_len				- the message length in bytes.
+ * @param[in] ctx					- the prepared domain separation tag.
+ */
+void md_xmd_ctx_run(uint8_t *buf, int buf_len, const uint8_t *in, int in_len,
+		const md_xmd_ctx_t ctx);
+
+/**
+ * Initializes the incremental mapping of a byte vector to an arbitrary-length
+ * pseudorandom output using the chosen hash function.
+ *
+ * @param[out] ctx					- the hash state.
+ */
+void md_xmd_init(md_ctx_t ctx);
+
+/**
+ * Absorbs part of a byte vector to be mapped by md_xmd_final().
+ *
+ * @param[in,out] ctx				- the hash state.
+ * @param[in] in					- the message part to hash.
+ * @param[in] in_len				- the message part length in bytes.
+ */
+void md_xmd_update(md_ctx_t ctx, const uint8_t *in, int in_len);
+
+/**
+ * Finishes the incremental mapping of a byte vector and optional domain
+ * separation tag to an arbitrary-length pseudorandom output. The result is
+ * the same as calling md_xmd() on the whole byte vector.
+ *
+ * @param[out] buf					- the output buffer.
+ * @param[in] buf_len				- the requested size of the output.
+ * @param[in,out] ctx				- the hash state.
+ * @param[in] dst					- the domain separation tag.
+ * @param[in] dst_len				- the domain separation tag length in bytes.
+ */
+void md_xmd_final(uint8_t *buf, int buf_len, md_ctx_t ctx, const uint8_t *dst,
+		int dst_len);
+
 #endif /* !RLC_MD_H */
@@ -59,20 +59,21 @@
 #endif
 
 /**
- * Make library context private to each thread.
+ * Make the pointer to the library context and the thread state private to each
+ * thread.
  */
 #if MULTI == OPENMP
 /**
- * Active library context, only visible inside the library.
+ * Pointer to active library context, only visible inside the library.
  */
-extern ctx_t first_ctx;
+extern ctx_t *core_ctx;
 
 /**
- * Pointer to active library context, only visible inside the library.
+ * State of the calling thread, only visible inside the library.
  */
-extern ctx_t *core_ctx;
+extern thr_t core_thr_ctx;
 
-#pragma omp threadprivate(first_ctx, core_ctx)
+#pragma omp threadprivate(core_ctx, core_thr_ctx)
 #endif
 
 #endif /* !RLC_MULTI_H */
@@ -567,6 +567,24 @@ typedef RLC_CAT(RLC_GT_LOWER, t) gt_t;
  */
 #define g2_sub(R, P, Q)		RLC_CAT(RLC_G2_LOWER, sub)(R, P, Q)
 
+/**
+ * Adds many elements from G_1. Computes R = \sum P_i.
+ *
+ * @param[out] R			- the result.
+ * @param[in] P				- the elements to add.
+ * @param[in] N				- the number of elements to add.
+ */
+#define g1_add_sim(R, P, N)		RLC_CAT(RLC_G1_LOWER, add_sim)(R, P, N)
+
+/**
+ * Adds many elements from G_2. Computes R = \sum P_i.
+ *
+ * @param[out] R			- the result.
+ * @param[in] P				- the elements to add.
+ * @param[in] N				- the number of elements to add.
+ */
+#define g2_add_sim(R, P, N)		RLC_CAT(RLC_G2_LOWER, add_sim)(R, P, N)
+
 /**
  * Doubles a G_1 element. Computes R = 2P.
  *
@@ -708,6 +726,16 @@ typedef RLC_CAT(RLC_GT_LOWER, t) gt_t;
  */
 #define g1_mul_sim(R, P, K, Q, L)	RLC_CAT(RLC_G1_LOWER, mul_sim)(R, P, K, Q, L)
 
+/**
+ * Multiplies simultaneously elements from G_1. Computes R = \Sum_i=0..n k_iP_i.
+ *
+ * @param[out] R			- the result.
+ * @param[out] P			- the G_1 elements to multiply.
+ * @param[out] K			- the integer scalars.
+ * @param[out] N			- the number of elements to multiply.
+ */
+#define g1_mul_sim_lot(R, P, K, N)	RLC_CAT(RLC_G1_LOWER, mul_sim_lot)(R, P, K, N)
+
 /**
  * Multiplies elements from G_1 by small scalars. Computes R = \sum k_iP_i.
  *
@@ -941,6 +969,40 @@ int g1_is_valid(g1_t a);
  */
 int g2_is_valid(g2_t a);
 
+/**
+ * Reads many G_1 elements stored contiguously in a byte vector, each encoded
+ * in len bytes. Each element is decompressed and checked to be in the curve
+ * and to have the right order. Invalid elements are set to the identity and
+ * flagged instead of throwing an error. If multithreading is enabled, large
+ * batches are split among core_get_threads() threads.
+ *
+ * @param[out] a			- the results.
+ * @param[out] r			- the flags indicating which elements are valid.
+ * @param[in] bin			- the byte vector with n * len bytes.
+ * @param[in] len			- the buffer capacity of each element.
+ * @param[in] n				- the number of elements.
+ * @return the number of valid elements.
+ * @throw ERR_NO_BUFFER		- if the buffer capacity is invalid.
+ */
+int g1_read_bin_batch(g1_t *a, int *r, const uint8_t *bin, int len, int n);
+
+/**
+ * Reads many G_2 elements stored contiguously in a byte vector, each encoded
+ * in len bytes. Each element is decompressed and checked to be in the curve
+ * and to have the right order. Invalid elements are set to the identity and
+ * flagged instead of throwing an error. If multithreading is enabled, large
+ * batches are split among core_get_threads() threads.
+ *
+ * @param[out] a			- the results.
+ * @param[out] r			- the flags indicating which elements are valid.
+ * @param[in] bin			- the byte vector with n * len bytes.
+ * @param[in] len			- the buffer capacity of each element.
+ * @param[in] n				- the number of elements.
+ * @return the number of valid elements.
+ * @throw ERR_NO_BUFFER		- if the buffer capacity is invalid.
+ */
+int g2_read_bin_batch(g2_t *a, int *r, const uint8_t *bin, int len, int n);
+
 /**
  * Checks if an element form G_T is valid (has the right order).
  *
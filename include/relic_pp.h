@@ -41,6 +41,31 @@
 #include "relic_epx.h"
 #include "relic_types.h"
 
+/*============================================================================*/
+/* Constant definitions                                                       */
+/*============================================================================*/
+
+/**
+ * Maximum number of lines evaluated by the Miller loop of the optimal ate
+ * pairing over curves with embedding degree 12.
+ */
+#define RLC_PP_LINES_K12	(3 * (RLC_FP_BITS / 4 + 4) / 2 + 2)
+
+/**
+ * Size of a table of precomputed line coefficients for a fixed argument of the
+ * optimal ate pairing over curves with embedding degree 12.
+ */
+#define RLC_PP_TABLE_K12	(3 * RLC_PP_LINES_K12)
+
+/**
+ * Number of pairings from which the Miller loop of a multi-pairing is split
+ * among core_get_threads() threads when multithreading is enabled. Every share
+ * repeats the squarings of the Miller loop, which cost about as much as adding
+ * one pairing to the loop on BLS12-381, so shares take at least a quarter of
+ * this number of pairings.
+ */
+#define RLC_PP_MAP_MULTI	16
+
 /*============================================================================*/
 /* Macro definitions                                                          */
 /*============================================================================*/
@@ -879,7 +904,10 @@ void pp_map_oatep_k12(fp12_t r, ep_t p, ep2_t q);
 
 /**
  * Computes the optimal ate multi-pairing of in a parameterized elliptic
- * curve with embedding degree 12.
+ * curve with embedding degree 12. If multithreading is enabled, the Miller
+ * loops of at least RLC_PP_MAP_MULTI pairings are split among up to
+ * core_get_threads() threads with core_run(), and the partial results share a
+ * single final exponentiation.
  *
  * @param[out] r			- the result.
  * @param[in] q				- the first pairing arguments.
@@ -888,6 +916,28 @@ void pp_map_oatep_k12(fp12_t r, ep_t p, ep2_t q);
  */
 void pp_map_sim_oatep_k12(fp12_t r, ep_t *p, ep2_t *q, int m);
 
+/**
+ * Precomputes the line coefficients of the optimal ate pairing for a fixed
+ * point in a parameterized elliptic curve with embedding degree 12. The table
+ * remains valid while the same curve is configured.
+ *
+ * @param[out] t			- the table of line coefficients.
+ * @param[in] q				- the fixed elliptic curve point.
+ */
+void pp_map_pre_k12(fp2_t *t, ep2_t q);
+
+/**
+ * Computes the optimal ate multi-pairing in a parameterized elliptic curve
+ * with embedding degree 12 using precomputed line coefficients for the second
+ * arguments.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the first pairing arguments.
+ * @param[in] t				- the tables precomputed for the second arguments.
+ * @param[in] m 			- the number of pairings to evaluate.
+ */
+void pp_map_sim_oatep_k12_pre(fp12_t r, ep_t *p, fp2_t *t[], int m);
+
 /**
  * Computes the Optimal Ate pairing of two points in a parameterized elliptic
  * curve with embedding degree 48.
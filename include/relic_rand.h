@@ -42,6 +42,18 @@
 /* Constant definitions                                                       */
 /*============================================================================*/
 
+/**
+ * Number of pseudo-random bytes produced at once by the CTR-DRBG generator and
+ * buffered for subsequent calls.
+ */
+#define RLC_RAND_BUF		1024
+
+/**
+ * Maximum number of requests to the CTR-DRBG generator before it is
+ * instantiated again with fresh entropy.
+ */
+#define RLC_RAND_RESEED		(1 << 20)
+
 /**
  * Size of the PRNG internal state in bytes.
  */
@@ -53,6 +65,8 @@
 #define RLC_RAND_SIZE		(1 + 2*888/8)
 #endif
 
+#elif RAND == CTRDR
+#define RLC_RAND_SIZE		(32 + 16 + RLC_RAND_BUF)
 #elif RAND == UDEV
 #define RLC_RAND_SIZE		(sizeof(int))
 #elif RAND == CALL
@@ -0,0 +1,284 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (C) 2007-2020 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+/**
+ * @file
+ *
+ * Implementation of the run-time dispatch between the preferred and the
+ * fallback low-level arithmetic backends.
+ *
+ * @ingroup arch
+ */
+
+#include "relic_core.h"
+#include "relic_bn_low.h"
+#include "relic_fp_low.h"
+#include "relic_fpx_low.h"
+
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Instruction set extensions required by the preferred backend.
+ */
+#ifndef ARITH_CPU
+#define ARITH_CPU		0
+#endif
+
+/**
+ * Adds the library prefix to the name of a function in one of the backends.
+ *
+ * @param[in] F				- the function name.
+ */
+#ifdef LABEL
+#define LOW_NAME(F)		RLC_PREFIX(F)
+#else
+#define LOW_NAME(F)		F
+#endif
+
+/**
+ * Flag to indicate if the preferred backend can be used. The fallback backend
+ * runs until arch_init() checks the processor.
+ */
+static int low_main = 0;
+
+/**
+ * Flag to indicate if the fallback backend was forced for testing.
+ */
+static int low_force = 0;
+
+/**
+ * Lists the dispatched functions of each module. Functions that return a value
+ * are listed with R(type, name, parameters, arguments) and the others with
+ * V(name, parameters, arguments).
+ */
+#ifdef WITH_BN
+#define LOW_BN(R, V)														\
+	R(dig_t, bn_add1_low, (dig_t *c, const dig_t *a, const dig_t digit,		\
+		const int size), (c, a, digit, size))								\
+	R(dig_t, bn_addn_low, (dig_t *c, const dig_t *a, const dig_t *b,		\
+		int size), (c, a, b, size))											\
+	R(dig_t, bn_sub1_low, (dig_t *c, const dig_t *a, dig_t digit,			\
+		int size), (c, a, digit, size))										\
+	R(dig_t, bn_subn_low, (dig_t *c, const dig_t *a, const dig_t *b,		\
+		int size), (c, a, b, size))											\
+	R(dig_t, bn_lsh1_low, (dig_t *c, const dig_t *a, int size),				\
+		(c, a, size))														\
+	R(dig_t, bn_lshb_low, (dig_t *c, const dig_t *a, int size, int bits),	\
+		(c, a, size, bits))													\
+	V(bn_lshd_low, (dig_t *c, const dig_t *a, int size, int digits),		\
+		(c, a, size, digits))												\
+	R(dig_t, bn_rsh1_low, (dig_t *c, const dig_t *a, int size),				\
+		(c, a, size))														\
+	R(dig_t, bn_rshb_low, (dig_t *c, const dig_t *a, int size, int bits),	\
+		(c, a, size, bits))													\
+	V(bn_rshd_low, (dig_t *c, const dig_t *a, int size, int digits),		\
+		(c, a, size, digits))												\
+	R(dig_t, bn_mula_low, (dig_t *c, const dig_t *a, dig_t digit,			\
+		int size), (c, a, digit, size))										\
+	R(dig_t, bn_mul1_low, (dig_t *c, const dig_t *a, dig_t digit,			\
+		int size), (c, a, digit, size))										\
+	V(bn_muln_low, (dig_t *c, const dig_t *a, const dig_t *b, int size),	\
+		(c, a, b, size))													\
+	V(bn_muld_low, (dig_t *c, const dig_t *a, int sa, const dig_t *b,		\
+		int sb, int low, int high), (c, a, sa, b, sb, low, high))			\
+	V(bn_sqra_low, (dig_t *c, const dig_t *a, int size), (c, a, size))		\
+	V(bn_sqrn_low, (dig_t *c, const dig_t *a, int size), (c, a, size))		\
+	V(bn_divn_low, (dig_t *c, dig_t *d, dig_t *a, int sa, dig_t *b,			\
+		int sb), (c, d, a, sa, b, sb))										\
+	V(bn_div1_low, (dig_t *c, dig_t *d, const dig_t *a, int size,			\
+		dig_t digit), (c, d, a, size, digit))								\
+	V(bn_modn_low, (dig_t *c, const dig_t *a, int sa, const dig_t *m,		\
+		int sm, dig_t u), (c, a, sa, m, sm, u))
+#else
+#define LOW_BN(R, V)
+#endif
+
+#ifdef WITH_FP
+#define LOW_FP(R, V)														\
+	R(dig_t, fp_add1_low, (dig_t *c, const dig_t *a, dig_t digit),			\
+		(c, a, digit))														\
+	R(dig_t, fp_addn_low, (dig_t *c, const dig_t *a, const dig_t *b),		\
+		(c, a, b))															\
+	V(fp_addm_low, (dig_t *c, const dig_t *a, const dig_t *b), (c, a, b))	\
+	R(dig_t, fp_addd_low, (dig_t *c, const dig_t *a, const dig_t *b),		\
+		(c, a, b))															\
+	V(fp_addc_low, (dig_t *c, const dig_t *a, const dig_t *b), (c, a, b))	\
+	R(dig_t, fp_sub1_low, (dig_t *c, const dig_t *a, dig_t digit),			\
+		(c, a, digit))														\
+	R(dig_t, fp_subn_low, (dig_t *c, const dig_t *a, const dig_t *b),		\
+		(c, a, b))															\
+	V(fp_subm_low, (dig_t *c, const dig_t *a, const dig_t *b), (c, a, b))	\
+	R(dig_t, fp_subd_low, (dig_t *c, const dig_t *a, const dig_t *b),		\
+		(c, a, b))															\
+	V(fp_subc_low, (dig_t *c, const dig_t *a, const dig_t *b), (c, a, b))	\
+	V(fp_negm_low, (dig_t *c, const dig_t *a), (c, a))						\
+	R(dig_t, fp_dbln_low, (dig_t *c, const dig_t *a), (c, a))				\
+	V(fp_dblm_low, (dig_t *c, const dig_t *a), (c, a))						\
+	V(fp_hlvm_low, (dig_t *c, const dig_t *a), (c, a))						\
+	V(fp_hlvd_low, (dig_t *c, const dig_t *a), (c, a))						\
+	R(dig_t, fp_lsh1_low, (dig_t *c, const dig_t *a), (c, a))				\
+	R(dig_t, fp_lshb_low, (dig_t *c, const dig_t *a, int bits),				\
+		(c, a, bits))														\
+	V(fp_lshd_low, (dig_t *c, const dig_t *a, int digits),					\
+		(c, a, digits))														\
+	R(dig_t, fp_rsh1_low, (dig_t *c, const dig_t *a), (c, a))				\
+	R(dig_t, fp_rshb_low, (dig_t *c, const dig_t *a, int bits),				\
+		(c, a, bits))														\
+	V(fp_rshd_low, (dig_t *c, const dig_t *a, int digits),					\
+		(c, a, digits))														\
+	R(dig_t, fp_mula_low, (dig_t *c, const dig_t *a, dig_t digit),			\
+		(c, a, digit))														\
+	R(dig_t, fp_mul1_low, (dig_t *c, const dig_t *a, dig_t digit),			\
+		(c, a, digit))														\
+	V(fp_muln_low, (dig_t *c, const dig_t *a, const dig_t *b), (c, a, b))	\
+	V(fp_mulm_low, (dig_t *c, const dig_t *a, const dig_t *b), (c, a, b))	\
+	V(fp_sqrn_low, (dig_t *c, const dig_t *a), (c, a))						\
+	V(fp_sqrm_low, (dig_t *c, const dig_t *a), (c, a))						\
+	V(fp_rdcs_low, (dig_t *c, const dig_t *a, const dig_t *m), (c, a, m))	\
+	V(fp_rdcn_low, (dig_t *c, dig_t *a), (c, a))							\
+	V(fp_invm_low, (dig_t *c, const dig_t *a), (c, a))
+#else
+#define LOW_FP(R, V)
+#endif
+
+#ifdef WITH_FPX
+#define LOW_FPX(R, V)														\
+	V(fp2_addn_low, (fp2_t c, fp2_t a, fp2_t b), (c, a, b))					\
+	V(fp2_addm_low, (fp2_t c, fp2_t a, fp2_t b), (c, a, b))					\
+	V(fp2_addd_low, (dv2_t c, dv2_t a, dv2_t b), (c, a, b))					\
+	V(fp2_addc_low, (dv2_t c, dv2_t a, dv2_t b), (c, a, b))					\
+	V(fp2_subn_low, (fp2_t c, fp2_t a, fp2_t b), (c, a, b))					\
+	V(fp2_subm_low, (fp2_t c, fp2_t a, fp2_t b), (c, a, b))					\
+	V(fp2_subd_low, (dv2_t c, dv2_t a, dv2_t b), (c, a, b))					\
+	V(fp2_subc_low, (dv2_t c, dv2_t a, dv2_t b), (c, a, b))					\
+	V(fp2_dbln_low, (fp2_t c, fp2_t a), (c, a))								\
+	V(fp2_dblm_low, (fp2_t c, fp2_t a), (c, a))								\
+	V(fp2_norm_low, (fp2_t c, fp2_t a), (c, a))								\
+	V(fp2_norh_low, (dv2_t c, dv2_t a), (c, a))								\
+	V(fp2_nord_low, (dv2_t c, dv2_t a), (c, a))								\
+	V(fp2_muln_low, (dv2_t c, fp2_t a, fp2_t b), (c, a, b))					\
+	V(fp2_mulc_low, (dv2_t c, fp2_t a, fp2_t b), (c, a, b))					\
+	V(fp2_mulm_low, (fp2_t c, fp2_t a, fp2_t b), (c, a, b))					\
+	V(fp2_sqrn_low, (dv2_t c, fp2_t a), (c, a))								\
+	V(fp2_sqrm_low, (fp2_t c, fp2_t a), (c, a))								\
+	V(fp2_rdcn_low, (fp2_t c, dv2_t a), (c, a))								\
+	V(fp3_addn_low, (fp3_t c, fp3_t a, fp3_t b), (c, a, b))					\
+	V(fp3_addm_low, (fp3_t c, fp3_t a, fp3_t b), (c, a, b))					\
+	V(fp3_addd_low, (dv3_t c, dv3_t a, dv3_t b), (c, a, b))					\
+	V(fp3_addc_low, (dv3_t c, dv3_t a, dv3_t b), (c, a, b))					\
+	V(fp3_subn_low, (fp3_t c, fp3_t a, fp3_t b), (c, a, b))					\
+	V(fp3_subm_low, (fp3_t c, fp3_t a, fp3_t b), (c, a, b))					\
+	V(fp3_subd_low, (dv3_t c, dv3_t a, dv3_t b), (c, a, b))					\
+	V(fp3_subc_low, (dv3_t c, dv3_t a, dv3_t b), (c, a, b))					\
+	V(fp3_dbln_low, (fp3_t c, fp3_t a), (c, a))								\
+	V(fp3_dblm_low, (fp3_t c, fp3_t a), (c, a))								\
+	V(fp3_nord_low, (dv3_t c, dv3_t a), (c, a))								\
+	V(fp3_muln_low, (dv3_t c, fp3_t a, fp3_t b), (c, a, b))					\
+	V(fp3_mulm_low, (fp3_t c, fp3_t a, fp3_t b), (c, a, b))					\
+	V(fp3_sqrn_low, (dv2_t c, fp3_t a), (c, a))								\
+	V(fp3_sqrm_low, (fp3_t c, fp3_t a), (c, a))								\
+	V(fp3_rdcn_low, (fp3_t c, dv3_t a), (c, a))
+#else
+#define LOW_FPX(R, V)
+#endif
+
+/**
+ * Lists all the dispatched functions.
+ */
+#define LOW_OPS(R, V)	LOW_BN(R, V) LOW_FP(R, V) LOW_FPX(R, V)
+
+/**
+ * Declares the versions of a function returning a value in both backends. The
+ * backend prefixes are pasted directly to the name, so that the name is not
+ * renamed by relic_label.h first.
+ *
+ * @param[in] T				- the return type.
+ * @param[in] F				- the function name.
+ * @param[in] P				- the parameter list.
+ * @param[in] A				- the argument list.
+ */
+#define LOW_DECL_R(T, F, P, A)												\
+	T LOW_NAME(arith_ ## F) P;												\
+	T LOW_NAME(alt_ ## F) P;
+
+/**
+ * Declares the versions of a function without return value in both backends.
+ *
+ * @param[in] F				- the function name.
+ * @param[in] P				- the parameter list.
+ * @param[in] A				- the argument list.
+ */
+#define LOW_DECL_V(F, P, A)													\
+	void LOW_NAME(arith_ ## F) P;											\
+	void LOW_NAME(alt_ ## F) P;
+
+/**
+ * Defines a function returning a value that forwards to the selected backend.
+ *
+ * @param[in] T				- the return type.
+ * @param[in] F				- the function name.
+ * @param[in] P				- the parameter list.
+ * @param[in] A				- the argument list.
+ */
+#define LOW_CALL_R(T, F, P, A)												\
+	T F P {																	\
+		if (low_main) {														\
+			return LOW_NAME(arith_ ## F) A;									\
+		}																	\
+		return LOW_NAME(alt_ ## F) A;										\
+	}
+
+/**
+ * Defines a function without return value that forwards to the selected
+ * backend.
+ *
+ * @param[in] F				- the function name.
+ * @param[in] P				- the parameter list.
+ * @param[in] A				- the argument list.
+ */
+#define LOW_CALL_V(F, P, A)													\
+	void F P {																\
+		if (low_main) {														\
+			LOW_NAME(arith_ ## F) A;										\
+		} else {															\
+			LOW_NAME(alt_ ## F) A;											\
+		}																	\
+	}
+
+LOW_OPS(LOW_DECL_R, LOW_DECL_V)
+
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+void arch_arith(void) {
+	low_main = !low_force && arch_cpu_has(ARITH_CPU);
+}
+
+void arch_arith_force(int alt) {
+	low_force = alt;
+	arch_arith();
+}
+
+LOW_OPS(LOW_CALL_R, LOW_CALL_V)
@@ -111,3 +111,12 @@ unsigned int arch_lzcnt(unsigned int x) {
 	return lzcnt64_gcc_arm(x);
 #endif
 }
+
+int arch_cpu_has(int ext) {
+	(void)ext;
+	return 0;
+}
+
+void arch_cpu_mask(int ext) {
+	(void)ext;
+}
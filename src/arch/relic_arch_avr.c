@@ -62,3 +62,12 @@ unsigned int arch_lzcnt() {
 	}
 	return 0;
 }
+
+int arch_cpu_has(int ext) {
+	(void)ext;
+	return 0;
+}
+
+void arch_cpu_mask(int ext) {
+	(void)ext;
+}
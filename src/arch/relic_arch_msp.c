@@ -119,3 +119,12 @@ unsigned int arch_lzcnt() {
 	return 0;
 #endif
 }
+
+int arch_cpu_has(int ext) {
+	(void)ext;
+	return 0;
+}
+
+void arch_cpu_mask(int ext) {
+	(void)ext;
+}
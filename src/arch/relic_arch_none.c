@@ -87,3 +87,12 @@ unsigned int arch_lzcnt(dig_t a) {
 #endif
 #endif
 }
+
+int arch_cpu_has(int ext) {
+	(void)ext;
+	return 0;
+}
+
+void arch_cpu_mask(int ext) {
+	(void)ext;
+}
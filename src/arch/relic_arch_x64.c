@@ -30,10 +30,17 @@
  */
 
 #include <stdio.h>
+#if defined(__GNUC__) || defined(__clang__)
+#include <cpuid.h>
+#endif
 
 #include "relic_types.h"
 #include "relic_arch.h"
 
+#if MULTI == PTHREAD
+#include <pthread.h>
+#endif
+
 #include "lzcnt.inc"
 
 #if TIMER == CYCLE
@@ -52,16 +59,113 @@
  */
 static unsigned int (*lzcnt_ptr)(ull_t);
 
+/**
+ * Instruction set extensions detected in the processor. They are detected once
+ * and shared by all threads.
+ */
+static int cpu_ext;
+
+/**
+ * Instruction set extensions masked for testing the portable code.
+ */
+static int cpu_mask;
+
+#if MULTI == PTHREAD
+/**
+ * Guard to detect the processor extensions only once.
+ */
+static pthread_once_t cpu_once = PTHREAD_ONCE_INIT;
+#else
+/**
+ * Flag to indicate if the processor extensions were detected.
+ */
+static int cpu_done;
+#endif
+
+/**
+ * Queries the processor for the supported instruction set extensions.
+ *
+ * @return the extensions that can be used, as RLC_ARCH_* flags.
+ */
+static int cpu_detect(void) {
+	unsigned int a = 0, b = 0, c = 0, d = 0, ecx1, ebx7;
+	int r = 0;
+
+#if defined(__GNUC__) || defined(__clang__)
+	if (!__get_cpuid(0, &a, &b, &c, &d) || a < 7) {
+		return 0;
+	}
+	__cpuid(1, a, b, ecx1, d);
+	__cpuid_count(7, 0, a, ebx7, c, d);
+#else
+	return 0;
+#endif
+
+	/* SHA extensions need SSSE3 and SSE4.1 for the message byte order. */
+	if ((ebx7 >> 29) & 1 && (ecx1 >> 9) & 1 && (ecx1 >> 19) & 1) {
+		r |= RLC_ARCH_SHA;
+	}
+	/* AES-NI is paired with PCLMULQDQ for GCM and SSSE3 for byte swaps. */
+	if ((ecx1 >> 25) & 1 && (ecx1 >> 1) & 1 && (ecx1 >> 9) & 1) {
+		r |= RLC_ARCH_AES;
+	}
+	if ((ebx7 >> 8) & 1) {
+		r |= RLC_ARCH_BMI2;
+	}
+	if ((ebx7 >> 19) & 1) {
+		r |= RLC_ARCH_ADX;
+	}
+	/* Vector extensions also need the OS to save the registers on context
+	 * switch, as reported in XCR0. */
+	if ((ecx1 >> 27) & 1) {
+#if defined(__GNUC__) || defined(__clang__)
+		__asm__ volatile ("xgetbv" : "=a" (a), "=d" (d) : "c" (0));
+#endif
+		if ((ebx7 >> 5) & 1 && (a & 0x06) == 0x06) {
+			r |= RLC_ARCH_AVX2;
+		}
+		/* IFMA needs AVX-512F and the opmask and ZMM state. */
+		if ((ebx7 >> 16) & 1 && (ebx7 >> 21) & 1 && (a & 0xE6) == 0xE6) {
+			r |= RLC_ARCH_IFMA;
+		}
+	}
+	return r;
+}
+
+/**
+ * Selects the implementations that depend on the processor extensions.
+ */
+static void cpu_setup(void) {
+	lzcnt_ptr = (has_lzcnt_hard() ? lzcnt64_hard : lzcnt64_soft);
+	cpu_ext = cpu_detect();
+#ifdef ARITH_ALT
+	arch_arith();
+#endif
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
 
 void arch_init(void) {
-	lzcnt_ptr = (has_lzcnt_hard() ? lzcnt64_hard : lzcnt64_soft);
+#if MULTI == PTHREAD
+	pthread_once(&cpu_once, cpu_setup);
+#else
+#if MULTI == OPENMP
+	#pragma omp critical (arch_init)
+#endif
+	{
+		if (!cpu_done) {
+			cpu_setup();
+			cpu_done = 1;
+		}
+	}
+#endif
 }
 
 void arch_clean(void) {
-	lzcnt_ptr = NULL;
+	/* The selection made by arch_init() is shared by every thread, so it is
+	 * kept until the program finishes. */
 }
 
 #if TIMER == CYCLE
@@ -81,3 +185,14 @@ ull_t arch_cycles(void) {
 unsigned int arch_lzcnt(dig_t x) {
 	return lzcnt_ptr((ull_t)x) - (8 * sizeof(ull_t) - WSIZE);
 }
+
+int arch_cpu_has(int ext) {
+	return (cpu_ext & ~cpu_mask & ext) == ext;
+}
+
+void arch_cpu_mask(int ext) {
+	cpu_mask = ext;
+#ifdef ARITH_ALT
+	arch_arith();
+#endif
+}
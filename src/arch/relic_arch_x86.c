@@ -59,7 +59,7 @@ void arch_init(void) {
 }
 
 void arch_clean(void) {
-	lzcnt_ptr = NULL;
+	/* Other threads may still count leading zeros, so keep the selection. */
 }
 
 ull_t arch_cycles(void) {
@@ -77,3 +77,12 @@ ull_t arch_cycles(void) {
 unsigned int arch_lzcnt(dig_t x) {
 	return lzcnt_ptr((unsigned int)x) - (8 * sizeof(unsigned int) - WSIZE);
 }
+
+int arch_cpu_has(int ext) {
+	(void)ext;
+	return 0;
+}
+
+void arch_cpu_mask(int ext) {
+	(void)ext;
+}
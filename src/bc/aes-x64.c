@@ -0,0 +1,423 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (c) 2009 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Implementation of AES in CBC and CTR modes with the AES new instructions and
+ * of the GHASH function with carry-less multiplication for x86-64 processors.
+ * The kernels take round keys in the layout of rijndaelKeySetupEnc(), which
+ * rijndaelKeySetupX64() also produces, are compiled for their instruction sets
+ * with function attributes and must only be called after arch_cpu_has()
+ * reports the extensions.
+ *
+ * @ingroup bc
+ */
+
+#include <string.h>
+
+#include "relic_conf.h"
+#include "relic_types.h"
+#include "rijndael-alg-fst.h"
+
+#if ARCH == X64 && (defined(__GNUC__) || defined(__clang__))
+
+#include <immintrin.h>
+
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Instruction sets used by the kernels.
+ */
+#define AES_TARGET		__attribute__((target("aes,pclmul,ssse3")))
+
+/**
+ * Number of blocks processed in parallel to hide the latency of the AES
+ * instructions.
+ */
+#define AES_WAYS		8
+
+/**
+ * Round constants of the key schedule.
+ */
+static const u32 rcon[] = {
+	0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1B, 0x36
+};
+
+/**
+ * Applies the S-box to each byte of a key schedule word and optionally rotates
+ * it, as in the SubWord() and RotWord() steps of the key expansion.
+ *
+ * @param[in] w				- the word, with the first byte least significant.
+ * @param[in] rot			- the flag to rotate the word.
+ * @return the transformed word.
+ */
+AES_TARGET static inline u32 sub_word(u32 w, int rot) {
+	__m128i t = _mm_aeskeygenassist_si128(_mm_set1_epi32((int)w), 0);
+
+	return (u32)_mm_cvtsi128_si32(rot ? _mm_srli_si128(t, 4) : t);
+}
+
+/**
+ * Loads the round keys expanded by the reference code, which stores each
+ * word with the first byte in the most significant position.
+ *
+ * @param[out] k			- the round keys.
+ * @param[in] rk			- the expanded key.
+ * @param[in] nr			- the number of rounds.
+ */
+AES_TARGET static inline void aes_keys(__m128i k[MAXNR + 1], const u32 rk[],
+		int nr) {
+	const __m128i bswap32 = _mm_set_epi8(12, 13, 14, 15, 8, 9, 10, 11,
+			4, 5, 6, 7, 0, 1, 2, 3);
+
+	for (int i = 0; i <= nr; i++) {
+		k[i] = _mm_loadu_si128((const __m128i *)(rk + 4 * i));
+		k[i] = _mm_shuffle_epi8(k[i], bswap32);
+	}
+}
+
+/**
+ * Encrypts a block.
+ *
+ * @param[in] b				- the block.
+ * @param[in] k				- the round keys.
+ * @param[in] nr			- the number of rounds.
+ * @return the encrypted block.
+ */
+AES_TARGET static inline __m128i aes_enc(__m128i b, const __m128i k[],
+		int nr) {
+	b = _mm_xor_si128(b, k[0]);
+	for (int i = 1; i < nr; i++) {
+		b = _mm_aesenc_si128(b, k[i]);
+	}
+	return _mm_aesenclast_si128(b, k[nr]);
+}
+
+/**
+ * Reads a big-endian 64-bit integer.
+ *
+ * @param[in] b				- the bytes to read.
+ * @return the integer.
+ */
+static inline uint64_t load_be64(const u8 *b) {
+	uint64_t r = 0;
+
+	for (int i = 0; i < 8; i++) {
+		r = (r << 8) | b[i];
+	}
+	return r;
+}
+
+/**
+ * Writes a big-endian 64-bit integer.
+ *
+ * @param[out] b			- the bytes to write.
+ * @param[in] a				- the integer.
+ */
+static inline void store_be64(u8 *b, uint64_t a) {
+	for (int i = 7; i >= 0; i--, a >>= 8) {
+		b[i] = (u8)a;
+	}
+}
+
+/**
+ * Builds a counter block and increments the counter.
+ *
+ * @param[in,out] hi		- the most significant half of the counter.
+ * @param[in,out] lo		- the least significant half of the counter.
+ * @param[in] inc32			- the flag to increment only the last 32 bits.
+ * @return the counter block.
+ */
+AES_TARGET static inline __m128i ctr_next(uint64_t *hi, uint64_t *lo,
+		int inc32) {
+	__m128i b = _mm_set_epi64x(__builtin_bswap64(*lo), __builtin_bswap64(*hi));
+
+	if (inc32) {
+		*lo = (*lo & 0xFFFFFFFF00000000ULL) | (uint32_t)(*lo + 1);
+	} else {
+		*lo += 1;
+		*hi += (*lo == 0);
+	}
+	return b;
+}
+
+/**
+ * Multiplies two elements of GF(2^128) in the bit-reflected representation
+ * used by GHASH, as described in the Intel carry-less multiplication white
+ * paper.
+ *
+ * @param[in] a				- the first element, with bytes reversed.
+ * @param[in] b				- the second element, with bytes reversed.
+ * @return the product, with bytes reversed.
+ */
+AES_TARGET static inline __m128i gf_mul(__m128i a, __m128i b) {
+	__m128i t2, t3, t4, t5, t6, t7, t8, t9;
+
+	/* Schoolbook product of the 64-bit halves. */
+	t3 = _mm_clmulepi64_si128(a, b, 0x00);
+	t4 = _mm_clmulepi64_si128(a, b, 0x10);
+	t5 = _mm_clmulepi64_si128(a, b, 0x01);
+	t6 = _mm_clmulepi64_si128(a, b, 0x11);
+	t4 = _mm_xor_si128(t4, t5);
+	t5 = _mm_slli_si128(t4, 8);
+	t4 = _mm_srli_si128(t4, 8);
+	t3 = _mm_xor_si128(t3, t5);
+	t6 = _mm_xor_si128(t6, t4);
+
+	/* Shift the 256-bit product left by one to undo the reflection. */
+	t7 = _mm_srli_epi32(t3, 31);
+	t8 = _mm_srli_epi32(t6, 31);
+	t3 = _mm_slli_epi32(t3, 1);
+	t6 = _mm_slli_epi32(t6, 1);
+	t9 = _mm_srli_si128(t7, 12);
+	t8 = _mm_slli_si128(t8, 4);
+	t7 = _mm_slli_si128(t7, 4);
+	t3 = _mm_or_si128(t3, t7);
+	t6 = _mm_or_si128(t6, t8);
+	t6 = _mm_or_si128(t6, t9);
+
+	/* Reduce modulo x^128 + x^7 + x^2 + x + 1. */
+	t7 = _mm_slli_epi32(t3, 31);
+	t8 = _mm_slli_epi32(t3, 30);
+	t9 = _mm_slli_epi32(t3, 25);
+	t7 = _mm_xor_si128(t7, t8);
+	t7 = _mm_xor_si128(t7, t9);
+	t8 = _mm_srli_si128(t7, 4);
+	t7 = _mm_slli_si128(t7, 12);
+	t3 = _mm_xor_si128(t3, t7);
+	t2 = _mm_srli_epi32(t3, 1);
+	t4 = _mm_srli_epi32(t3, 2);
+	t5 = _mm_srli_epi32(t3, 7);
+	t2 = _mm_xor_si128(t2, t4);
+	t2 = _mm_xor_si128(t2, t5);
+	t2 = _mm_xor_si128(t2, t8);
+	t3 = _mm_xor_si128(t3, t2);
+	return _mm_xor_si128(t6, t3);
+}
+
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+AES_TARGET int rijndaelKeySetupX64(u32 rk[], const u8 *key, int bits) {
+	int nk = bits / 32, nr = nk + 6;
+	u32 t;
+
+	for (int i = 0; i < nk; i++) {
+		memcpy(rk + i, key + 4 * i, 4);
+	}
+	/* Expand the words in memory order and byte swap them at the end. */
+	for (int i = nk; i < 4 * (nr + 1); i++) {
+		t = rk[i - 1];
+		if (i % nk == 0) {
+			t = sub_word(t, 1) ^ rcon[i / nk - 1];
+		} else if (nk > 6 && i % nk == 4) {
+			t = sub_word(t, 0);
+		}
+		rk[i] = rk[i - nk] ^ t;
+	}
+	for (int i = 0; i < 4 * (nr + 1); i++) {
+		rk[i] = __builtin_bswap32(rk[i]);
+	}
+	return nr;
+}
+
+AES_TARGET void rijndaelEncX64(const u32 rk[], int nr, const u8 in[16],
+		u8 out[16]) {
+	const __m128i bswap32 = _mm_set_epi8(12, 13, 14, 15, 8, 9, 10, 11,
+			4, 5, 6, 7, 0, 1, 2, 3);
+	__m128i k, b = _mm_loadu_si128((const __m128i *)in);
+
+	/* Load each round key as it is used, since only one block is processed. */
+	for (int i = 0; i <= nr; i++) {
+		k = _mm_loadu_si128((const __m128i *)(rk + 4 * i));
+		k = _mm_shuffle_epi8(k, bswap32);
+		if (i == 0) {
+			b = _mm_xor_si128(b, k);
+		} else if (i < nr) {
+			b = _mm_aesenc_si128(b, k);
+		} else {
+			b = _mm_aesenclast_si128(b, k);
+		}
+	}
+	_mm_storeu_si128((__m128i *)out, b);
+}
+
+AES_TARGET void rijndaelCtrX64(u8 *out, const u8 *in, size_t len,
+		const u32 rk[], int nr, u8 ctr[16], int inc32) {
+	__m128i k[MAXNR + 1], b[AES_WAYS];
+	uint64_t hi = load_be64(ctr), lo = load_be64(ctr + 8);
+	u8 t[16];
+
+	aes_keys(k, rk, nr);
+
+	for (; len >= 16 * AES_WAYS; len -= 16 * AES_WAYS) {
+		for (int j = 0; j < AES_WAYS; j++) {
+			b[j] = _mm_xor_si128(ctr_next(&hi, &lo, inc32), k[0]);
+		}
+		for (int i = 1; i < nr; i++) {
+			for (int j = 0; j < AES_WAYS; j++) {
+				b[j] = _mm_aesenc_si128(b[j], k[i]);
+			}
+		}
+		for (int j = 0; j < AES_WAYS; j++) {
+			b[j] = _mm_aesenclast_si128(b[j], k[nr]);
+			b[j] = _mm_xor_si128(b[j], _mm_loadu_si128((const __m128i *)in));
+			_mm_storeu_si128((__m128i *)out, b[j]);
+			in += 16;
+			out += 16;
+		}
+	}
+	for (; len >= 16; len -= 16) {
+		b[0] = aes_enc(ctr_next(&hi, &lo, inc32), k, nr);
+		b[0] = _mm_xor_si128(b[0], _mm_loadu_si128((const __m128i *)in));
+		_mm_storeu_si128((__m128i *)out, b[0]);
+		in += 16;
+		out += 16;
+	}
+	if (len > 0) {
+		_mm_storeu_si128((__m128i *)t, aes_enc(ctr_next(&hi, &lo, inc32), k,
+				nr));
+		for (size_t i = 0; i < len; i++) {
+			out[i] = in[i] ^ t[i];
+		}
+	}
+
+	store_be64(ctr, hi);
+	store_be64(ctr + 8, lo);
+}
+
+AES_TARGET void rijndaelCbcEncX64(u8 *out, const u8 *in, size_t blocks,
+		const u32 rk[], int nr, u8 iv[16]) {
+	__m128i k[MAXNR + 1], c = _mm_loadu_si128((const __m128i *)iv);
+
+	aes_keys(k, rk, nr);
+
+	for (; blocks > 0; blocks--) {
+		c = _mm_xor_si128(c, _mm_loadu_si128((const __m128i *)in));
+		c = aes_enc(c, k, nr);
+		_mm_storeu_si128((__m128i *)out, c);
+		in += 16;
+		out += 16;
+	}
+	_mm_storeu_si128((__m128i *)iv, c);
+}
+
+AES_TARGET void rijndaelCbcDecX64(u8 *out, const u8 *in, size_t blocks,
+		const u32 rk[], int nr, u8 iv[16]) {
+	__m128i t, d[MAXNR + 1], b[AES_WAYS], c[AES_WAYS];
+	__m128i v = _mm_loadu_si128((const __m128i *)iv);
+
+	aes_keys(d, rk, nr);
+	/* Use the equivalent inverse cipher, which needs InvMixColumns keys. */
+	for (int i = 0; i < nr - i; i++) {
+		t = d[i];
+		d[i] = d[nr - i];
+		d[nr - i] = t;
+	}
+	for (int i = 1; i < nr; i++) {
+		d[i] = _mm_aesimc_si128(d[i]);
+	}
+
+	for (; blocks >= AES_WAYS; blocks -= AES_WAYS) {
+		for (int j = 0; j < AES_WAYS; j++) {
+			c[j] = _mm_loadu_si128((const __m128i *)in + j);
+			b[j] = _mm_xor_si128(c[j], d[0]);
+		}
+		for (int i = 1; i < nr; i++) {
+			for (int j = 0; j < AES_WAYS; j++) {
+				b[j] = _mm_aesdec_si128(b[j], d[i]);
+			}
+		}
+		for (int j = 0; j < AES_WAYS; j++) {
+			b[j] = _mm_aesdeclast_si128(b[j], d[nr]);
+			_mm_storeu_si128((__m128i *)out + j, _mm_xor_si128(b[j], v));
+			v = c[j];
+		}
+		in += 16 * AES_WAYS;
+		out += 16 * AES_WAYS;
+	}
+	for (; blocks > 0; blocks--) {
+		c[0] = _mm_loadu_si128((const __m128i *)in);
+		b[0] = _mm_xor_si128(c[0], d[0]);
+		for (int i = 1; i < nr; i++) {
+			b[0] = _mm_aesdec_si128(b[0], d[i]);
+		}
+		b[0] = _mm_aesdeclast_si128(b[0], d[nr]);
+		_mm_storeu_si128((__m128i *)out, _mm_xor_si128(b[0], v));
+		v = c[0];
+		in += 16;
+		out += 16;
+	}
+	_mm_storeu_si128((__m128i *)iv, v);
+}
+
+AES_TARGET void ghashX64(u8 y[16], const u8 h[16], const u8 *in,
+		size_t len) {
+	const __m128i bswap = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+			12, 13, 14, 15);
+	__m128i h1, h2, h3, h4, a, x[4];
+	u8 t[16];
+
+	h1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)h), bswap);
+	a = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)y), bswap);
+
+	if (len >= 64) {
+		/* Multiply four blocks by H^4, ..., H independently and add. */
+		h2 = gf_mul(h1, h1);
+		h3 = gf_mul(h2, h1);
+		h4 = gf_mul(h3, h1);
+		for (; len >= 64; len -= 64) {
+			for (int j = 0; j < 4; j++) {
+				x[j] = _mm_loadu_si128((const __m128i *)in + j);
+				x[j] = _mm_shuffle_epi8(x[j], bswap);
+			}
+			x[0] = gf_mul(_mm_xor_si128(a, x[0]), h4);
+			x[1] = gf_mul(x[1], h3);
+			x[2] = gf_mul(x[2], h2);
+			x[3] = gf_mul(x[3], h1);
+			a = _mm_xor_si128(_mm_xor_si128(x[0], x[1]),
+					_mm_xor_si128(x[2], x[3]));
+			in += 64;
+		}
+	}
+	for (; len > 0; len -= (len < 16 ? len : 16)) {
+		if (len >= 16) {
+			x[0] = _mm_loadu_si128((const __m128i *)in);
+		} else {
+			memset(t, 0, sizeof(t));
+			memcpy(t, in, len);
+			x[0] = _mm_loadu_si128((const __m128i *)t);
+		}
+		x[0] = _mm_shuffle_epi8(x[0], bswap);
+		a = gf_mul(_mm_xor_si128(a, x[0]), h1);
+		in += 16;
+	}
+
+	_mm_storeu_si128((__m128i *)y, _mm_shuffle_epi8(a, bswap));
+}
+
+#endif
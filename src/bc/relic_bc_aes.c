@@ -33,9 +33,188 @@
 
 #include "relic_core.h"
 #include "relic_err.h"
+#include "relic_arch.h"
 #include "relic_bc.h"
 #include "rijndael-api-fst.h"
 
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Flag to compile the kernels based on the AES new instructions.
+ */
+#if ARCH == X64 && (defined(__GNUC__) || defined(__clang__))
+#define AES_X64
+#endif
+
+/**
+ * Expands a key for AES encryption.
+ *
+ * @param[out] rk			- the expanded key.
+ * @param[in] key			- the key.
+ * @param[in] key_len		- the key size in bytes.
+ * @return the number of rounds, or zero if the key size is invalid.
+ */
+static int aes_setup(u32 rk[4 * (MAXNR + 1)], const uint8_t *key,
+		int key_len) {
+	if (key_len != 16 && key_len != 24 && key_len != 32) {
+		return 0;
+	}
+#ifdef AES_X64
+	if (arch_cpu_has(RLC_ARCH_AES)) {
+		return rijndaelKeySetupX64(rk, key, 8 * key_len);
+	}
+#endif
+	return rijndaelKeySetupEnc(rk, key, 8 * key_len);
+}
+
+/**
+ * Encrypts a block with AES.
+ *
+ * @param[out] out			- the encrypted block.
+ * @param[in] in			- the block to encrypt.
+ * @param[in] rk			- the expanded key.
+ * @param[in] nr			- the number of rounds.
+ */
+static void aes_enc(uint8_t out[RLC_BC_LEN], const uint8_t in[RLC_BC_LEN],
+		const u32 rk[], int nr) {
+#ifdef AES_X64
+	if (arch_cpu_has(RLC_ARCH_AES)) {
+		rijndaelEncX64(rk, nr, in, out);
+		return;
+	}
+#endif
+	rijndaelEncrypt(rk, nr, in, out);
+}
+
+/**
+ * Encrypts or decrypts with AES in counter mode.
+ *
+ * @param[out] out			- the resulting bytes.
+ * @param[in] in			- the bytes to process.
+ * @param[in] len			- the number of bytes to process.
+ * @param[in] rk			- the expanded key.
+ * @param[in] nr			- the number of rounds.
+ * @param[in,out] ctr		- the counter block.
+ * @param[in] inc32			- the flag to increment only the last 32 bits.
+ */
+static void aes_ctr(uint8_t *out, const uint8_t *in, int len, const u32 rk[],
+		int nr, uint8_t ctr[RLC_BC_LEN], int inc32) {
+	uint8_t t[RLC_BC_LEN];
+
+#ifdef AES_X64
+	if (arch_cpu_has(RLC_ARCH_AES)) {
+		rijndaelCtrX64(out, in, len, rk, nr, ctr, inc32);
+		return;
+	}
+#endif
+
+	for (int i = 0; i < len; i += RLC_BC_LEN) {
+		rijndaelEncrypt(rk, nr, ctr, t);
+		for (int j = 0; j < RLC_MIN(RLC_BC_LEN, len - i); j++) {
+			out[i + j] = in[i + j] ^ t[j];
+		}
+		/* Increment the counter as a big-endian integer. */
+		for (int j = RLC_BC_LEN - 1, c = 1; j >= (inc32 ? 12 : 0); j--) {
+			c += ctr[j];
+			ctr[j] = (uint8_t)c;
+			c >>= 8;
+		}
+	}
+}
+
+/**
+ * Multiplies two elements of GF(2^128) in the representation used by GHASH.
+ * The multiplication runs in constant time.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the first element.
+ * @param[in] b				- the second element.
+ */
+static void gf_mul(uint8_t c[RLC_BC_LEN], const uint8_t a[RLC_BC_LEN],
+		const uint8_t b[RLC_BC_LEN]) {
+	uint64_t zh = 0, zl = 0, vh = 0, vl = 0, mask;
+
+	for (int i = 0; i < 8; i++) {
+		vh = (vh << 8) | b[i];
+		vl = (vl << 8) | b[i + 8];
+	}
+	for (int i = 0; i < 128; i++) {
+		mask = -(uint64_t)((a[i >> 3] >> (7 - (i & 7))) & 1);
+		zh ^= vh & mask;
+		zl ^= vl & mask;
+		mask = -(vl & 1);
+		vl = (vl >> 1) | (vh << 63);
+		vh = (vh >> 1) ^ (0xE100000000000000ULL & mask);
+	}
+	for (int i = 7; i >= 0; i--) {
+		c[i] = (uint8_t)zh;
+		c[i + 8] = (uint8_t)zl;
+		zh >>= 8;
+		zl >>= 8;
+	}
+}
+
+/**
+ * Absorbs bytes into the GHASH function, padding the last block with zeros.
+ *
+ * @param[in,out] y			- the hash state.
+ * @param[in] h				- the hash key.
+ * @param[in] in			- the bytes to hash.
+ * @param[in] len			- the number of bytes to hash.
+ */
+static void ghash(uint8_t y[RLC_BC_LEN], const uint8_t h[RLC_BC_LEN],
+		const uint8_t *in, int len) {
+#ifdef AES_X64
+	if (arch_cpu_has(RLC_ARCH_AES)) {
+		ghashX64(y, h, in, len);
+		return;
+	}
+#endif
+
+	for (int i = 0; i < len; i += RLC_BC_LEN) {
+		for (int j = 0; j < RLC_MIN(RLC_BC_LEN, len - i); j++) {
+			y[j] ^= in[i + j];
+		}
+		gf_mul(y, y, h);
+	}
+}
+
+/**
+ * Computes the authentication tag of GCM.
+ *
+ * @param[out] tag			- the tag.
+ * @param[in] rk			- the expanded key.
+ * @param[in] nr			- the number of rounds.
+ * @param[in] j0			- the pre-counter block.
+ * @param[in] ad			- the associated data.
+ * @param[in] ad_len		- the number of bytes of associated data.
+ * @param[in] c				- the ciphertext.
+ * @param[in] c_len			- the number of bytes of ciphertext.
+ */
+static void gcm_tag(uint8_t tag[RLC_BC_LEN], const u32 rk[], int nr,
+		const uint8_t j0[RLC_BC_LEN], const uint8_t *ad, int ad_len,
+		const uint8_t *c, int c_len) {
+	uint8_t h[RLC_BC_LEN] = { 0 }, y[RLC_BC_LEN] = { 0 }, l[RLC_BC_LEN];
+	uint64_t ad_bits = 8 * (uint64_t)ad_len, c_bits = 8 * (uint64_t)c_len;
+
+	aes_enc(h, h, rk, nr);
+	for (int i = 7; i >= 0; i--) {
+		l[i] = (uint8_t)ad_bits;
+		l[i + 8] = (uint8_t)c_bits;
+		ad_bits >>= 8;
+		c_bits >>= 8;
+	}
+	ghash(y, h, ad, ad_len);
+	ghash(y, h, c, c_len);
+	ghash(y, h, l, RLC_BC_LEN);
+	aes_enc(tag, j0, rk, nr);
+	for (int i = 0; i < RLC_BC_LEN; i++) {
+		tag[i] ^= y[i];
+	}
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -49,6 +228,25 @@ int bc_aes_cbc_enc(uint8_t *out, int *out_len, uint8_t *in,
 	if (*out_len < in_len + pad_len) {
 		return RLC_ERR;
 	}
+#ifdef AES_X64
+	if (arch_cpu_has(RLC_ARCH_AES)) {
+		uint8_t v[RLC_BC_LEN], t[RLC_BC_LEN];
+		u32 rk[4 * (MAXNR + 1)];
+		int nr = aes_setup(rk, key, key_len), blocks = in_len / RLC_BC_LEN;
+
+		if (nr == 0 || in_len <= 0) {
+			return RLC_ERR;
+		}
+		memcpy(v, iv, RLC_BC_LEN);
+		rijndaelCbcEncX64(out, in, blocks, rk, nr, v);
+		/* Pad the last block with the number of padding bytes. */
+		memcpy(t, in + RLC_BC_LEN * blocks, RLC_BC_LEN - pad_len);
+		memset(t + RLC_BC_LEN - pad_len, pad_len, pad_len);
+		rijndaelCbcEncX64(out + RLC_BC_LEN * blocks, t, 1, rk, nr, v);
+		*out_len = in_len + pad_len;
+		return RLC_OK;
+	}
+#endif
 	if (makeKey2(&key_inst, DIR_ENCRYPT, 8 * key_len, (char *)key) != TRUE) {
 		return RLC_ERR;
 	}
@@ -68,10 +266,37 @@ int bc_aes_cbc_dec(uint8_t *out, int *out_len, uint8_t *in,
 	keyInstance key_inst;
 	cipherInstance cipher_inst;
 
-	if (*out_len < in_len) {
+	if (*out_len < in_len || in_len <= 0) {
 		return RLC_ERR;
 	}
 
+#ifdef AES_X64
+	if (arch_cpu_has(RLC_ARCH_AES)) {
+		uint8_t v[RLC_BC_LEN], t[RLC_BC_LEN];
+		u32 rk[4 * (MAXNR + 1)];
+		int nr = aes_setup(rk, key, key_len), blocks = in_len / RLC_BC_LEN;
+		int pad_len, bad = 0;
+
+		if (nr == 0 || in_len <= 0 || in_len % RLC_BC_LEN != 0) {
+			return RLC_ERR;
+		}
+		memcpy(v, iv, RLC_BC_LEN);
+		rijndaelCbcDecX64(out, in, blocks - 1, rk, nr, v);
+		rijndaelCbcDecX64(t, in + RLC_BC_LEN * (blocks - 1), 1, rk, nr, v);
+		/* Check the padding without branching on its contents. */
+		pad_len = t[RLC_BC_LEN - 1];
+		bad = (pad_len == 0) | (pad_len > RLC_BC_LEN);
+		for (int i = 0; i < RLC_BC_LEN; i++) {
+			bad |= (i >= RLC_BC_LEN - pad_len) & (t[i] != pad_len);
+		}
+		if (bad) {
+			return RLC_ERR;
+		}
+		memcpy(out + RLC_BC_LEN * (blocks - 1), t, RLC_BC_LEN - pad_len);
+		*out_len = in_len - pad_len;
+		return RLC_OK;
+	}
+#endif
 	if (makeKey2(&key_inst, DIR_DECRYPT, 8 * key_len, (char *)key) != TRUE) {
 		return RLC_ERR;
 	}
@@ -79,9 +304,89 @@ int bc_aes_cbc_dec(uint8_t *out, int *out_len, uint8_t *in,
 		return RLC_ERR;
 	}
 	memcpy(cipher_inst.IV, iv, RLC_BC_LEN);
+	/* A block of padding alone is a valid encryption of an empty message. */
 	*out_len = padDecrypt(&cipher_inst, &key_inst, in, in_len, out);
-	if (*out_len <= 0) {
+	if (*out_len < 0) {
+		return RLC_ERR;
+	}
+	return RLC_OK;
+}
+
+int bc_aes_ctr_enc(uint8_t *out, int *out_len, const uint8_t *in, int in_len,
+		const uint8_t *key, int key_len, const uint8_t *iv) {
+	u32 rk[4 * (MAXNR + 1)];
+	uint8_t ctr[RLC_BC_LEN];
+	int nr;
+
+	if (*out_len < in_len || in_len < 0) {
+		return RLC_ERR;
+	}
+	nr = aes_setup(rk, key, key_len);
+	if (nr == 0) {
+		return RLC_ERR;
+	}
+	memcpy(ctr, iv, RLC_BC_LEN);
+	aes_ctr(out, in, in_len, rk, nr, ctr, 0);
+	*out_len = in_len;
+	return RLC_OK;
+}
+
+int bc_aes_ctr_dec(uint8_t *out, int *out_len, const uint8_t *in, int in_len,
+		const uint8_t *key, int key_len, const uint8_t *iv) {
+	return bc_aes_ctr_enc(out, out_len, in, in_len, key, key_len, iv);
+}
+
+int bc_aes_gcm_enc(uint8_t *out, int *out_len, const uint8_t *in, int in_len,
+		const uint8_t *key, int key_len, const uint8_t *iv,
+		const uint8_t *ad, int ad_len) {
+	u32 rk[4 * (MAXNR + 1)];
+	uint8_t j0[RLC_BC_LEN] = { 0 }, ctr[RLC_BC_LEN];
+	int nr;
+
+	if (in_len < 0 || ad_len < 0 || *out_len < in_len + RLC_BC_GCM_TAG) {
+		return RLC_ERR;
+	}
+	nr = aes_setup(rk, key, key_len);
+	if (nr == 0) {
+		return RLC_ERR;
+	}
+
+	/* The pre-counter block is the nonce followed by a 32-bit one. */
+	memcpy(j0, iv, RLC_BC_GCM_IV);
+	j0[RLC_BC_LEN - 1] = 1;
+	memcpy(ctr, j0, RLC_BC_LEN);
+	ctr[RLC_BC_LEN - 1] = 2;
+	aes_ctr(out, in, in_len, rk, nr, ctr, 1);
+	gcm_tag(out + in_len, rk, nr, j0, ad, ad_len, out, in_len);
+	*out_len = in_len + RLC_BC_GCM_TAG;
+	return RLC_OK;
+}
+
+int bc_aes_gcm_dec(uint8_t *out, int *out_len, const uint8_t *in, int in_len,
+		const uint8_t *key, int key_len, const uint8_t *iv,
+		const uint8_t *ad, int ad_len) {
+	u32 rk[4 * (MAXNR + 1)];
+	uint8_t j0[RLC_BC_LEN] = { 0 }, ctr[RLC_BC_LEN], tag[RLC_BC_GCM_TAG];
+	int nr, len = in_len - RLC_BC_GCM_TAG;
+
+	if (len < 0 || ad_len < 0 || *out_len < len) {
+		return RLC_ERR;
+	}
+	nr = aes_setup(rk, key, key_len);
+	if (nr == 0) {
+		return RLC_ERR;
+	}
+
+	memcpy(j0, iv, RLC_BC_GCM_IV);
+	j0[RLC_BC_LEN - 1] = 1;
+	/* Authenticate the ciphertext before releasing any plaintext. */
+	gcm_tag(tag, rk, nr, j0, ad, ad_len, in, len);
+	if (util_cmp_const(tag, in + len, RLC_BC_GCM_TAG) != RLC_EQ) {
 		return RLC_ERR;
 	}
+	memcpy(ctr, j0, RLC_BC_LEN);
+	ctr[RLC_BC_LEN - 1] = 2;
+	aes_ctr(out, in, len, rk, nr, ctr, 1);
+	*out_len = len;
 	return RLC_OK;
 }
@@ -39,6 +39,17 @@ int rijndaelKeySetupDec(u32 rk[/*4*(Nr + 1)*/], const u8 cipherKey[], int keyBit
 void rijndaelEncrypt(const u32 rk[/*4*(Nr + 1)*/], int Nr, const u8 pt[16], u8 ct[16]);
 void rijndaelDecrypt(const u32 rk[/*4*(Nr + 1)*/], int Nr, const u8 ct[16], u8 pt[16]);
 
+/* AES and GHASH kernels for x86-64 processors, see aes-x64.c */
+int rijndaelKeySetupX64(u32 rk[], const u8 *key, int bits);
+void rijndaelEncX64(const u32 rk[], int Nr, const u8 in[16], u8 out[16]);
+void rijndaelCtrX64(u8 *out, const u8 *in, size_t len, const u32 rk[], int Nr,
+		u8 ctr[16], int inc32);
+void rijndaelCbcEncX64(u8 *out, const u8 *in, size_t blocks, const u32 rk[],
+		int Nr, u8 iv[16]);
+void rijndaelCbcDecX64(u8 *out, const u8 *in, size_t blocks, const u32 rk[],
+		int Nr, u8 iv[16]);
+void ghashX64(u8 y[16], const u8 h[16], const u8 *in, size_t len);
+
 #ifdef INTERMEDIATE_VALUE_KAT
 void rijndaelEncryptRound(const u32 rk[/*4*(Nr + 1)*/], int Nr, u8 block[16], int rounds);
 void rijndaelDecryptRound(const u32 rk[/*4*(Nr + 1)*/], int Nr, u8 block[16], int rounds);
@@ -29,8 +29,106 @@
  * @ingroup cp
  */
 
+#include <stdlib.h>
+#include <string.h>
+
 #include "relic.h"
 
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Length in bits of the random exponents used in batch verification.
+ */
+#define BLS_BATCH_BITS		64
+
+/**
+ * Compares two message digests, so that they can be sorted.
+ *
+ * @param[in] a				- the first digest.
+ * @param[in] b				- the second digest.
+ * @return a negative, zero or positive value, as memcmp().
+ */
+static int bls_cmp(const void *a, const void *b) {
+	return memcmp(a, b, RLC_MD_LEN);
+}
+
+/**
+ * Verifies a batch of BLS signatures by checking a random linear combination
+ * of the verification equations with a single product of pairings. If the
+ * check fails, the batch is bisected to locate the invalid signatures.
+ *
+ * @param[out] ok			- the flags indicating valid signatures, or NULL.
+ * @param[in] s				- the signatures.
+ * @param[in] h				- the hashed messages, multiplied by the exponents.
+ * @param[in] q				- the public keys.
+ * @param[in] r				- the random exponents.
+ * @param[in] n				- the number of signatures.
+ * @return a boolean value indicating if all signatures are valid.
+ */
+static int bls_ver_batch(int ok[], g1_t s[], g1_t h[], g2_t q[], bn_t r[],
+		int n) {
+	g1_t *p = RLC_ALLOCA(g1_t, n + 1);
+	g2_t *t = RLC_ALLOCA(g2_t, n + 1);
+	gt_t e;
+	int i, result = 0;
+
+	gt_null(e);
+
+	RLC_TRY {
+		if (p == NULL || t == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		gt_new(e);
+		for (i = 0; i <= n; i++) {
+			g1_null(p[i]);
+			g2_null(t[i]);
+			g1_new(p[i]);
+			g2_new(t[i]);
+		}
+
+		/* Check e(\sum r_i * s_i, -g) * \prod e(r_i * H(m_i), q_i) = 1. */
+		for (i = 0; i < n; i++) {
+			g1_copy(p[i], h[i]);
+			g2_copy(t[i], q[i]);
+		}
+		g1_mul_sim_lot(p[n], (const g1_t *)s, (const bn_t *)r, n);
+		g2_get_gen(t[n]);
+		g2_neg(t[n], t[n]);
+
+		pc_map_sim(e, p, t, n + 1);
+		if (gt_is_unity(e)) {
+			result = 1;
+			for (i = 0; ok != NULL && i < n; i++) {
+				ok[i] = 1;
+			}
+		} else if (ok != NULL) {
+			if (n == 1) {
+				ok[0] = 0;
+			} else {
+				i = n / 2;
+				result = bls_ver_batch(ok, s, h, q, r, i);
+				result &= bls_ver_batch(ok + i, s + i, h + i, q + i, r + i,
+						n - i);
+			}
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		gt_free(e);
+		for (i = 0; p != NULL && t != NULL && i <= n; i++) {
+			g1_free(p[i]);
+			g2_free(t[i]);
+		}
+		RLC_FREE(p);
+		RLC_FREE(t);
+	}
+	return result;
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -119,3 +217,170 @@ int cp_bls_ver(g1_t s, uint8_t *msg, int len, g2_t q) {
 	}
 	return result;
 }
+
+int cp_bls_ver_batch(int ok[], g1_t s[], uint8_t *msgs[], int lens[],
+		g2_t q[], int n) {
+	g1_t *h = RLC_ALLOCA(g1_t, n);
+	bn_t *r = RLC_ALLOCA(bn_t, n);
+	int *v = RLC_ALLOCA(int, n);
+	int i, result = 0;
+
+	if (n <= 0) {
+		RLC_FREE(h);
+		RLC_FREE(r);
+		RLC_FREE(v);
+		return 1;
+	}
+
+	RLC_TRY {
+		if (h == NULL || r == NULL || v == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < n; i++) {
+			g1_null(h[i]);
+			bn_null(r[i]);
+			g1_new(h[i]);
+			bn_new(r[i]);
+		}
+
+		for (i = 0; i < n; i++) {
+			/* Signatures and keys outside the groups are rejected and left out
+			 * of the product of pairings with a zero exponent. */
+			v[i] = g1_is_valid(s[i]) && g2_is_valid(q[i]);
+			if (!v[i]) {
+				bn_zero(r[i]);
+				g1_set_infty(h[i]);
+				continue;
+			}
+			/* Choose nonzero exponents, so a single signature is still checked. */
+			do {
+				bn_rand(r[i], RLC_POS, BLS_BATCH_BITS);
+			} while (bn_is_zero(r[i]));
+			g1_map(h[i], msgs[i], lens[i]);
+			g1_mul(h[i], h[i], r[i]);
+		}
+
+		result = bls_ver_batch(ok, s, h, q, r, n);
+		for (i = 0; i < n; i++) {
+			if (!v[i]) {
+				result = 0;
+				if (ok != NULL) {
+					ok[i] = 0;
+				}
+			}
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		for (i = 0; h != NULL && r != NULL && i < n; i++) {
+			g1_free(h[i]);
+			bn_free(r[i]);
+		}
+		RLC_FREE(h);
+		RLC_FREE(r);
+		RLC_FREE(v);
+	}
+	return result;
+}
+
+int cp_bls_agg_sig(g1_t a, g1_t s[], int n) {
+	int result = RLC_OK;
+
+	RLC_TRY {
+		g1_add_sim(a, (const g1_t *)s, n);
+	}
+	RLC_CATCH_ANY {
+		result = RLC_ERR;
+	}
+	return result;
+}
+
+int cp_bls_agg_ver(g1_t a, uint8_t *msgs[], int lens[], g2_t q[], int n) {
+	g1_t *p = RLC_ALLOCA(g1_t, n + 1);
+	g2_t *t = RLC_ALLOCA(g2_t, n + 1);
+	uint8_t *h = RLC_ALLOCA(uint8_t, (n > 0 ? n : 1) * RLC_MD_LEN);
+	gt_t e;
+	int i, result = 0;
+
+	gt_null(e);
+
+	RLC_TRY {
+		if (p == NULL || t == NULL || h == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		gt_new(e);
+		for (i = 0; i <= n; i++) {
+			g1_null(p[i]);
+			g2_null(t[i]);
+			g1_new(p[i]);
+			g2_new(t[i]);
+		}
+
+		/* Messages must be distinct to prevent rogue key attacks, so sort
+		 * their digests and look for repeated neighbors. */
+		result = (n > 0);
+		for (i = 0; i < n; i++) {
+			md_map(h + i * RLC_MD_LEN, msgs[i], lens[i]);
+		}
+		qsort(h, n, RLC_MD_LEN, bls_cmp);
+		for (i = 1; i < n && result; i++) {
+			if (bls_cmp(h + (i - 1) * RLC_MD_LEN, h + i * RLC_MD_LEN) == 0) {
+				result = 0;
+			}
+		}
+
+		if (result) {
+			for (i = 0; i < n; i++) {
+				g1_map(p[i], msgs[i], lens[i]);
+				g2_copy(t[i], q[i]);
+			}
+			g1_copy(p[n], a);
+			g2_get_gen(t[n]);
+			g2_neg(t[n], t[n]);
+
+			pc_map_sim(e, p, t, n + 1);
+			result = gt_is_unity(e);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		gt_free(e);
+		for (i = 0; p != NULL && t != NULL && i <= n; i++) {
+			g1_free(p[i]);
+			g2_free(t[i]);
+		}
+		RLC_FREE(p);
+		RLC_FREE(t);
+		RLC_FREE(h);
+	}
+	return result;
+}
+
+int cp_bls_fast_agg_ver(g1_t a, uint8_t *msg, int len, g2_t q[], int n) {
+	g2_t t;
+	int result = 0;
+
+	g2_null(t);
+
+	if (n <= 0) {
+		return 0;
+	}
+
+	RLC_TRY {
+		g2_new(t);
+
+		g2_add_sim(t, q, n);
+		result = cp_bls_ver(a, msg, len, t);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		g2_free(t);
+	}
+	return result;
+}
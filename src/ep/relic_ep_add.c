@@ -701,6 +701,96 @@ static void ep_add_jacob_imp(ep_t r, const ep_t p, const ep_t q) {
 
 #endif /* EP_ADD == JACOB */
 
+/**
+ * Adds points in affine coordinates with an addition tree. Each level of the
+ * tree adds pairs of points with a single simultaneous inversion.
+ *
+ * @param[out] r			- the result.
+ * @param[in,out] t			- the points to add, destroyed on output.
+ * @param[in] d				- the temporary storage for the inversions.
+ * @param[in] f				- the temporary storage for the special cases.
+ * @param[in] m				- the number of points to add.
+ */
+static void ep_add_sim_imp(ep_t r, ep_t *t, fp_t *d, int *f, int m) {
+	int i, h;
+	fp_t u, v;
+
+	fp_null(u);
+	fp_null(v);
+
+	RLC_TRY {
+		fp_new(u);
+		fp_new(v);
+
+		while (m > 1) {
+			h = m / 2;
+			for (i = 0; i < h; i++) {
+				f[i] = 0;
+				fp_sub(d[i], t[2 * i + 1]->x, t[2 * i]->x);
+				if (fp_is_zero(d[i])) {
+					/* Handle doublings and inverses out of the batch. */
+					f[i] = 1;
+					fp_set_dig(d[i], 1);
+					if (fp_cmp(t[2 * i]->y, t[2 * i + 1]->y) == RLC_EQ) {
+						ep_dbl(t[2 * i], t[2 * i]);
+						ep_norm(t[2 * i], t[2 * i]);
+					} else {
+						ep_set_infty(t[2 * i]);
+					}
+				}
+			}
+
+			fp_inv_sim(d, (const fp_t *)d, h);
+
+			for (i = 0; i < h; i++) {
+				if (f[i]) {
+					ep_copy(t[i], t[2 * i]);
+					continue;
+				}
+				/* u = lambda = (y2 - y1)/(x2 - x1). */
+				fp_sub(u, t[2 * i + 1]->y, t[2 * i]->y);
+				fp_mul(u, u, d[i]);
+				/* x3 = lambda^2 - x1 - x2. */
+				fp_sqr(v, u);
+				fp_sub(v, v, t[2 * i]->x);
+				fp_sub(v, v, t[2 * i + 1]->x);
+				/* y3 = lambda * (x1 - x3) - y1. */
+				fp_sub(t[i]->x, t[2 * i]->x, v);
+				fp_mul(t[i]->x, t[i]->x, u);
+				fp_sub(t[i]->y, t[i]->x, t[2 * i]->y);
+				fp_copy(t[i]->x, v);
+				fp_set_dig(t[i]->z, 1);
+				t[i]->coord = BASIC;
+			}
+			if (m % 2 == 1) {
+				ep_copy(t[h], t[m - 1]);
+				h++;
+			}
+
+			/* Remove points at infinity before the next level. */
+			m = 0;
+			for (i = 0; i < h; i++) {
+				if (!ep_is_infty(t[i])) {
+					ep_copy(t[m++], t[i]);
+				}
+			}
+		}
+
+		if (m == 0) {
+			ep_set_infty(r);
+		} else {
+			ep_copy(r, t[0]);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		fp_free(u);
+		fp_free(v);
+	}
+}
+
 /*============================================================================*/
 	/* Public definitions                                                         */
 /*============================================================================*/
@@ -795,3 +885,60 @@ void ep_sub(ep_t r, const ep_t p, const ep_t q) {
 		ep_free(t);
 	}
 }
+
+void ep_add_sim(ep_t r, const ep_t p[], int n) {
+	const int c = RLC_MAX(1, RLC_MIN(n, RLC_EP_ADD_SIM));
+	int i, j, m, norm, *f = RLC_ALLOCA(int, c);
+	fp_t *d = RLC_ALLOCA(fp_t, c);
+	ep_t s, u, *t = RLC_ALLOCA(ep_t, c);
+
+	ep_null(s);
+	ep_null(u);
+
+	RLC_TRY {
+		if (f == NULL || d == NULL || t == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		ep_new(s);
+		ep_new(u);
+		for (i = 0; i < c; i++) {
+			fp_null(d[i]);
+			ep_null(t[i]);
+			fp_new(d[i]);
+			ep_new(t[i]);
+		}
+
+		/* Add chunks of points with a tree to bound the temporary storage. */
+		ep_set_infty(s);
+		for (i = 0; i < n; i += c) {
+			m = norm = 0;
+			for (j = i; j < RLC_MIN(n, i + c); j++) {
+				if (!ep_is_infty(p[j])) {
+					ep_copy(t[m], p[j]);
+					norm |= (t[m]->coord != BASIC);
+					m++;
+				}
+			}
+			if (norm) {
+				ep_norm_sim(t, (const ep_t *)t, m);
+			}
+			ep_add_sim_imp(u, t, d, f, m);
+			ep_add(s, s, u);
+		}
+		ep_norm(r, s);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		ep_free(s);
+		ep_free(u);
+		for (i = 0; d != NULL && t != NULL && i < c; i++) {
+			fp_free(d[i]);
+			ep_free(t[i]);
+		}
+		RLC_FREE(f);
+		RLC_FREE(d);
+		RLC_FREE(t);
+	}
+}
@@ -115,7 +115,13 @@ static void ep_curve_set_map(const fp_t u) {
 			fp_inv(c1, c1);     /* c1 = -1 / a */
 			fp_mul(c1, c1, c4); /* c1 = -b / a */
 
-			/* constant 2 is unused in this case */
+			/* constant 2: sqrt(-u), to compute square roots of ratios */
+			if (fp_prime_get_mod8() % 4 == 3) {
+				fp_neg(c2, ctx->ep_map_u);
+				if (!fp_srt(c2, c2)) {
+					RLC_THROW(ERR_NO_VALID);
+				}
+			}
 		} else {
 			/* SvdW map constants */
 			/* constant 1: g(u) = u^3 + a * u + b */
@@ -54,8 +54,71 @@ TMPL_MAP_HORNER(fp, fp_st)
  * Generic isogeny map evaluation for use with SSWU map.
  */
 TMPL_MAP_ISOGENY_MAP(ep, fp, iso)
+
+/**
+ * Addition on the isogenous curve, so that the isogeny is evaluated only once.
+ */
+TMPL_MAP_ISOGENY_ADD(ep, fp, dig_t)
 #endif /* EP_CTMAP */
 
+/**
+ * Computes the square root of u/v if it is a square, or the square root of
+ * Z * u/v otherwise, where Z is the non-square used by the mapping function.
+ * When p = 3 mod 4, the inversion and the square root are computed with a
+ * single exponentiation, as in RFC 9380, Appendix F.2.1.2.
+ *
+ * @param[out] c		- the result.
+ * @param[in] u			- the numerator.
+ * @param[in] v			- the denominator.
+ * @return 1 if u/v is a square, 0 otherwise.
+ */
+static int fp_srt_ratio(fp_t c, const fp_t u, const fp_t v) {
+	ctx_t *ctx = core_get();
+	fp_t t0, t1;
+	int r = 0;
+
+	fp_null(t0);
+	fp_null(t1);
+
+	RLC_TRY {
+		fp_new(t0);
+		fp_new(t1);
+
+		if (fp_prime_get_mod8() % 4 == 3) {
+			fp_sqr(t0, v);
+			fp_mul(t1, u, v);
+			fp_mul(t0, t0, t1);
+			fp_exp_chain(t0, t0, RLC_FP_EXP_ISR);
+			fp_mul(t0, t0, t1);		/* t0 = u * v * (u * v^3)^((p - 3)/4) */
+			fp_sqr(t1, t0);
+			fp_mul(t1, t1, v);
+			r = (fp_cmp(t1, u) == RLC_EQ);
+			/* Otherwise, t0^2 = -u/v and sqrt(Z * u/v) = t0 * sqrt(-Z). */
+			fp_mul(t1, t0, ctx->ep_map_c[1]);
+			dv_copy_cond(t0, t1, RLC_FP_DIGS, r == 0);
+			fp_copy(c, t0);
+		} else {
+			fp_inv(t0, v);
+			fp_mul(t0, t0, u);
+			/* Decide with the Legendre symbol to take a single square root. */
+			r = (fp_smb(t0) != -1);
+			fp_mul(t1, t0, ctx->ep_map_u);
+			dv_copy_cond(t0, t1, RLC_FP_DIGS, r == 0);
+			if (!fp_srt(c, t0)) {
+				RLC_THROW(ERR_NO_VALID);
+			}
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		fp_free(t0);
+		fp_free(t1);
+	}
+	return r;
+}
+
 /**
  * Simplified SWU mapping from Section 4 of
  * "Fast and simple constant-time hashing to the BLS12-381 Elliptic Curve"
@@ -76,80 +139,135 @@ static inline int fp_sgn0(const fp_t t, bn_t k) {
 	return bn_get_bit(k, 0);
 }
 
-/*============================================================================*/
-/* Public definitions                                                         */
-/*============================================================================*/
-
-void ep_map_dst(ep_t p, const uint8_t *msg, int len, const uint8_t *dst, int dst_len) {
+/**
+ * Maps two field elements read from a pseudorandom string to the curve and
+ * adds the results. If the curve uses an isogeny for hashing, the sum is left
+ * on the isogenous curve. The result may be in projective coordinates.
+ *
+ * @param[out] p			- the result.
+ * @param[in] buf			- the pseudorandom string.
+ * @param[in] len			- the number of bytes per field element.
+ */
+static void ep_map_sum(ep_t p, const uint8_t *buf, int len) {
 	bn_t k;
-	fp_t t;
+	fp_t t, x[2], d[2], y[2];
 	ep_t q;
 	int neg;
-	/* enough space for two field elements plus extra bytes for uniformity */
-	const int len_per_elm = (FP_PRIME + ep_param_level() + 7) / 8;
-	uint8_t *pseudo_random_bytes = RLC_ALLOCA(uint8_t, 2 * len_per_elm);
 
 	bn_null(k);
 	fp_null(t);
 	ep_null(q);
+	for (int j = 0; j < 2; j++) {
+		fp_null(x[j]);
+		fp_null(d[j]);
+		fp_null(y[j]);
+	}
 
 	RLC_TRY {
 		bn_new(k);
 		fp_new(t);
 		ep_new(q);
+		for (int j = 0; j < 2; j++) {
+			fp_new(x[j]);
+			fp_new(d[j]);
+			fp_new(y[j]);
+		}
 
 		/* figure out which hash function to use */
 		const int abNeq0 = (ep_curve_opt_a() != RLC_ZERO) && (ep_curve_opt_b() != RLC_ZERO);
 		void (*const map_fn)(ep_t, fp_t) = (ep_curve_is_ctmap() || abNeq0) ? ep_map_sswu : ep_map_svdw;
 
-		/* for hash_to_field, need to hash to a pseudorandom string */
-		/* XXX(rsw) the below assumes that we want to use MD_MAP for hashing.
-		 *          Consider making the hash function a per-curve option!
-		 */
-		md_xmd(pseudo_random_bytes, 2 * len_per_elm, msg, len, dst, dst_len);
-
 #define EP_MAP_CONVERT_BYTES(IDX)                                              \
 	do {                                                                       \
-		bn_read_bin(k, pseudo_random_bytes + IDX * len_per_elm, len_per_elm);  \
+		bn_read_bin(k, buf + IDX * len, len);                                  \
 		fp_prime_conv(t, k);                                                   \
 	} while (0)
 
+#define EP_MAP_FIX_SIGN(Y)                                                     \
+	do {                                                                       \
+		/* compare sign of y and sign of t; fix if necessary */                \
+		neg = neg != fp_sgn0(Y, k);                                            \
+		fp_neg(t, Y);                                                          \
+		dv_copy_cond(Y, t, RLC_FP_DIGS, neg);                                  \
+	} while (0)
+
 #define EP_MAP_APPLY_MAP(PT)                                                   \
 	do {                                                                       \
 		/* check sign of t */                                                  \
 		neg = fp_sgn0(t, k);                                                   \
 		/* convert */                                                          \
 		map_fn(PT, t);                                                         \
-		/* compare sign of y and sign of t; fix if necessary */                \
-		neg = neg != fp_sgn0(PT->y, k);                                        \
-		fp_neg(t, PT->y);                                                      \
-		dv_copy_cond(PT->y, t, RLC_FP_DIGS, neg);                              \
+		EP_MAP_FIX_SIGN(PT->y);                                                \
 	} while (0)
 
-		/* first map invocation */
-		EP_MAP_CONVERT_BYTES(0);
-		EP_MAP_APPLY_MAP(p);
-		TMPL_MAP_CALL_ISOMAP(ep, p);
+#ifdef EP_CTMAP
+		if (ep_curve_is_ctmap()) {
+			/* map to the isogenous curve with x-coordinates as fractions
+			 * and add there, so that the isogeny is evaluated only once. */
+			for (int j = 0; j < 2; j++) {
+				EP_MAP_CONVERT_BYTES(j);
+				neg = fp_sgn0(t, k);
+				ep_map_sswu_frac(x[j], d[j], y[j], t);
+				EP_MAP_FIX_SIGN(y[j]);
+			}
+			ep_iso_add(p, x[0], d[0], y[0], x[1], d[1], y[1]);
+		} else {
+#endif
+			/* first map invocation */
+			EP_MAP_CONVERT_BYTES(0);
+			EP_MAP_APPLY_MAP(p);
 
-		/* second map invocation */
-		EP_MAP_CONVERT_BYTES(1);
-		EP_MAP_APPLY_MAP(q);
-		TMPL_MAP_CALL_ISOMAP(ep, q);
+			/* second map invocation */
+			EP_MAP_CONVERT_BYTES(1);
+			EP_MAP_APPLY_MAP(q);
 
-		/* XXX(rsw) could add p and q and then apply isomap,
-		 * but need ep_add to support addition on isogeny curves */
+			/* sum the result */
+			ep_add(p, p, q);
+#ifdef EP_CTMAP
+		}
+#endif
 
 #undef EP_MAP_CONVERT_BYTES
+#undef EP_MAP_FIX_SIGN
 #undef EP_MAP_APPLY_MAP
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		bn_free(k);
+		fp_free(t);
+		ep_free(q);
+		for (int j = 0; j < 2; j++) {
+			fp_free(x[j]);
+			fp_free(d[j]);
+			fp_free(y[j]);
+		}
+	}
+}
+
+/**
+ * Clears the cofactor of a point obtained by hashing. The result may be in
+ * projective coordinates.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the point to multiply.
+ */
+static void ep_map_cof(ep_t r, const ep_t p) {
+	bn_t k;
+	ep_t t;
 
-		/* sum the result */
-		ep_add(p, p, q);
-		ep_norm(p, p);
+	bn_null(k);
+	ep_null(t);
+
+	RLC_TRY {
+		bn_new(k);
+		ep_new(t);
 
-		/* clear cofactor */
 		switch (ep_curve_is_pairf()) {
 			case EP_BN:
 				/* h = 1 */
+				ep_copy(r, p);
 				break;
 			case EP_B12:
 				/* multiply by 1-x (x the BLS parameter) to get the correct group. */
@@ -160,20 +278,29 @@ void ep_map_dst(ep_t p, const uint8_t *msg, int len, const uint8_t *dst, int dst
 				fp_prime_get_par(k);
 				bn_neg(k, k);
 				bn_add_dig(k, k, 1);
-				if (bn_bits(k) < RLC_DIG) {
-					ep_mul_dig(p, p, k->dp[0]);
-				} else {
-					ep_mul(p, p, k);
+				/* 1-x is short and sparse, so use the binary method and leave
+				 * the result in projective coordinates. */
+				ep_copy(t, p);
+				for (int i = bn_bits(k) - 2; i >= 0; i--) {
+					ep_dbl(t, t);
+					if (bn_get_bit(k, i)) {
+						ep_add(t, t, p);
+					}
 				}
+				if (bn_sign(k) == RLC_NEG) {
+					ep_neg(t, t);
+				}
+				ep_copy(r, t);
 				break;
 			default:
 				/* multiply by cofactor to get the correct group. */
 				ep_curve_get_cof(k);
 				if (bn_bits(k) < RLC_DIG) {
-					ep_mul_dig(p, p, k->dp[0]);
+					ep_mul_dig(r, p, k->dp[0]);
 				} else {
-					ep_mul_basic(p, p, k);
+					ep_mul_basic(r, p, k);
 				}
+				break;
 		}
 	}
 	RLC_CATCH_ANY {
@@ -181,8 +308,249 @@ void ep_map_dst(ep_t p, const uint8_t *msg, int len, const uint8_t *dst, int dst
 	}
 	RLC_FINALLY {
 		bn_free(k);
-		fp_free(t);
-		ep_free(q);
+		ep_free(t);
+	}
+}
+
+/**
+ * Converts many points to affine coordinates with a single inversion, taking
+ * care of points at infinity.
+ *
+ * @param[in,out] p			- the points to convert.
+ * @param[in] n				- the number of points.
+ */
+static void ep_map_norm_sim(ep_t *p, int n) {
+	int *inf = RLC_ALLOCA(int, n);
+
+	RLC_TRY {
+		if (inf == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (int i = 0; i < n; i++) {
+			inf[i] = ep_is_infty(p[i]);
+			if (inf[i]) {
+				fp_set_dig(p[i]->z, 1);
+				p[i]->coord = BASIC;
+			}
+		}
+		ep_norm_sim(p, (const ep_t *)p, n);
+		for (int i = 0; i < n; i++) {
+			if (inf[i]) {
+				ep_set_infty(p[i]);
+			}
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		RLC_FREE(inf);
+	}
+}
+
+/**
+ * Maps a pseudorandom string expanded from a message to a point in a prime
+ * elliptic curve, applying the isogeny and clearing the cofactor.
+ *
+ * @param[out] p			- the result.
+ * @param[in] buf			- the pseudorandom string.
+ * @param[in] len			- the number of bytes per field element.
+ */
+static void ep_map_bytes(ep_t p, const uint8_t *buf, int len) {
+	ep_map_sum(p, buf, len);
+	TMPL_MAP_CALL_ISOMAP(ep, p);
+	ep_map_cof(p, p);
+	ep_norm(p, p);
+}
+
+/**
+ * Maps many byte arrays to points in a prime elliptic curve, sharing the
+ * inversions needed before the isogeny and in the final normalization. The
+ * byte arrays are expanded eight at a time only when MD_MAP is SH256.
+ *
+ * @param[out] p			- the results.
+ * @param[in] msg			- the byte arrays to map.
+ * @param[in] len			- the array lengths in bytes.
+ * @param[in] n				- the number of byte arrays.
+ * @param[in] dst			- the domain separation tag.
+ * @param[in] dst_len		- the domain separation tag length in bytes.
+ */
+static void ep_map_dst_sim(ep_t *p, uint8_t *msg[], int len[], int n,
+		const uint8_t *dst, int dst_len) {
+	/* enough space for two field elements plus extra bytes for uniformity */
+	const int len_per_elm = (FP_PRIME + ep_param_level() + 7) / 8;
+	/* hash up to eight messages at once when the hash supports it */
+	uint8_t *pseudo_random_bytes = RLC_ALLOCA(uint8_t, 8 * 2 * len_per_elm);
+
+	RLC_TRY {
+		if (pseudo_random_bytes == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+
+#if MD_MAP == SH256
+		for (int i = 0; i < n; i += 8) {
+			const int m = RLC_MIN(8, n - i);
+			md_xmd_sh256_many(pseudo_random_bytes, 2 * len_per_elm,
+					(const uint8_t **)msg + i, len + i, m, dst, dst_len);
+			for (int j = 0; j < m; j++) {
+				ep_map_sum(p[i + j], pseudo_random_bytes + 2 * j * len_per_elm,
+						len_per_elm);
+			}
+		}
+#else
+		for (int i = 0; i < n; i++) {
+			md_xmd(pseudo_random_bytes, 2 * len_per_elm, msg[i], len[i], dst,
+					dst_len);
+			ep_map_sum(p[i], pseudo_random_bytes, len_per_elm);
+		}
+#endif
+#ifdef EP_CTMAP
+		if (ep_curve_is_ctmap()) {
+			ep_map_norm_sim(p, n);
+			for (int i = 0; i < n; i++) {
+				TMPL_MAP_CALL_ISOMAP(ep, p[i]);
+			}
+		}
+#endif
+		for (int i = 0; i < n; i++) {
+			ep_map_cof(p[i], p[i]);
+		}
+		ep_map_norm_sim(p, n);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		RLC_FREE(pseudo_random_bytes);
+	}
+}
+
+#if MULTI == PTHREAD || MULTI == OPENMP
+
+/**
+ * Arguments of a batch of hashes split among threads.
+ */
+typedef struct {
+	/** The results. */
+	ep_t *p;
+	/** The byte arrays to map. */
+	uint8_t **msg;
+	/** The array lengths in bytes. */
+	int *len;
+	/** The number of byte arrays. */
+	int n;
+	/** The domain separation tag. */
+	const uint8_t *dst;
+	/** The domain separation tag length in bytes. */
+	int dst_len;
+} ep_map_t;
+
+/**
+ * Computes a share of a batch of hashes.
+ *
+ * @param[in,out] args		- the batch of hashes.
+ * @param[in] i				- the index of the share.
+ * @param[in] c				- the number of shares.
+ */
+static void ep_map_dst_job(void *args, int i, int c) {
+	ep_map_t *job = (ep_map_t *)args;
+	int m = RLC_CEIL(job->n, c), j = RLC_MIN(i * m, job->n);
+
+	m = RLC_MIN(m, job->n - j);
+	if (m > 0) {
+		ep_map_dst_sim(job->p + j, job->msg + j, job->len + j, m, job->dst,
+				job->dst_len);
+	}
+}
+
+#endif /* MULTI == PTHREAD || MULTI == OPENMP */
+
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+void ep_map_dst(ep_t p, const uint8_t *msg, int len, const uint8_t *dst, int dst_len) {
+	/* enough space for two field elements plus extra bytes for uniformity */
+	const int len_per_elm = (FP_PRIME + ep_param_level() + 7) / 8;
+	uint8_t *pseudo_random_bytes = RLC_ALLOCA(uint8_t, 2 * len_per_elm);
+
+	RLC_TRY {
+		if (pseudo_random_bytes == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+
+		/* for hash_to_field, need to hash to a pseudorandom string */
+		/* XXX(rsw) the below assumes that we want to use MD_MAP for hashing.
+		 *          Consider making the hash function a per-curve option!
+		 */
+		md_xmd(pseudo_random_bytes, 2 * len_per_elm, msg, len, dst, dst_len);
+
+		ep_map_bytes(p, pseudo_random_bytes, len_per_elm);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		RLC_FREE(pseudo_random_bytes);
+	}
+}
+
+void ep_map_dst_batch(ep_t *p, uint8_t *msg[], int len[], int n,
+		const uint8_t *dst, int dst_len) {
+	if (n <= 0) {
+		return;
+	}
+#if MULTI == PTHREAD || MULTI == OPENMP
+	if (n >= RLC_EP_MAP_MULTI && core_get_threads() > 1) {
+		ep_map_t job = { p, msg, len, n, dst, dst_len };
+		core_run(ep_map_dst_job, &job, core_get_threads());
+		return;
+	}
+#endif
+	ep_map_dst_sim(p, msg, len, n, dst, dst_len);
+}
+
+void ep_map_dst_ctx(ep_t p, const uint8_t *msg, int len,
+		const md_xmd_ctx_t ctx) {
+	/* enough space for two field elements plus extra bytes for uniformity */
+	const int len_per_elm = (FP_PRIME + ep_param_level() + 7) / 8;
+	uint8_t *pseudo_random_bytes = RLC_ALLOCA(uint8_t, 2 * len_per_elm);
+
+	RLC_TRY {
+		if (pseudo_random_bytes == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+
+		md_xmd_ctx_run(pseudo_random_bytes, 2 * len_per_elm, msg, len, ctx);
+
+		ep_map_bytes(p, pseudo_random_bytes, len_per_elm);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		RLC_FREE(pseudo_random_bytes);
+	}
+}
+
+void ep_map_dst_stream(ep_t p, md_ctx_t ctx, const uint8_t *dst,
+		int dst_len) {
+	const int len_per_elm = (FP_PRIME + ep_param_level() + 7) / 8;
+	uint8_t *pseudo_random_bytes = RLC_ALLOCA(uint8_t, 2 * len_per_elm);
+
+	RLC_TRY {
+		if (pseudo_random_bytes == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+
+		md_xmd_final(pseudo_random_bytes, 2 * len_per_elm, ctx, dst, dst_len);
+
+		ep_map_bytes(p, pseudo_random_bytes, len_per_elm);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
 		RLC_FREE(pseudo_random_bytes);
 	}
 }
@@ -404,6 +404,592 @@ static void ep_mul_sim_plain(ep_t r, const ep_t p, const bn_t k, const ep_t q,
 
 #endif /* EP_SIM == INTER */
 
+/**
+ * Decomposes a scalar into the subscalars used to multiply many points
+ * simultaneously. If the curve has an efficient endomorphism, the scalar is
+ * split into two half-length subscalars with the GLV method, such that
+ * k = k0 + k1 * lambda. Otherwise, the scalar is simply copied.
+ *
+ * @param[out] _k			- the subscalars.
+ * @param[in] k				- the scalar to decompose.
+ * @param[in] n				- the group order.
+ * @param[in] v1			- the first set of parameters for the GLV method.
+ * @param[in] v2			- the second set of parameters for the GLV method.
+ * @param[in] s				- the number of subscalars.
+ */
+static void ep_mul_sim_rec(bn_t _k[2], const bn_t k, const bn_t n,
+		const bn_t v1[3], const bn_t v2[3], int s) {
+	if (s == 1) {
+		bn_copy(_k[0], k);
+		return;
+	}
+
+	bn_abs(_k[1], k);
+	if (bn_cmp(_k[1], n) != RLC_LT) {
+		bn_mod(_k[1], _k[1], n);
+	}
+	bn_rec_glv(_k[0], _k[1], _k[1], n, v1, v2);
+	if (bn_sign(k) == RLC_NEG) {
+		bn_neg(_k[0], _k[0]);
+		bn_neg(_k[1], _k[1]);
+	}
+}
+
+/**
+ * Multiplies and adds a small number of prime elliptic curve points
+ * simultaneously by interleaving the window NAFs of their (sub)scalars.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the points to multiply.
+ * @param[in] k				- the integer scalars.
+ * @param[in] n				- the number of points to multiply.
+ * @param[in] s				- the number of subscalars per scalar.
+ */
+static void ep_mul_sim_lot_inter(ep_t r, const ep_t p[], const bn_t k[],
+		int n, int s) {
+	const int len = RLC_FP_BITS + 1, c = (1 << (EP_WIDTH - 2));
+	int i, j, l, m, d, e, *_l = RLC_ALLOCA(int, 2 * n);
+	int8_t *naf = RLC_ALLOCA(int8_t, 2 * n * len);
+	bn_t ord, _k[2], v1[3], v2[3];
+	ep_t u, *t = RLC_ALLOCA(ep_t, n * c);
+
+	bn_null(ord);
+	ep_null(u);
+	for (i = 0; i < 3; i++) {
+		bn_null(v1[i]);
+		bn_null(v2[i]);
+	}
+	for (i = 0; i < 2; i++) {
+		bn_null(_k[i]);
+	}
+	for (i = 0; t != NULL && i < n * c; i++) {
+		ep_null(t[i]);
+	}
+
+	RLC_TRY {
+		if (_l == NULL || naf == NULL || t == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		bn_new(ord);
+		ep_new(u);
+		for (i = 0; i < 3; i++) {
+			bn_new(v1[i]);
+			bn_new(v2[i]);
+		}
+		for (i = 0; i < 2; i++) {
+			bn_new(_k[i]);
+		}
+		for (i = 0; i < n * c; i++) {
+			ep_new(t[i]);
+		}
+
+		ep_curve_get_ord(ord);
+#if defined(EP_ENDOM)
+		if (s == 2) {
+			ep_curve_get_v1(v1);
+			ep_curve_get_v2(v2);
+		}
+#endif
+
+		l = 0;
+		for (i = 0; i < n; i++) {
+			ep_tab(t + i * c, p[i], EP_WIDTH);
+			ep_mul_sim_rec(_k, k[i], ord, (const bn_t *)v1, (const bn_t *)v2, s);
+			for (j = 0; j < s; j++) {
+				_l[s * i + j] = len;
+				bn_rec_naf(&naf[(s * i + j) * len], &_l[s * i + j], _k[j],
+						EP_WIDTH);
+				if (bn_sign(_k[j]) == RLC_NEG) {
+					for (m = 0; m < _l[s * i + j]; m++) {
+						naf[(s * i + j) * len + m] *= -1;
+					}
+				}
+				l = RLC_MAX(l, _l[s * i + j]);
+			}
+		}
+
+		for (i = 0; i < s * n; i++) {
+			for (m = _l[i]; m < l; m++) {
+				naf[i * len + m] = 0;
+			}
+		}
+
+		ep_set_infty(r);
+		for (i = l - 1; i >= 0; i--) {
+			ep_dbl(r, r);
+			for (j = 0; j < n; j++) {
+				for (m = 0; m < s; m++) {
+					d = naf[(s * j + m) * len + i];
+					if (d != 0) {
+						e = j * c + (d > 0 ? d : -d) / 2;
+						if (m == 0) {
+							ep_copy(u, t[e]);
+						} else {
+							ep_psi(u, t[e]);
+						}
+						if (d > 0) {
+							ep_add(r, r, u);
+						} else {
+							ep_sub(r, r, u);
+						}
+					}
+				}
+			}
+		}
+		/* Convert r to affine coordinates. */
+		ep_norm(r, r);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		bn_free(ord);
+		ep_free(u);
+		for (i = 0; i < 3; i++) {
+			bn_free(v1[i]);
+			bn_free(v2[i]);
+		}
+		for (i = 0; i < 2; i++) {
+			bn_free(_k[i]);
+		}
+		if (t != NULL) {
+			for (i = 0; i < n * c; i++) {
+				ep_free(t[i]);
+			}
+		}
+		RLC_FREE(_l);
+		RLC_FREE(naf);
+		RLC_FREE(t);
+	}
+}
+
+/**
+ * Accumulates the points selected by one window of the recoded subscalars into
+ * buckets kept in affine coordinates. Additions into distinct buckets are
+ * independent, so they are performed in rounds that share a single
+ * simultaneous inversion. Points landing on a bucket that is already being
+ * updated in the current round are deferred to the next one.
+ *
+ * @param[in,out] b			- the buckets.
+ * @param[in] c				- the number of buckets.
+ * @param[in] a				- the affine points, one for each subscalar.
+ * @param[in] n				- the number of subscalars.
+ * @param[in] win			- the recoded subscalars.
+ * @param[in] z				- the number of windows per subscalar.
+ * @param[in] i				- the index of the window to process.
+ */
+static void ep_mul_sim_lot_acc(ep_t *b, int c, const ep_t *a, int n,
+		const int16_t *win, int z, int i) {
+	int j, d, l, m, t, *e = RLC_ALLOCA(int, n), *f = RLC_ALLOCA(int, 2 * c);
+	fp_t u, v, *den = RLC_ALLOCA(fp_t, c);
+	ep_t *q = RLC_ALLOCA(ep_t, c);
+
+	fp_null(u);
+	fp_null(v);
+	for (j = 0; den != NULL && q != NULL && j < c; j++) {
+		fp_null(den[j]);
+		ep_null(q[j]);
+	}
+
+	RLC_TRY {
+		if (e == NULL || f == NULL || den == NULL || q == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		fp_new(u);
+		fp_new(v);
+		for (j = 0; j < c; j++) {
+			fp_new(den[j]);
+			ep_new(q[j]);
+		}
+
+		/* Collect the points with nonzero digits in this window. */
+		m = 0;
+		for (j = 0; j < n; j++) {
+			if (win[j * z + i] != 0) {
+				e[m++] = j;
+			}
+		}
+
+		while (RLC_MIN(m, c) >= 128) {
+			for (j = 0; j < c; j++) {
+				f[j] = 0;
+			}
+			t = l = 0;
+			for (j = 0; j < m; j++) {
+				d = win[e[j] * z + i];
+				d = (d > 0 ? d : -d) - 1;
+				if (f[d]) {
+					/* Bucket is busy in this round, defer the point. */
+					e[l++] = e[j];
+					continue;
+				}
+				f[d] = 1;
+
+				ep_copy(q[t], a[e[j]]);
+				if (win[e[j] * z + i] < 0) {
+					ep_neg(q[t], q[t]);
+				}
+				if (ep_is_infty(q[t])) {
+					continue;
+				}
+				if (ep_is_infty(b[d])) {
+					ep_copy(b[d], q[t]);
+					continue;
+				}
+				fp_sub(den[t], q[t]->x, b[d]->x);
+				if (fp_is_zero(den[t])) {
+					/* Handle doublings and inverses out of the batch. */
+					if (fp_cmp(q[t]->y, b[d]->y) == RLC_EQ) {
+						ep_dbl(b[d], b[d]);
+						ep_norm(b[d], b[d]);
+					} else {
+						ep_set_infty(b[d]);
+					}
+					continue;
+				}
+				f[c + t] = d;
+				t++;
+			}
+
+			if (t > 0) {
+				fp_inv_sim(den, (const fp_t *)den, t);
+			}
+			for (j = 0; j < t; j++) {
+				d = f[c + j];
+				/* u = lambda = (y2 - y1)/(x2 - x1). */
+				fp_sub(u, q[j]->y, b[d]->y);
+				fp_mul(u, u, den[j]);
+				/* x3 = lambda^2 - x1 - x2. */
+				fp_sqr(v, u);
+				fp_sub(v, v, b[d]->x);
+				fp_sub(v, v, q[j]->x);
+				/* y3 = lambda * (x1 - x3) - y1. */
+				fp_sub(b[d]->x, b[d]->x, v);
+				fp_mul(b[d]->x, b[d]->x, u);
+				fp_sub(b[d]->y, b[d]->x, b[d]->y);
+				fp_copy(b[d]->x, v);
+			}
+			m = l;
+		}
+
+		/* Few additions do not amortize an inversion, so finish them in
+		 * projective coordinates. */
+		for (j = 0; j < m; j++) {
+			d = win[e[j] * z + i];
+			ep_copy(q[0], a[e[j]]);
+			if (d < 0) {
+				ep_neg(q[0], q[0]);
+				d = -d;
+			}
+			ep_add(b[d - 1], b[d - 1], q[0]);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		fp_free(u);
+		fp_free(v);
+		for (j = 0; den != NULL && q != NULL && j < c; j++) {
+			fp_free(den[j]);
+			ep_free(q[j]);
+		}
+		RLC_FREE(e);
+		RLC_FREE(f);
+		RLC_FREE(den);
+		RLC_FREE(q);
+	}
+}
+
+/**
+ * Multiplies and adds many prime elliptic curve points simultaneously using
+ * the bucket method by Pippenger. The (sub)scalars are recoded in signed
+ * windows of w bits and, for each window, points are accumulated into 2^(w-1)
+ * buckets that are later combined with a running sum.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the points to multiply.
+ * @param[in] k				- the integer scalars.
+ * @param[in] n				- the number of points to multiply.
+ * @param[in] s				- the number of subscalars per scalar.
+ * @param[in] basic			- the flag to keep the buckets in affine coordinates.
+ */
+static void ep_mul_sim_lot_bucket(ep_t r, const ep_t p[], const bn_t k[],
+		int n, int s, int basic) {
+	int i, j, l, m, d, c, w, z, cost, min;
+	int16_t *win = NULL, *_w;
+	dig_t t0;
+	bn_t ord, _k[2], v1[3], v2[3];
+	ep_t t, u, v, *a = NULL, *b = NULL;
+
+	bn_null(ord);
+	ep_null(t);
+	ep_null(u);
+	ep_null(v);
+	for (i = 0; i < 3; i++) {
+		bn_null(v1[i]);
+		bn_null(v2[i]);
+	}
+	for (i = 0; i < 2; i++) {
+		bn_null(_k[i]);
+	}
+
+	RLC_TRY {
+		bn_new(ord);
+		ep_new(t);
+		ep_new(u);
+		ep_new(v);
+		for (i = 0; i < 3; i++) {
+			bn_new(v1[i]);
+			bn_new(v2[i]);
+		}
+		for (i = 0; i < 2; i++) {
+			bn_new(_k[i]);
+		}
+
+		ep_curve_get_ord(ord);
+#if defined(EP_ENDOM)
+		if (s == 2) {
+			ep_curve_get_v1(v1);
+			ep_curve_get_v2(v2);
+		}
+#endif
+
+		/* Compute the maximum length of the subscalars. */
+		l = 0;
+		for (i = 0; i < n; i++) {
+			ep_mul_sim_rec(_k, k[i], ord, (const bn_t *)v1, (const bn_t *)v2, s);
+			for (j = 0; j < s; j++) {
+				l = RLC_MAX(l, bn_bits(_k[j]));
+			}
+		}
+
+		/* Choose the window size minimizing the number of additions. */
+		w = 2;
+		min = RLC_CEIL(l + 1, w) * (s * n + (1 << w));
+		for (i = 3; i < RLC_MIN(RLC_DIG, 15); i++) {
+			cost = RLC_CEIL(l + 1, i) * (s * n + (1 << i));
+			if (cost < min) {
+				min = cost;
+				w = i;
+			}
+		}
+		c = (1 << (w - 1));
+		z = RLC_CEIL(l + 1, w);
+
+		win = RLC_ALLOCA(int16_t, s * n * z);
+		b = RLC_ALLOCA(ep_t, c);
+		if (win == NULL || b == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < c; i++) {
+			ep_null(b[i]);
+			ep_new(b[i]);
+		}
+
+		if (basic) {
+			/* Convert the points and their endomorphism images to affine
+			 * coordinates once, instead of once per window. */
+			a = RLC_ALLOCA(ep_t, s * n);
+			if (a == NULL) {
+				RLC_THROW(ERR_NO_MEMORY);
+			}
+			for (i = 0; i < s * n; i++) {
+				ep_null(a[i]);
+				ep_new(a[i]);
+				if (i % s) {
+					ep_psi(a[i], a[i - 1]);
+				} else {
+					ep_copy(a[i], p[i / s]);
+				}
+			}
+			ep_norm_sim(a, (const ep_t *)a, s * n);
+		}
+
+		/* Recode subscalars in signed windows with digits in [-c, c]. */
+		for (i = 0; i < n; i++) {
+			ep_mul_sim_rec(_k, k[i], ord, (const bn_t *)v1, (const bn_t *)v2, s);
+			for (j = 0; j < s; j++) {
+				_w = &win[(s * i + j) * z];
+				m = bn_sign(_k[j]);
+				bn_abs(_k[j], _k[j]);
+				for (d = 0; d < z; d++) {
+					bn_get_dig(&t0, _k[j]);
+					_w[d] = t0 & RLC_MASK(w);
+					bn_rsh(_k[j], _k[j], w);
+					if (_w[d] > c) {
+						_w[d] -= (1 << w);
+						bn_add_dig(_k[j], _k[j], 1);
+					}
+				}
+				if (m == RLC_NEG) {
+					for (d = 0; d < z; d++) {
+						_w[d] = -_w[d];
+					}
+				}
+			}
+		}
+
+		ep_set_infty(t);
+		for (i = z - 1; i >= 0; i--) {
+			for (j = 0; j < w && i < z - 1; j++) {
+				ep_dbl(t, t);
+			}
+			for (j = 0; j < c; j++) {
+				ep_set_infty(b[j]);
+			}
+			if (basic) {
+				ep_mul_sim_lot_acc(b, c, (const ep_t *)a, s * n, win, z, i);
+			} else {
+				for (j = 0; j < n; j++) {
+					for (m = 0; m < s; m++) {
+						d = win[(s * j + m) * z + i];
+						if (d != 0) {
+							if (m == 0) {
+								ep_copy(u, p[j]);
+							} else {
+								ep_psi(u, p[j]);
+							}
+							if (d < 0) {
+								ep_neg(u, u);
+								d = -d;
+							}
+							ep_add(b[d - 1], b[d - 1], u);
+						}
+					}
+				}
+			}
+			/* Compute \sum_j j * b[j - 1] with a running sum. */
+			ep_set_infty(u);
+			ep_set_infty(v);
+			for (j = c - 1; j >= 0; j--) {
+				ep_add(u, u, b[j]);
+				ep_add(v, v, u);
+			}
+			ep_add(t, t, v);
+		}
+		/* Convert r to affine coordinates. */
+		ep_norm(r, t);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		bn_free(ord);
+		ep_free(t);
+		ep_free(u);
+		ep_free(v);
+		for (i = 0; i < 3; i++) {
+			bn_free(v1[i]);
+			bn_free(v2[i]);
+		}
+		for (i = 0; i < 2; i++) {
+			bn_free(_k[i]);
+		}
+		if (a != NULL) {
+			for (i = 0; i < s * n; i++) {
+				ep_free(a[i]);
+			}
+		}
+		if (b != NULL) {
+			for (i = 0; i < c; i++) {
+				ep_free(b[i]);
+			}
+		}
+		RLC_FREE(win);
+		RLC_FREE(a);
+		RLC_FREE(b);
+	}
+}
+
+#if MULTI == PTHREAD || MULTI == OPENMP
+
+/**
+ * Arguments of a simultaneous multiplication split among threads.
+ */
+typedef struct {
+	/** The partial results, one per share. */
+	ep_t *t;
+	/** The points to multiply. */
+	const ep_t *p;
+	/** The integer scalars. */
+	const bn_t *k;
+	/** The number of points to multiply. */
+	int n;
+	/** The number of subscalars per scalar. */
+	int s;
+} ep_lot_t;
+
+/**
+ * Computes a share of a simultaneous multiplication.
+ *
+ * @param[in,out] args		- the simultaneous multiplication.
+ * @param[in] i				- the index of the share.
+ * @param[in] c				- the number of shares.
+ */
+static void ep_mul_sim_lot_job(void *args, int i, int c) {
+	ep_lot_t *job = (ep_lot_t *)args;
+	int m = RLC_CEIL(job->n, c), j = RLC_MIN(i * m, job->n);
+
+	m = RLC_MIN(m, job->n - j);
+	if (m == 0) {
+		ep_set_infty(job->t[i]);
+	} else {
+		ep_mul_sim_lot_bucket(job->t[i], job->p + j, job->k + j, m, job->s,
+				m >= RLC_EP_LOT_BASIC);
+	}
+}
+
+/**
+ * Multiplies and adds many prime elliptic curve points simultaneously by
+ * splitting the points among core_get_threads() threads and adding the
+ * partial results.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the points to multiply.
+ * @param[in] k				- the integer scalars.
+ * @param[in] n				- the number of points to multiply.
+ * @param[in] s				- the number of subscalars per scalar.
+ */
+static void ep_mul_sim_lot_multi(ep_t r, const ep_t p[], const bn_t k[],
+		int n, int s) {
+	const int c = core_get_threads();
+	int i;
+	ep_t *t = RLC_ALLOCA(ep_t, c);
+	ep_lot_t job = { t, p, k, n, s };
+
+	RLC_TRY {
+		if (t == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < c; i++) {
+			ep_null(t[i]);
+			ep_new(t[i]);
+		}
+
+		core_run(ep_mul_sim_lot_job, &job, c);
+
+		ep_set_infty(r);
+		for (i = 0; i < c; i++) {
+			ep_add(r, r, t[i]);
+		}
+		ep_norm(r, r);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		if (t != NULL) {
+			for (i = 0; i < c; i++) {
+				ep_free(t[i]);
+			}
+		}
+		RLC_FREE(t);
+	}
+}
+
+#endif /* MULTI == PTHREAD || MULTI == OPENMP */
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -719,3 +1305,65 @@ void ep_mul_sim_dig(ep_t r, const ep_t p[], const dig_t k[], int len) {
 		ep_free(t);
 	}
 }
+
+void ep_mul_sim_lot(ep_t r, const ep_t p[], const bn_t k[], int n) {
+	int s = 1;
+
+	if (n <= 0) {
+		ep_set_infty(r);
+		return;
+	}
+
+#if defined(EP_ENDOM)
+	if (ep_curve_is_endom()) {
+		s = 2;
+	}
+#endif
+
+#if MULTI == PTHREAD || MULTI == OPENMP
+	if (n >= RLC_EP_LOT_MULTI && core_get_threads() > 1) {
+		ep_mul_sim_lot_multi(r, p, k, n, s);
+		return;
+	}
+#endif
+
+	if (n <= 4) {
+		ep_mul_sim_lot_inter(r, p, k, n, s);
+	} else {
+		ep_mul_sim_lot_bucket(r, p, k, n, s, n >= RLC_EP_LOT_BASIC);
+	}
+}
+
+void ep_mul_sim_lot_projc(ep_t r, const ep_t p[], const bn_t k[], int n) {
+	int s = 1;
+
+	if (n <= 0) {
+		ep_set_infty(r);
+		return;
+	}
+
+#if defined(EP_ENDOM)
+	if (ep_curve_is_endom()) {
+		s = 2;
+	}
+#endif
+
+	ep_mul_sim_lot_bucket(r, p, k, n, s, 0);
+}
+
+void ep_mul_sim_lot_basic(ep_t r, const ep_t p[], const bn_t k[], int n) {
+	int s = 1;
+
+	if (n <= 0) {
+		ep_set_infty(r);
+		return;
+	}
+
+#if defined(EP_ENDOM)
+	if (ep_curve_is_endom()) {
+		s = 2;
+	}
+#endif
+
+	ep_mul_sim_lot_bucket(r, p, k, n, s, 1);
+}
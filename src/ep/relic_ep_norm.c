@@ -111,30 +111,60 @@ void ep_norm(ep_t r, const ep_t p) {
 
 void ep_norm_sim(ep_t *r, const ep_t *t, int n) {
 	int i;
-	fp_t* a = RLC_ALLOCA(fp_t, n);
+	fp_t *a = RLC_ALLOCA(fp_t, n);
+	fp_t *u = RLC_ALLOCA(fp_t, n);
+	fp_t *v = RLC_ALLOCA(fp_t, n);
 
 	RLC_TRY {
-		if (a == NULL) {
+		if (a == NULL || u == NULL || v == NULL) {
 			RLC_THROW(ERR_NO_MEMORY);
 		}
 		for (i = 0; i < n; i++) {
 			fp_null(a[i]);
+			fp_null(u[i]);
+			fp_null(v[i]);
 			fp_new(a[i]);
-			fp_copy(a[i], t[i]->z);
+			fp_new(u[i]);
+			fp_new(v[i]);
+			if (ep_is_infty(t[i])) {
+				fp_set_dig(a[i], 1);
+			} else {
+				fp_copy(a[i], t[i]->z);
+			}
 		}
 
 		fp_inv_sim(a, (const fp_t *)a, n);
 
+		/* Compute z^(-2) and z^(-3) for all points at once. */
+		fp_sqr_vec(u, (const fp_t *)a, n);
+		fp_mul_vec(v, (const fp_t *)u, (const fp_t *)a, n);
+
+		/* Select the multipliers for x and y according to the coordinates. */
 		for (i = 0; i < n; i++) {
-			fp_copy(r[i]->x, t[i]->x);
-			fp_copy(r[i]->y, t[i]->y);
-			if (!ep_is_infty(t[i])) {
-				fp_copy(r[i]->z, a[i]);
+			if (ep_is_infty(t[i]) || t[i]->coord == BASIC) {
+				fp_set_dig(u[i], 1);
+				fp_set_dig(v[i], 1);
+			} else if (t[i]->coord == PROJC) {
+				fp_copy(u[i], a[i]);
+				fp_copy(v[i], a[i]);
 			}
+			fp_copy(a[i], t[i]->x);
 		}
+		fp_mul_vec(u, (const fp_t *)a, (const fp_t *)u, n);
+		for (i = 0; i < n; i++) {
+			fp_copy(a[i], t[i]->y);
+		}
+		fp_mul_vec(v, (const fp_t *)a, (const fp_t *)v, n);
 
 		for (i = 0; i < n; i++) {
-			ep_norm_imp(r[i], r[i], 1);
+			if (ep_is_infty(t[i])) {
+				ep_set_infty(r[i]);
+			} else {
+				fp_copy(r[i]->x, u[i]);
+				fp_copy(r[i]->y, v[i]);
+				fp_set_dig(r[i]->z, 1);
+				r[i]->coord = BASIC;
+			}
 		}
 	}
 	RLC_CATCH_ANY {
@@ -143,7 +173,11 @@ void ep_norm_sim(ep_t *r, const ep_t *t, int n) {
 	RLC_FINALLY {
 		for (i = 0; i < n; i++) {
 			fp_free(a[i]);
+			fp_free(u[i]);
+			fp_free(v[i]);
 		}
 		RLC_FREE(a);
+		RLC_FREE(u);
+		RLC_FREE(v);
 	}
 }
@@ -32,6 +32,185 @@
 
 #include "relic_core.h"
 
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Reads a prime elliptic curve point from a byte vector, reporting invalid
+ * encodings instead of throwing errors. Invalid points are set to infinity.
+ *
+ * @param[out] a			- the result.
+ * @param[in] bin			- the byte vector.
+ * @param[in] len			- the buffer capacity.
+ * @return 1 if the encoding is valid and the point is in the curve, 0 otherwise.
+ */
+static int ep_read_bin_imp(ep_t a, const uint8_t *bin, int len) {
+	int r;
+
+	if (len == 1) {
+		ep_set_infty(a);
+		return (bin[0] == 0);
+	}
+
+	a->coord = BASIC;
+	fp_set_dig(a->z, 1);
+	fp_read_bin(a->x, bin + 1, RLC_FP_BYTES);
+	if (len == RLC_FP_BYTES + 1) {
+		fp_zero(a->y);
+		fp_set_bit(a->y, 0, bin[0] & 1);
+		r = (bin[0] == 2 || bin[0] == 3) && ep_upk(a, a);
+	} else {
+		fp_read_bin(a->y, bin + RLC_FP_BYTES + 1, RLC_FP_BYTES);
+		r = (bin[0] == 4) && ep_on_curve(a);
+	}
+	if (!r) {
+		ep_set_infty(a);
+	}
+	return r;
+}
+
+/**
+ * Number of compressed points decoded at once by the batch reader, a multiple
+ * of the eight elements processed by the vector field kernels.
+ */
+#define EP_READ_LANES		16
+
+/**
+ * Decompresses many prime elliptic curve points in stages, so that the square
+ * roots are computed together by walking the fixed exponentiation chain with
+ * the vector field kernels. Requires p = 3 mod 4.
+ *
+ * @param[out] a			- the results.
+ * @param[out] r			- the flags indicating which points are valid.
+ * @param[in] bin			- the byte vector.
+ * @param[in] n				- the number of points, at most EP_READ_LANES.
+ */
+static void ep_read_bin_vec(ep_t *a, int *r, const uint8_t *bin, int n) {
+	const int len = RLC_FP_BYTES + 1;
+	fp_t t[EP_READ_LANES], u[EP_READ_LANES], v[EP_READ_LANES];
+	bn_t h, y;
+	int i;
+
+	bn_null(h);
+	bn_null(y);
+	for (i = 0; i < n; i++) {
+		fp_null(t[i]);
+		fp_null(u[i]);
+		fp_null(v[i]);
+	}
+
+	RLC_TRY {
+		bn_new(h);
+		bn_new(y);
+		for (i = 0; i < n; i++) {
+			fp_new(t[i]);
+			fp_new(u[i]);
+			fp_new(v[i]);
+		}
+
+		/* Read the abscissas and compute the right-hand sides. */
+		for (i = 0; i < n; i++) {
+			r[i] = (bin[i * len] == 2 || bin[i * len] == 3);
+			a[i]->coord = BASIC;
+			fp_set_dig(a[i]->z, 1);
+			fp_read_bin(a[i]->x, bin + i * len + 1, RLC_FP_BYTES);
+			ep_rhs(t[i], a[i]);
+		}
+
+		/* Compute the candidate square roots a^((p + 1)/4) together. */
+		fp_exp_chain_vec(u, (const fp_t *)t, RLC_FP_EXP_SRT, n);
+		fp_sqr_vec(v, (const fp_t *)u, n);
+
+		/* Select the root matching the compressed ordinate, as ep_upk(). */
+		h->used = RLC_FP_DIGS;
+		dv_copy(h->dp, fp_prime_get(), RLC_FP_DIGS);
+		bn_hlv(h, h);
+		for (i = 0; i < n; i++) {
+			r[i] = r[i] && (fp_cmp(v[i], t[i]) == RLC_EQ);
+			if (r[i]) {
+				fp_prime_back(y, u[i]);
+				if ((bn_cmp(y, h) == RLC_GT) != (bin[i * len] & 1)) {
+					fp_neg(u[i], u[i]);
+				}
+				fp_copy(a[i]->y, u[i]);
+			} else {
+				ep_set_infty(a[i]);
+			}
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		bn_free(h);
+		bn_free(y);
+		for (i = 0; i < n; i++) {
+			fp_free(t[i]);
+			fp_free(u[i]);
+			fp_free(v[i]);
+		}
+	}
+}
+
+/**
+ * Reads many prime elliptic curve points stored contiguously in a byte vector.
+ *
+ * @param[out] a			- the results.
+ * @param[out] r			- the flags indicating which points are valid.
+ * @param[in] bin			- the byte vector.
+ * @param[in] len			- the buffer capacity of each point.
+ * @param[in] n				- the number of points.
+ */
+static void ep_read_bin_sim(ep_t *a, int *r, const uint8_t *bin, int len,
+		int n) {
+	if (len == RLC_FP_BYTES + 1 && fp_prime_get_mod8() % 4 == 3) {
+		for (int i = 0; i < n; i += EP_READ_LANES) {
+			ep_read_bin_vec(a + i, r + i, bin + i * len,
+					RLC_MIN(EP_READ_LANES, n - i));
+		}
+		return;
+	}
+	for (int i = 0; i < n; i++) {
+		r[i] = ep_read_bin_imp(a[i], bin + i * len, len);
+	}
+}
+
+#if MULTI == PTHREAD || MULTI == OPENMP
+
+/**
+ * Arguments of a batch of points split among threads.
+ */
+typedef struct {
+	/** The results. */
+	ep_t *a;
+	/** The flags indicating which points are valid. */
+	int *r;
+	/** The byte vector. */
+	const uint8_t *bin;
+	/** The buffer capacity of each point. */
+	int len;
+	/** The number of points. */
+	int n;
+} ep_read_t;
+
+/**
+ * Reads a share of a batch of points.
+ *
+ * @param[in,out] args		- the batch of points.
+ * @param[in] i				- the index of the share.
+ * @param[in] c				- the number of shares.
+ */
+static void ep_read_bin_job(void *args, int i, int c) {
+	ep_read_t *job = (ep_read_t *)args;
+	int m = RLC_CEIL(job->n, c), j = RLC_MIN(i * m, job->n);
+
+	ep_read_bin_sim(job->a + j, job->r + j, job->bin + j * job->len, job->len,
+			RLC_MIN(m, job->n - j));
+}
+
+#endif /* MULTI == PTHREAD || MULTI == OPENMP */
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -211,6 +390,25 @@ void ep_tab(ep_t *t, const ep_t p, int w) {
 	ep_copy(t[0], p);
 }
 
+void ep_psi(ep_t r, const ep_t p) {
+	if (ep_is_infty(p)) {
+		ep_set_infty(r);
+		return;
+	}
+
+#if defined(EP_ENDOM)
+	ep_copy(r, p);
+	if (ep_curve_opt_a() == RLC_ZERO) {
+		fp_mul(r->x, r->x, ep_curve_get_beta());
+	} else {
+		fp_neg(r->x, r->x);
+		fp_mul(r->y, r->y, ep_curve_get_beta());
+	}
+#else
+	RLC_THROW(ERR_NO_CONFIG);
+#endif
+}
+
 void ep_print(const ep_t p) {
 	fp_print(p->x);
 	fp_print(p->y);
@@ -276,6 +474,35 @@ void ep_read_bin(ep_t a, const uint8_t *bin, int len) {
 	}
 }
 
+int ep_read_bin_batch(ep_t *a, int *r, const uint8_t *bin, int len, int n) {
+	int i, c = 0, multi = 0;
+
+	if (n <= 0) {
+		return 0;
+	}
+
+	if (len != 1 && len != (RLC_FP_BYTES + 1) && len != (2 * RLC_FP_BYTES + 1)) {
+		RLC_THROW(ERR_NO_BUFFER);
+		return 0;
+	}
+
+#if MULTI == PTHREAD || MULTI == OPENMP
+	multi = (n >= RLC_EP_READ_MULTI && core_get_threads() > 1);
+	if (multi) {
+		ep_read_t job = { a, r, bin, len, n };
+		core_run(ep_read_bin_job, &job, core_get_threads());
+	}
+#endif
+	if (!multi) {
+		ep_read_bin_sim(a, r, bin, len, n);
+	}
+
+	for (i = 0; i < n; i++) {
+		c += r[i];
+	}
+	return c;
+}
+
 void ep_write_bin(uint8_t *bin, int len, const ep_t a, int pack) {
 	ep_t t;
 
@@ -349,6 +349,96 @@ static void ep2_add_projc_imp(ep2_t r, ep2_t p, ep2_t q) {
 
 #endif /* EP_ADD == PROJC */
 
+/**
+ * Adds points in affine coordinates with an addition tree. Each level of the
+ * tree adds pairs of points with a single simultaneous inversion.
+ *
+ * @param[out] r			- the result.
+ * @param[in,out] t			- the points to add, destroyed on output.
+ * @param[in] d				- the temporary storage for the inversions.
+ * @param[in] f				- the temporary storage for the special cases.
+ * @param[in] m				- the number of points to add.
+ */
+static void ep2_add_sim_imp(ep2_t r, ep2_t *t, fp2_t *d, int *f, int m) {
+	int i, h;
+	fp2_t u, v;
+
+	fp2_null(u);
+	fp2_null(v);
+
+	RLC_TRY {
+		fp2_new(u);
+		fp2_new(v);
+
+		while (m > 1) {
+			h = m / 2;
+			for (i = 0; i < h; i++) {
+				f[i] = 0;
+				fp2_sub(d[i], t[2 * i + 1]->x, t[2 * i]->x);
+				if (fp2_is_zero(d[i])) {
+					/* Handle doublings and inverses out of the batch. */
+					f[i] = 1;
+					fp2_set_dig(d[i], 1);
+					if (fp2_cmp(t[2 * i]->y, t[2 * i + 1]->y) == RLC_EQ) {
+						ep2_dbl(t[2 * i], t[2 * i]);
+						ep2_norm(t[2 * i], t[2 * i]);
+					} else {
+						ep2_set_infty(t[2 * i]);
+					}
+				}
+			}
+
+			fp2_inv_sim(d, d, h);
+
+			for (i = 0; i < h; i++) {
+				if (f[i]) {
+					ep2_copy(t[i], t[2 * i]);
+					continue;
+				}
+				/* u = lambda = (y2 - y1)/(x2 - x1). */
+				fp2_sub(u, t[2 * i + 1]->y, t[2 * i]->y);
+				fp2_mul(u, u, d[i]);
+				/* x3 = lambda^2 - x1 - x2. */
+				fp2_sqr(v, u);
+				fp2_sub(v, v, t[2 * i]->x);
+				fp2_sub(v, v, t[2 * i + 1]->x);
+				/* y3 = lambda * (x1 - x3) - y1. */
+				fp2_sub(t[i]->x, t[2 * i]->x, v);
+				fp2_mul(t[i]->x, t[i]->x, u);
+				fp2_sub(t[i]->y, t[i]->x, t[2 * i]->y);
+				fp2_copy(t[i]->x, v);
+				fp2_set_dig(t[i]->z, 1);
+				t[i]->coord = BASIC;
+			}
+			if (m % 2 == 1) {
+				ep2_copy(t[h], t[m - 1]);
+				h++;
+			}
+
+			/* Remove points at infinity before the next level. */
+			m = 0;
+			for (i = 0; i < h; i++) {
+				if (!ep2_is_infty(t[i])) {
+					ep2_copy(t[m++], t[i]);
+				}
+			}
+		}
+
+		if (m == 0) {
+			ep2_set_infty(r);
+		} else {
+			ep2_copy(r, t[0]);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		fp2_free(u);
+		fp2_free(v);
+	}
+}
+
 /*============================================================================*/
 	/* Public definitions                                                         */
 /*============================================================================*/
@@ -432,3 +522,60 @@ void ep2_sub(ep2_t r, ep2_t p, ep2_t q) {
 		ep2_free(t);
 	}
 }
+
+void ep2_add_sim(ep2_t r, ep2_t p[], int n) {
+	const int c = RLC_MAX(1, RLC_MIN(n, RLC_EPX_ADD_SIM));
+	int i, j, m, norm, *f = RLC_ALLOCA(int, c);
+	fp2_t *d = RLC_ALLOCA(fp2_t, c);
+	ep2_t s, u, *t = RLC_ALLOCA(ep2_t, c);
+
+	ep2_null(s);
+	ep2_null(u);
+
+	RLC_TRY {
+		if (f == NULL || d == NULL || t == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		ep2_new(s);
+		ep2_new(u);
+		for (i = 0; i < c; i++) {
+			fp2_null(d[i]);
+			ep2_null(t[i]);
+			fp2_new(d[i]);
+			ep2_new(t[i]);
+		}
+
+		/* Add chunks of points with a tree to bound the temporary storage. */
+		ep2_set_infty(s);
+		for (i = 0; i < n; i += c) {
+			m = norm = 0;
+			for (j = i; j < RLC_MIN(n, i + c); j++) {
+				if (!ep2_is_infty(p[j])) {
+					ep2_copy(t[m], p[j]);
+					norm |= (t[m]->coord != BASIC);
+					m++;
+				}
+			}
+			if (norm) {
+				ep2_norm_sim(t, t, m);
+			}
+			ep2_add_sim_imp(u, t, d, f, m);
+			ep2_add(s, s, u);
+		}
+		ep2_norm(r, s);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		ep2_free(s);
+		ep2_free(u);
+		for (i = 0; d != NULL && t != NULL && i < c; i++) {
+			fp2_free(d[i]);
+			ep2_free(t[i]);
+		}
+		RLC_FREE(f);
+		RLC_FREE(d);
+		RLC_FREE(t);
+	}
+}
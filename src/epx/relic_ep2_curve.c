@@ -416,7 +416,18 @@ static void ep2_curve_set_map(void) {
 			fp2_inv(c1, c1);     /* c1 = -1 / a */
 			fp2_mul(c1, c1, c4); /* c1 = -b / a */
 
-			/* constant 2 is unused in this case */
+			/* constant 2: sqrt(-N(u)) in Fp, to compute square roots of
+			 * ratios when p = 3 mod 4 */
+			if (fp_prime_get_mod8() % 4 == 3 && fp_prime_get_qnr() == -1) {
+				fp_sqr(c2[0], ctx->ep2_map_u[0]);
+				fp_sqr(c2[1], ctx->ep2_map_u[1]);
+				fp_add(c2[0], c2[0], c2[1]);
+				fp_neg(c2[0], c2[0]);
+				fp_zero(c2[1]);
+				if (!fp_srt(c2[0], c2[0])) {
+					RLC_THROW(ERR_NO_VALID);
+				}
+			}
 		} else {
 			/* SvdW map constants */
 			/* constant 1: g(u) = u^3 + a * u + b */
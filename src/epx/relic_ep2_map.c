@@ -53,8 +53,121 @@ TMPL_MAP_HORNER(fp2, fp2_t)
  * Generic isogeny map evaluation for use with SSWU map.
  */
 TMPL_MAP_ISOGENY_MAP(ep2, fp2, iso2)
+
+/**
+ * Addition on the isogenous curve, so that the isogeny is evaluated only once.
+ */
+TMPL_MAP_ISOGENY_ADD(ep2, fp2, fp_t)
 #endif /* EP_CTMAP */
 
+/**
+ * Computes the square root of u/v if it is a square, or the square root of
+ * Z * u/v otherwise, where Z is the non-square used by the mapping function.
+ * When p = 3 mod 4, u/v is written as w/n with n = N(v) in Fp, and the square
+ * root is obtained from two exponentiations in Fp without any inversion.
+ *
+ * @param[out] c		- the result.
+ * @param[in] u			- the numerator.
+ * @param[in] v			- the denominator.
+ * @return 1 if u/v is a square, 0 otherwise.
+ */
+static int fp2_srt_ratio(fp2_t c, fp2_t u, fp2_t v) {
+	ctx_t *ctx = core_get();
+	fp2_t w, z;
+	fp_t n, s, t0, t1;
+	int r = 0;
+
+	fp2_null(w);
+	fp2_null(z);
+	fp_null(n);
+	fp_null(s);
+	fp_null(t0);
+	fp_null(t1);
+
+	RLC_TRY {
+		fp2_new(w);
+		fp2_new(z);
+		fp_new(n);
+		fp_new(s);
+		fp_new(t0);
+		fp_new(t1);
+
+		if (fp_prime_get_mod8() % 4 == 3 && fp_prime_get_qnr() == -1) {
+			/* Write u/v = w/n, with n = N(v) and w = u * conj(v). */
+			fp_sqr(n, v[0]);
+			fp_sqr(t0, v[1]);
+			fp_add(n, n, t0);
+			fp_copy(z[0], v[0]);
+			fp_neg(z[1], v[1]);
+			fp2_mul(w, u, z);
+
+			/* w is a square in Fp2 if and only if N(w) = N(u) * n is a
+			 * square in Fp. */
+			fp_sqr(s, u[0]);
+			fp_sqr(t0, u[1]);
+			fp_add(s, s, t0);
+			fp_mul(s, s, n);
+			fp_exp_chain(t0, s, RLC_FP_EXP_SRT);
+			fp_sqr(t1, t0);
+			r = (fp_cmp(t1, s) == RLC_EQ);
+
+			/* Otherwise, take Z * w, with sqrt(N(Z * w)) = t0 * sqrt(-N(Z)). */
+			fp2_mul(z, w, ctx->ep2_map_u);
+			dv_copy_cond(w[0], z[0], RLC_FP_DIGS, r == 0);
+			dv_copy_cond(w[1], z[1], RLC_FP_DIGS, r == 0);
+			fp_mul(t1, t0, ctx->ep2_map_c[1][0]);
+			dv_copy_cond(t0, t1, RLC_FP_DIGS, r == 0);
+
+			/* Now t0 = sqrt(N(w)) and s = w_0 + t0 is nonzero if w is. */
+			fp_add(s, w[0], t0);
+			fp_sub(t1, w[0], t0);
+			dv_copy_cond(s, t1, RLC_FP_DIGS, fp_is_zero(s));
+
+			/* The root is s * t * g + w_1 * t * g * i, with t = 2 * n and
+			 * g = (s * t^3)^((p - 3)/4), or that times i if s * t is not a
+			 * square, because then s * t^3 * g^2 = -1. */
+			fp_dbl(t0, n);
+			fp_sqr(t1, t0);
+			fp_mul(t1, t1, t0);
+			fp_mul(t1, t1, s);
+			fp_exp_chain(n, t1, RLC_FP_EXP_ISR);
+			fp_mul(t0, t0, n);
+			fp_mul(z[0], s, t0);
+			fp_mul(z[1], w[1], t0);
+			fp_sqr(n, n);
+			fp_mul(t1, t1, n);
+			fp_neg(s, z[1]);
+			fp_copy(c[0], z[0]);
+			fp_copy(c[1], z[1]);
+			dv_copy_cond(c[0], s, RLC_FP_DIGS, fp_cmp_dig(t1, 1) != RLC_EQ);
+			dv_copy_cond(c[1], z[0], RLC_FP_DIGS, fp_cmp_dig(t1, 1) != RLC_EQ);
+		} else {
+			fp2_inv(z, v);
+			fp2_mul(z, z, u);
+			/* Decide with the quadratic character to take a single root. */
+			r = (fp2_smb(z) != -1);
+			fp2_mul(w, z, ctx->ep2_map_u);
+			dv_copy_cond(z[0], w[0], RLC_FP_DIGS, r == 0);
+			dv_copy_cond(z[1], w[1], RLC_FP_DIGS, r == 0);
+			if (!fp2_srt(c, z)) {
+				RLC_THROW(ERR_NO_VALID);
+			}
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		fp2_free(w);
+		fp2_free(z);
+		fp_free(n);
+		fp_free(s);
+		fp_free(t0);
+		fp_free(t1);
+	}
+	return r;
+}
+
 /**
  * Simplified SWU mapping.
  */
@@ -72,7 +185,44 @@ TMPL_MAP_SVDW(ep2, fp2, fp_t, EP2_MAP_COPY_COND)
 #undef EP2_MAP_COPY_COND
 
 /**
- * Multiplies a point by the cofactor in a Barreto-Naehrig curve.
+ * Multiplies a point by the curve parameter with the binary method, leaving
+ * the result in projective coordinates.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the point to multiply.
+ * @param[in] x				- the curve parameter.
+ */
+static void ep2_mul_par(ep2_t r, ep2_t p, const bn_t x) {
+	ep2_t t;
+
+	ep2_null(t);
+
+	RLC_TRY {
+		ep2_new(t);
+
+		ep2_copy(t, p);
+		for (int i = bn_bits(x) - 2; i >= 0; i--) {
+			ep2_dbl(t, t);
+			if (bn_get_bit(x, i)) {
+				ep2_add(t, t, p);
+			}
+		}
+		if (bn_sign(x) == RLC_NEG) {
+			ep2_neg(t, t);
+		}
+		ep2_copy(r, t);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		ep2_free(t);
+	}
+}
+
+/**
+ * Multiplies a point by the cofactor in a Barreto-Naehrig curve, leaving the
+ * result in projective coordinates.
  *
  * @param[out] r			- the result.
  * @param[in] p				- the point to multiply.
@@ -95,7 +245,7 @@ static void ep2_mul_cof_bn(ep2_t r, ep2_t p) {
 		fp_prime_get_par(x);
 
 		/* Compute t0 = xP. */
-		ep2_mul_basic(t0, p, x);
+		ep2_mul_par(t0, p, x);
 
 		/* Compute t1 = \psi(3xP). */
 		ep2_dbl(t1, t0);
@@ -111,7 +261,7 @@ static void ep2_mul_cof_bn(ep2_t r, ep2_t p) {
 		ep2_frb(t1, t0, 2);
 		ep2_add(t2, t2, t1);
 
-		ep2_norm(r, t2);
+		ep2_copy(r, t2);
 	}
 	RLC_CATCH_ANY {
 		RLC_THROW(ERR_CAUGHT);
@@ -125,7 +275,8 @@ static void ep2_mul_cof_bn(ep2_t r, ep2_t p) {
 }
 
 /**
- * Multiplies a point by the cofactor in a Barreto-Lynn-Scott curve.
+ * Multiplies a point by the cofactor in a Barreto-Lynn-Scott curve, leaving
+ * the result in projective coordinates.
  *
  * @param[out] r			- the result.
  * @param[in] p				- the point to multiply.
@@ -150,9 +301,9 @@ static void ep2_mul_cof_b12(ep2_t r, ep2_t p) {
 		fp_prime_get_par(x);
 
 		/* Compute t0 = xP. */
-		ep2_mul_basic(t0, p, x);
+		ep2_mul_par(t0, p, x);
 		/* Compute t1 = [x^2]P. */
-		ep2_mul_basic(t1, t0, x);
+		ep2_mul_par(t1, t0, x);
 
 		/* t2 = (x^2 - x - 1)P = x^2P - x*P - P. */
 		ep2_sub(t2, t1, t0);
@@ -165,7 +316,7 @@ static void ep2_mul_cof_b12(ep2_t r, ep2_t p) {
 		ep2_dbl(t3, p);
 		ep2_frb(t3, t3, 2);
 		ep2_add(t2, t2, t3);
-		ep2_norm(r, t2);
+		ep2_copy(r, t2);
 	}
 	RLC_CATCH_ANY {
 		RLC_THROW(ERR_CAUGHT);
@@ -193,92 +344,145 @@ static inline int fp2_sgn0(const fp2_t t, bn_t k) {
 	return t_0_neg | (t_0_zero & t_1_neg);
 }
 
-/*============================================================================*/
-/* Public definitions                                                         */
-/*============================================================================*/
-
-void ep2_map_dst(ep2_t p, const uint8_t *msg, int len, const uint8_t *dst, int dst_len) {
+/**
+ * Maps two field elements read from a pseudorandom string to the curve and
+ * adds the results. If the curve uses an isogeny for hashing, the sum is left
+ * on the isogenous curve. The result may be in projective coordinates.
+ *
+ * @param[out] p			- the result.
+ * @param[in] buf			- the pseudorandom string.
+ * @param[in] len			- the number of bytes per field element.
+ */
+static void ep2_map_sum(ep2_t p, const uint8_t *buf, int len) {
 	bn_t k;
-	fp2_t t;
+	fp2_t t, x[2], d[2], y[2];
 	ep2_t q;
 	int neg;
-	/* enough space for two extension field elements plus extra bytes for uniformity */
-	const int len_per_elm = (FP_PRIME + ep_param_level() + 7) / 8;
-	uint8_t *pseudo_random_bytes = RLC_ALLOCA(uint8_t, 4 * len_per_elm);
 
 	bn_null(k);
 	fp2_null(t);
 	ep2_null(q);
+	for (int j = 0; j < 2; j++) {
+		fp2_null(x[j]);
+		fp2_null(d[j]);
+		fp2_null(y[j]);
+	}
 
 	RLC_TRY {
 		bn_new(k);
 		fp2_new(t);
 		ep2_new(q);
+		for (int j = 0; j < 2; j++) {
+			fp2_new(x[j]);
+			fp2_new(d[j]);
+			fp2_new(y[j]);
+		}
 
 		/* which hash function should we use? */
 		const int abNeq0 = (ep2_curve_opt_a() != RLC_ZERO) && (ep2_curve_opt_b() != RLC_ZERO);
 		void (*const map_fn)(ep2_t, fp2_t) = (ep2_curve_is_ctmap() || abNeq0) ? ep2_map_sswu : ep2_map_svdw;
 
-		/* XXX(rsw) See note in ep/relic_ep_map.c about using MD_MAP. */
-		/* hash to a pseudorandom string using md_xmd */
-		md_xmd(pseudo_random_bytes, 4 * len_per_elm, msg, len, dst, dst_len);
-
 #define EP2_MAP_CONVERT_BYTES(IDX)                                                       \
 	do {                                                                                 \
-		bn_read_bin(k, pseudo_random_bytes + 2 * IDX * len_per_elm, len_per_elm);        \
+		bn_read_bin(k, buf + 2 * IDX * len, len);                                        \
 		fp_prime_conv(t[0], k);                                                          \
-		bn_read_bin(k, pseudo_random_bytes + (2 * IDX + 1) * len_per_elm, len_per_elm);  \
+		bn_read_bin(k, buf + (2 * IDX + 1) * len, len);                                  \
 		fp_prime_conv(t[1], k);                                                          \
 	} while (0)
 
+#define EP2_MAP_FIX_SIGN(Y)                                                              \
+	do {                                                                                 \
+		/* compare sign of y to sign of t; fix if necessary */                           \
+		neg = neg != fp2_sgn0(Y, k);                                                     \
+		fp2_neg(t, Y);                                                                   \
+		dv_copy_cond(Y[0], t[0], RLC_FP_DIGS, neg);                                      \
+		dv_copy_cond(Y[1], t[1], RLC_FP_DIGS, neg);                                      \
+	} while (0)
+
 #define EP2_MAP_APPLY_MAP(PT)                                                            \
 	do {                                                                                 \
 		/* sign of t */                                                                  \
 		neg = fp2_sgn0(t, k);                                                            \
 		/* convert */                                                                    \
 		map_fn(PT, t);                                                                   \
-		/* compare sign of y to sign of t; fix if necessary */                           \
-		neg = neg != fp2_sgn0(PT->y, k);                                                 \
-		fp2_neg(t, PT->y);                                                               \
-		dv_copy_cond(PT->y[0], t[0], RLC_FP_DIGS, neg);                                  \
-		dv_copy_cond(PT->y[1], t[1], RLC_FP_DIGS, neg);                                  \
+		EP2_MAP_FIX_SIGN(PT->y);                                                         \
 	} while (0)
 
-		/* first map invocation */
-		EP2_MAP_CONVERT_BYTES(0);
-		EP2_MAP_APPLY_MAP(p);
-		TMPL_MAP_CALL_ISOMAP(ep2, p);
-
-		/* second map invocation */
-		EP2_MAP_CONVERT_BYTES(1);
-		EP2_MAP_APPLY_MAP(q);
-		TMPL_MAP_CALL_ISOMAP(ep2, q);
-
-		/* XXX(rsw) could add p and q and then apply isomap,
-		 * but need ep_add to support addition on isogeny curves */
+#ifdef EP_CTMAP
+		if (ep2_curve_is_ctmap()) {
+			/* map to the isogenous curve with x-coordinates as fractions
+			 * and add there, so that the isogeny is evaluated only once. */
+			for (int j = 0; j < 2; j++) {
+				EP2_MAP_CONVERT_BYTES(j);
+				neg = fp2_sgn0(t, k);
+				ep2_map_sswu_frac(x[j], d[j], y[j], t);
+				EP2_MAP_FIX_SIGN(y[j]);
+			}
+			ep2_iso_add(p, x[0], d[0], y[0], x[1], d[1], y[1]);
+		} else {
+#endif
+			/* first map invocation */
+			EP2_MAP_CONVERT_BYTES(0);
+			EP2_MAP_APPLY_MAP(p);
+
+			/* second map invocation */
+			EP2_MAP_CONVERT_BYTES(1);
+			EP2_MAP_APPLY_MAP(q);
+
+			/* sum the result */
+			ep2_add(p, p, q);
+#ifdef EP_CTMAP
+		}
+#endif
 
 #undef EP2_MAP_CONVERT_BYTES
+#undef EP2_MAP_FIX_SIGN
 #undef EP2_MAP_APPLY_MAP
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		bn_free(k);
+		fp2_free(t);
+		ep2_free(q);
+		for (int j = 0; j < 2; j++) {
+			fp2_free(x[j]);
+			fp2_free(d[j]);
+			fp2_free(y[j]);
+		}
+	}
+}
+
+/**
+ * Clears the cofactor of a point obtained by hashing. The result may be in
+ * projective coordinates.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the point to multiply.
+ */
+static void ep2_map_cof(ep2_t r, ep2_t p) {
+	bn_t k;
 
-		/* sum the result */
-		ep2_add(p, p, q);
-		ep2_norm(p, p);
+	bn_null(k);
+
+	RLC_TRY {
+		bn_new(k);
 
-		/* clear cofactor */
 		switch (ep_curve_is_pairf()) {
 			case EP_BN:
-				ep2_mul_cof_bn(p, p);
+				ep2_mul_cof_bn(r, p);
 				break;
 			case EP_B12:
-				ep2_mul_cof_b12(p, p);
+				ep2_mul_cof_b12(r, p);
 				break;
 			default:
 				/* Now, multiply by cofactor to get the correct group. */
 				ep2_curve_get_cof(k);
 				if (bn_bits(k) < RLC_DIG) {
-					ep2_mul_dig(p, p, k->dp[0]);
+					ep2_mul_dig(r, p, k->dp[0]);
 				} else {
-					ep2_mul_basic(p, p, k);
+					ep2_mul_basic(r, p, k);
 				}
 				break;
 		}
@@ -288,8 +492,248 @@ void ep2_map_dst(ep2_t p, const uint8_t *msg, int len, const uint8_t *dst, int d
 	}
 	RLC_FINALLY {
 		bn_free(k);
-		fp2_free(t);
-		ep2_free(q);
+	}
+}
+
+/**
+ * Converts many points to affine coordinates with a single inversion, taking
+ * care of points at infinity.
+ *
+ * @param[in,out] p			- the points to convert.
+ * @param[in] n				- the number of points.
+ */
+static void ep2_map_norm_sim(ep2_t *p, int n) {
+	int *inf = RLC_ALLOCA(int, n);
+
+	RLC_TRY {
+		if (inf == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (int i = 0; i < n; i++) {
+			inf[i] = ep2_is_infty(p[i]);
+			if (inf[i]) {
+				fp2_set_dig(p[i]->z, 1);
+				p[i]->coord = BASIC;
+			}
+		}
+		ep2_norm_sim(p, p, n);
+		for (int i = 0; i < n; i++) {
+			if (inf[i]) {
+				ep2_set_infty(p[i]);
+			}
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		RLC_FREE(inf);
+	}
+}
+
+/**
+ * Maps a pseudorandom string expanded from a message to a point in an elliptic
+ * curve over a quadratic extension, applying the isogeny and clearing the
+ * cofactor.
+ *
+ * @param[out] p			- the result.
+ * @param[in] buf			- the pseudorandom string.
+ * @param[in] len			- the number of bytes per field element.
+ */
+static void ep2_map_bytes(ep2_t p, const uint8_t *buf, int len) {
+	ep2_map_sum(p, buf, len);
+	TMPL_MAP_CALL_ISOMAP(ep2, p);
+	ep2_map_cof(p, p);
+	ep2_norm(p, p);
+}
+
+/**
+ * Maps many byte arrays to points in an elliptic curve over a quadratic
+ * extension, sharing the inversions needed before the isogeny and in the
+ * final normalization. The byte arrays are expanded eight at a time only
+ * when MD_MAP is SH256.
+ *
+ * @param[out] p			- the results.
+ * @param[in] msg			- the byte arrays to map.
+ * @param[in] len			- the array lengths in bytes.
+ * @param[in] n				- the number of byte arrays.
+ * @param[in] dst			- the domain separation tag.
+ * @param[in] dst_len		- the domain separation tag length in bytes.
+ */
+static void ep2_map_dst_sim(ep2_t *p, uint8_t *msg[], int len[], int n,
+		const uint8_t *dst, int dst_len) {
+	/* enough space for two extension field elements plus extra bytes for uniformity */
+	const int len_per_elm = (FP_PRIME + ep_param_level() + 7) / 8;
+	/* hash up to eight messages at once when the hash supports it */
+	uint8_t *pseudo_random_bytes = RLC_ALLOCA(uint8_t, 8 * 4 * len_per_elm);
+
+	RLC_TRY {
+		if (pseudo_random_bytes == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+
+#if MD_MAP == SH256
+		for (int i = 0; i < n; i += 8) {
+			const int m = RLC_MIN(8, n - i);
+			md_xmd_sh256_many(pseudo_random_bytes, 4 * len_per_elm,
+					(const uint8_t **)msg + i, len + i, m, dst, dst_len);
+			for (int j = 0; j < m; j++) {
+				ep2_map_sum(p[i + j], pseudo_random_bytes + 4 * j * len_per_elm,
+						len_per_elm);
+			}
+		}
+#else
+		for (int i = 0; i < n; i++) {
+			md_xmd(pseudo_random_bytes, 4 * len_per_elm, msg[i], len[i], dst,
+					dst_len);
+			ep2_map_sum(p[i], pseudo_random_bytes, len_per_elm);
+		}
+#endif
+#ifdef EP_CTMAP
+		if (ep2_curve_is_ctmap()) {
+			ep2_map_norm_sim(p, n);
+			for (int i = 0; i < n; i++) {
+				TMPL_MAP_CALL_ISOMAP(ep2, p[i]);
+			}
+		}
+#endif
+		for (int i = 0; i < n; i++) {
+			ep2_map_cof(p[i], p[i]);
+		}
+		ep2_map_norm_sim(p, n);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		RLC_FREE(pseudo_random_bytes);
+	}
+}
+
+#if MULTI == PTHREAD || MULTI == OPENMP
+
+/**
+ * Arguments of a batch of hashes split among threads.
+ */
+typedef struct {
+	/** The results. */
+	ep2_t *p;
+	/** The byte arrays to map. */
+	uint8_t **msg;
+	/** The array lengths in bytes. */
+	int *len;
+	/** The number of byte arrays. */
+	int n;
+	/** The domain separation tag. */
+	const uint8_t *dst;
+	/** The domain separation tag length in bytes. */
+	int dst_len;
+} ep2_map_t;
+
+/**
+ * Computes a share of a batch of hashes.
+ *
+ * @param[in,out] args		- the batch of hashes.
+ * @param[in] i				- the index of the share.
+ * @param[in] c				- the number of shares.
+ */
+static void ep2_map_dst_job(void *args, int i, int c) {
+	ep2_map_t *job = (ep2_map_t *)args;
+	int m = RLC_CEIL(job->n, c), j = RLC_MIN(i * m, job->n);
+
+	m = RLC_MIN(m, job->n - j);
+	if (m > 0) {
+		ep2_map_dst_sim(job->p + j, job->msg + j, job->len + j, m, job->dst,
+				job->dst_len);
+	}
+}
+
+#endif /* MULTI == PTHREAD || MULTI == OPENMP */
+
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+void ep2_map_dst(ep2_t p, const uint8_t *msg, int len, const uint8_t *dst, int dst_len) {
+	/* enough space for two extension field elements plus extra bytes for uniformity */
+	const int len_per_elm = (FP_PRIME + ep_param_level() + 7) / 8;
+	uint8_t *pseudo_random_bytes = RLC_ALLOCA(uint8_t, 4 * len_per_elm);
+
+	RLC_TRY {
+		if (pseudo_random_bytes == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+
+		/* XXX(rsw) See note in ep/relic_ep_map.c about using MD_MAP. */
+		/* hash to a pseudorandom string using md_xmd */
+		md_xmd(pseudo_random_bytes, 4 * len_per_elm, msg, len, dst, dst_len);
+
+		ep2_map_bytes(p, pseudo_random_bytes, len_per_elm);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		RLC_FREE(pseudo_random_bytes);
+	}
+}
+
+void ep2_map_dst_batch(ep2_t *p, uint8_t *msg[], int len[], int n,
+		const uint8_t *dst, int dst_len) {
+	if (n <= 0) {
+		return;
+	}
+#if MULTI == PTHREAD || MULTI == OPENMP
+	if (n >= RLC_EPX_MAP_MULTI && core_get_threads() > 1) {
+		ep2_map_t job = { p, msg, len, n, dst, dst_len };
+		core_run(ep2_map_dst_job, &job, core_get_threads());
+		return;
+	}
+#endif
+	ep2_map_dst_sim(p, msg, len, n, dst, dst_len);
+}
+
+void ep2_map_dst_ctx(ep2_t p, const uint8_t *msg, int len,
+		const md_xmd_ctx_t ctx) {
+	/* enough space for two extension field elements plus extra bytes for uniformity */
+	const int len_per_elm = (FP_PRIME + ep_param_level() + 7) / 8;
+	uint8_t *pseudo_random_bytes = RLC_ALLOCA(uint8_t, 4 * len_per_elm);
+
+	RLC_TRY {
+		if (pseudo_random_bytes == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+
+		md_xmd_ctx_run(pseudo_random_bytes, 4 * len_per_elm, msg, len, ctx);
+
+		ep2_map_bytes(p, pseudo_random_bytes, len_per_elm);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		RLC_FREE(pseudo_random_bytes);
+	}
+}
+
+void ep2_map_dst_stream(ep2_t p, md_ctx_t ctx, const uint8_t *dst,
+		int dst_len) {
+	const int len_per_elm = (FP_PRIME + ep_param_level() + 7) / 8;
+	uint8_t *pseudo_random_bytes = RLC_ALLOCA(uint8_t, 4 * len_per_elm);
+
+	RLC_TRY {
+		if (pseudo_random_bytes == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+
+		md_xmd_final(pseudo_random_bytes, 4 * len_per_elm, ctx, dst, dst_len);
+
+		ep2_map_bytes(p, pseudo_random_bytes, len_per_elm);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
 		RLC_FREE(pseudo_random_bytes);
 	}
 }
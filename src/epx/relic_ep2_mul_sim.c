@@ -376,6 +376,492 @@ static void ep2_mul_sim_plain(ep2_t r, ep2_t p, bn_t k, ep2_t q, bn_t m,
 
 #endif /* EP_SIM == INTER */
 
+/**
+ * Multiplies and adds a small number of elements from G_2 simultaneously by
+ * interleaving the NAFs of their subscalars.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the points to multiply.
+ * @param[in] k				- the integer scalars.
+ * @param[in] n				- the number of points to multiply.
+ */
+static void ep2_mul_sim_lot_inter(ep2_t r, ep2_t p[], const bn_t k[], int n) {
+	const int len = RLC_FP_BITS + 1;
+	int i, j, m, l, *_l = RLC_ALLOCA(int, 4 * n);
+	bn_t _k[4];
+	int8_t *naf = RLC_ALLOCA(int8_t, 4 * n * len);
+	ep2_t *_p = RLC_ALLOCA(ep2_t, 4 * n);
+
+	RLC_TRY {
+		if (_l == NULL || naf == NULL || _p == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (j = 0; j < 4; j++) {
+			bn_null(_k[j]);
+			bn_new(_k[j]);
+			for (i = 0; i < n; i++) {
+				ep2_null(_p[4*i + j]);
+				ep2_new(_p[4*i + j]);
+			}
+		}
+
+		for (int i = 0; i < n; i++) {
+			ep2_norm(_p[4*i], p[i]);
+			ep2_frb(_p[4*i + 1], _p[4*i], 1);
+			ep2_frb(_p[4*i + 2], _p[4*i + 1], 1);
+			ep2_frb(_p[4*i + 3], _p[4*i + 2], 1);
+		}
+
+		l = 0;
+		for (i = 0; i < n; i++) {
+			ep2_glv(_k, k[i]);
+			for (j = 0; j < 4; j++) {
+				_l[4*i + j] = len;
+				bn_rec_naf(&naf[(4*i + j)*len], &_l[4*i + j], _k[j], 2);
+				if (bn_sign(_k[j]) == RLC_NEG) {
+					ep2_neg(_p[4*i + j], _p[4*i + j]);
+				}
+				l = RLC_MAX(l, _l[4*i + j]);
+			}
+		}
+
+		for (i = 0; i < n; i++) {
+			for (j = 0; j < 4; j++) {
+				for (m = _l[4*i + j]; m < l; m++) {
+					naf[(4*i + j)*len + m] = 0;
+				}
+			}
+		}
+
+		ep2_set_infty(r);
+		for (i = l - 1; i >= 0; i--) {
+			ep2_dbl(r, r);
+			for (j = 0; j < n; j++) {
+				for (m = 0; m < 4; m++) {
+					if (naf[(4*j + m)*len + i] > 0) {
+						ep2_add(r, r, _p[4*j + m]);
+					}
+					if (naf[(4*j + m)*len + i] < 0) {
+						ep2_sub(r, r, _p[4*j + m]);
+					}
+				}
+			}
+		}
+
+		/* Convert r to affine coordinates. */
+		ep2_norm(r, r);
+	} RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	} RLC_FINALLY {
+		for (j = 0; j < 4; j++) {
+			bn_free(_k[j]);
+			for (i = 0; _p != NULL && i < n; i++) {
+				ep2_free(_p[4*i + j]);
+			}
+		}
+		RLC_FREE(_l);
+		RLC_FREE(_p);
+		RLC_FREE(naf);
+	}
+}
+
+/**
+ * Accumulates the points selected by one window of the recoded subscalars into
+ * buckets kept in affine coordinates. Additions into distinct buckets are
+ * independent, so they are performed in rounds that share a single
+ * simultaneous inversion. Points landing on a bucket that is already being
+ * updated in the current round are deferred to the next one.
+ *
+ * @param[in,out] b			- the buckets, c for each subscalar.
+ * @param[in] c				- the number of buckets per subscalar.
+ * @param[in] a				- the points to multiply in affine coordinates.
+ * @param[in] n				- the number of points to multiply.
+ * @param[in] win			- the recoded subscalars.
+ * @param[in] z				- the number of windows per subscalar.
+ * @param[in] i				- the index of the window to process.
+ */
+static void ep2_mul_sim_lot_acc(ep2_t *b, int c, ep2_t *a, int n,
+		const int16_t *win, int z, int i) {
+	int j, d, l, m, t, *e = RLC_ALLOCA(int, 4 * n), *f = RLC_ALLOCA(int, 5 * c);
+	fp2_t u, v, *den = RLC_ALLOCA(fp2_t, c);
+	ep2_t *q = RLC_ALLOCA(ep2_t, c);
+
+	fp2_null(u);
+	fp2_null(v);
+	for (j = 0; den != NULL && q != NULL && j < c; j++) {
+		fp2_null(den[j]);
+		ep2_null(q[j]);
+	}
+
+	RLC_TRY {
+		if (e == NULL || f == NULL || den == NULL || q == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		fp2_new(u);
+		fp2_new(v);
+		for (j = 0; j < c; j++) {
+			fp2_new(den[j]);
+			ep2_new(q[j]);
+		}
+
+		/* Collect the points with nonzero digits in this window. */
+		m = 0;
+		for (j = 0; j < 4 * n; j++) {
+			if (win[j * z + i] != 0) {
+				e[m++] = j;
+			}
+		}
+
+		while (RLC_MIN(m, c) >= 32) {
+			for (j = 0; j < 4 * c; j++) {
+				f[j] = 0;
+			}
+			t = l = 0;
+			for (j = 0; j < m; j++) {
+				d = win[e[j] * z + i];
+				d = (e[j] % 4) * c + (d > 0 ? d : -d) - 1;
+				if (f[d] || t == c) {
+					/* Bucket is busy in this round, defer the point. */
+					e[l++] = e[j];
+					continue;
+				}
+				f[d] = 1;
+
+				ep2_copy(q[t], a[e[j] / 4]);
+				if (win[e[j] * z + i] < 0) {
+					ep2_neg(q[t], q[t]);
+				}
+				if (ep2_is_infty(q[t])) {
+					continue;
+				}
+				if (ep2_is_infty(b[d])) {
+					ep2_copy(b[d], q[t]);
+					continue;
+				}
+				fp2_sub(den[t], q[t]->x, b[d]->x);
+				if (fp2_is_zero(den[t])) {
+					/* Handle doublings and inverses out of the batch. */
+					if (fp2_cmp(q[t]->y, b[d]->y) == RLC_EQ) {
+						ep2_dbl(b[d], b[d]);
+						ep2_norm(b[d], b[d]);
+					} else {
+						ep2_set_infty(b[d]);
+					}
+					continue;
+				}
+				f[4 * c + t] = d;
+				t++;
+			}
+
+			if (t > 0) {
+				fp2_inv_sim(den, den, t);
+			}
+			for (j = 0; j < t; j++) {
+				d = f[4 * c + j];
+				/* u = lambda = (y2 - y1)/(x2 - x1). */
+				fp2_sub(u, q[j]->y, b[d]->y);
+				fp2_mul(u, u, den[j]);
+				/* x3 = lambda^2 - x1 - x2. */
+				fp2_sqr(v, u);
+				fp2_sub(v, v, b[d]->x);
+				fp2_sub(v, v, q[j]->x);
+				/* y3 = lambda * (x1 - x3) - y1. */
+				fp2_sub(b[d]->x, b[d]->x, v);
+				fp2_mul(b[d]->x, b[d]->x, u);
+				fp2_sub(b[d]->y, b[d]->x, b[d]->y);
+				fp2_copy(b[d]->x, v);
+			}
+			m = l;
+		}
+
+		/* Few additions do not amortize an inversion, so finish them in
+		 * projective coordinates. */
+		for (j = 0; j < m; j++) {
+			d = win[e[j] * z + i];
+			ep2_copy(q[0], a[e[j] / 4]);
+			if (d < 0) {
+				ep2_neg(q[0], q[0]);
+				d = -d;
+			}
+			d = (e[j] % 4) * c + d - 1;
+			ep2_add(b[d], b[d], q[0]);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		fp2_free(u);
+		fp2_free(v);
+		for (j = 0; den != NULL && q != NULL && j < c; j++) {
+			fp2_free(den[j]);
+			ep2_free(q[j]);
+		}
+		RLC_FREE(e);
+		RLC_FREE(f);
+		RLC_FREE(den);
+		RLC_FREE(q);
+	}
+}
+
+/**
+ * Multiplies and adds many elements from G_2 simultaneously using the bucket
+ * method by Pippenger. The subscalars are recoded in signed windows of w bits
+ * and, for each window, points are accumulated into 2^(w-1) buckets per
+ * subscalar. Buckets are combined with a running sum and the Frobenius map is
+ * applied to the partial sums, not to the points.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the points to multiply.
+ * @param[in] k				- the integer scalars.
+ * @param[in] n				- the number of points to multiply.
+ * @param[in] basic			- the flag to keep the buckets in affine coordinates.
+ */
+static void ep2_mul_sim_lot_bucket(ep2_t r, ep2_t p[], const bn_t k[], int n,
+		int basic) {
+	int i, j, l, m, d, c, w, z, cost, min;
+	int16_t *win = NULL, *_w;
+	dig_t t0;
+	bn_t _k[4];
+	ep2_t s, t, u, v, *a = NULL, *b = NULL;
+
+	ep2_null(s);
+	ep2_null(t);
+	ep2_null(u);
+	ep2_null(v);
+	for (i = 0; i < 4; i++) {
+		bn_null(_k[i]);
+	}
+
+	RLC_TRY {
+		ep2_new(s);
+		ep2_new(t);
+		ep2_new(u);
+		ep2_new(v);
+		for (i = 0; i < 4; i++) {
+			bn_new(_k[i]);
+		}
+
+		/* Compute the maximum length of the subscalars. */
+		l = 0;
+		for (i = 0; i < n; i++) {
+			ep2_glv(_k, k[i]);
+			for (j = 0; j < 4; j++) {
+				l = RLC_MAX(l, bn_bits(_k[j]));
+			}
+		}
+
+		/* Choose the window size minimizing the number of additions. */
+		w = 2;
+		min = RLC_CEIL(l + 1, w) * (n + (1 << w));
+		for (i = 3; i < RLC_MIN(RLC_DIG, 15); i++) {
+			cost = RLC_CEIL(l + 1, i) * (n + (1 << i));
+			if (cost < min) {
+				min = cost;
+				w = i;
+			}
+		}
+		c = (1 << (w - 1));
+		z = RLC_CEIL(l + 1, w);
+
+		win = RLC_ALLOCA(int16_t, 4 * n * z);
+		b = RLC_ALLOCA(ep2_t, 4 * c);
+		if (win == NULL || b == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < 4 * c; i++) {
+			ep2_null(b[i]);
+			ep2_new(b[i]);
+		}
+
+		if (basic) {
+			/* Convert the points to affine coordinates once, instead of once
+			 * per window. */
+			a = RLC_ALLOCA(ep2_t, n);
+			if (a == NULL) {
+				RLC_THROW(ERR_NO_MEMORY);
+			}
+			for (i = 0; i < n; i++) {
+				ep2_null(a[i]);
+				ep2_new(a[i]);
+			}
+			ep2_norm_sim(a, p, n);
+		}
+
+		/* Recode subscalars in signed windows with digits in [-c, c]. */
+		for (i = 0; i < n; i++) {
+			ep2_glv(_k, k[i]);
+			for (j = 0; j < 4; j++) {
+				_w = &win[(4 * i + j) * z];
+				m = bn_sign(_k[j]);
+				bn_abs(_k[j], _k[j]);
+				for (d = 0; d < z; d++) {
+					bn_get_dig(&t0, _k[j]);
+					_w[d] = t0 & RLC_MASK(w);
+					bn_rsh(_k[j], _k[j], w);
+					if (_w[d] > c) {
+						_w[d] -= (1 << w);
+						bn_add_dig(_k[j], _k[j], 1);
+					}
+				}
+				if (m == RLC_NEG) {
+					for (d = 0; d < z; d++) {
+						_w[d] = -_w[d];
+					}
+				}
+			}
+		}
+
+		ep2_set_infty(s);
+		for (i = z - 1; i >= 0; i--) {
+			for (j = 0; j < w && i < z - 1; j++) {
+				ep2_dbl(s, s);
+			}
+			for (j = 0; j < 4 * c; j++) {
+				ep2_set_infty(b[j]);
+			}
+			if (basic) {
+				ep2_mul_sim_lot_acc(b, c, a, n, win, z, i);
+			} else {
+				for (j = 0; j < n; j++) {
+					for (m = 0; m < 4; m++) {
+						d = win[(4 * j + m) * z + i];
+						if (d > 0) {
+							ep2_add(b[m * c + d - 1], b[m * c + d - 1], p[j]);
+						}
+						if (d < 0) {
+							ep2_sub(b[m * c - d - 1], b[m * c - d - 1], p[j]);
+						}
+					}
+				}
+			}
+			/* Compute \sum_m psi^m(\sum_j j * b[m * c + j - 1]). */
+			ep2_set_infty(t);
+			for (m = 3; m >= 0; m--) {
+				ep2_frb(t, t, 1);
+				ep2_set_infty(u);
+				ep2_set_infty(v);
+				for (j = c - 1; j >= 0; j--) {
+					ep2_add(u, u, b[m * c + j]);
+					ep2_add(v, v, u);
+				}
+				ep2_add(t, t, v);
+			}
+			ep2_add(s, s, t);
+		}
+		/* Convert r to affine coordinates. */
+		ep2_norm(r, s);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		ep2_free(s);
+		ep2_free(t);
+		ep2_free(u);
+		ep2_free(v);
+		for (i = 0; i < 4; i++) {
+			bn_free(_k[i]);
+		}
+		if (a != NULL) {
+			for (i = 0; i < n; i++) {
+				ep2_free(a[i]);
+			}
+		}
+		if (b != NULL) {
+			for (i = 0; i < 4 * c; i++) {
+				ep2_free(b[i]);
+			}
+		}
+		RLC_FREE(win);
+		RLC_FREE(a);
+		RLC_FREE(b);
+	}
+}
+
+#if MULTI == PTHREAD || MULTI == OPENMP
+
+/**
+ * Arguments of a simultaneous multiplication in G_2 split among threads.
+ */
+typedef struct {
+	/** The partial results, one per share. */
+	ep2_t *t;
+	/** The points to multiply. */
+	ep2_t *p;
+	/** The integer scalars. */
+	const bn_t *k;
+	/** The number of points to multiply. */
+	int n;
+} ep2_lot_t;
+
+/**
+ * Computes a share of a simultaneous multiplication in G_2.
+ *
+ * @param[in,out] args		- the simultaneous multiplication.
+ * @param[in] i				- the index of the share.
+ * @param[in] c				- the number of shares.
+ */
+static void ep2_mul_sim_lot_job(void *args, int i, int c) {
+	ep2_lot_t *job = (ep2_lot_t *)args;
+	int m = RLC_CEIL(job->n, c), j = RLC_MIN(i * m, job->n);
+
+	m = RLC_MIN(m, job->n - j);
+	if (m == 0) {
+		ep2_set_infty(job->t[i]);
+	} else {
+		ep2_mul_sim_lot_bucket(job->t[i], job->p + j, job->k + j, m,
+				m >= RLC_EPX_LOT_BASIC);
+	}
+}
+
+/**
+ * Multiplies and adds many elements from G_2 simultaneously by splitting the
+ * points among core_get_threads() threads and adding the partial results.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the points to multiply.
+ * @param[in] k				- the integer scalars.
+ * @param[in] n				- the number of points to multiply.
+ */
+static void ep2_mul_sim_lot_multi(ep2_t r, ep2_t p[], const bn_t k[], int n) {
+	const int c = core_get_threads();
+	int i;
+	ep2_t *t = RLC_ALLOCA(ep2_t, c);
+	ep2_lot_t job = { t, p, k, n };
+
+	RLC_TRY {
+		if (t == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < c; i++) {
+			ep2_null(t[i]);
+			ep2_new(t[i]);
+		}
+
+		core_run(ep2_mul_sim_lot_job, &job, c);
+
+		ep2_set_infty(r);
+		for (i = 0; i < c; i++) {
+			ep2_add(r, r, t[i]);
+		}
+		ep2_norm(r, r);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		if (t != NULL) {
+			for (i = 0; i < c; i++) {
+				ep2_free(t[i]);
+			}
+		}
+		RLC_FREE(t);
+	}
+}
+
+#endif /* MULTI == PTHREAD || MULTI == OPENMP */
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -672,180 +1158,39 @@ void ep2_mul_sim_dig(ep2_t r, ep2_t p[], dig_t k[], int len) {
 }
 
 void ep2_mul_sim_lot(ep2_t r, ep2_t p[], const bn_t k[], int n) {
-	const int len = RLC_FP_BITS + 1;
-	int i, j, m, l, *_l = RLC_ALLOCA(int, 4 * n);
-	bn_t _k[4];
-	int8_t *naf = RLC_ALLOCA(int8_t, 4 * n * len);
-
-	if (n <= 10) {
-		ep2_t *_p = RLC_ALLOCA(ep2_t, 4 * n);
-
-		RLC_TRY {
-			for (j = 0; j < 4; j++) {
-				bn_null(_k[j]);
-				bn_new(_k[j]);
-				for (i = 0; i < n; i++) {
-					ep2_null(_p[4*i + j]);
-					ep2_new(_p[4*i + j]);
-				}
-			}
-
-			for (int i = 0; i < n; i++) {
-				ep2_norm(_p[4*i], p[i]);
-				ep2_frb(_p[4*i + 1], _p[4*i], 1);
-				ep2_frb(_p[4*i + 2], _p[4*i + 1], 1);
-				ep2_frb(_p[4*i + 3], _p[4*i + 2], 1);
-			}
-
-			l = 0;
-			for (i = 0; i < n; i++) {
-				ep2_glv(_k, k[i]);
-				for (j = 0; j < 4; j++) {
-					_l[4*i + j] = len;
-					bn_rec_naf(&naf[(4*i + j)*len], &_l[4*i + j], _k[j], 2);
-					if (bn_sign(_k[j]) == RLC_NEG) {
-						ep2_neg(_p[4*i + j], _p[4*i + j]);
-					}
-					l = RLC_MAX(l, _l[4*i + j]);
-				}
-			}
-
-			for (i = 0; i < n; i++) {
-				for (j = 0; j < 4; j++) {
-					for (m = _l[4*i + j]; m < l; m++) {
-						naf[(4*i + j)*len + m] = 0;
-					}
-				}
-			}
+	if (n <= 0) {
+		ep2_set_infty(r);
+		return;
+	}
 
-			ep2_set_infty(r);
-			for (i = l - 1; i >= 0; i--) {
-				ep2_dbl(r, r);
-				for (j = 0; j < n; j++) {
-					for (m = 0; m < 4; m++) {
-						if (naf[(4*j + m)*len + i] > 0) {
-							ep2_add(r, r, _p[4*j + m]);
-						}
-						if (naf[(4*j + m)*len + i] < 0) {
-							ep2_sub(r, r, _p[4*j + m]);
-						}
-					}
-				}
-			}
+#if MULTI == PTHREAD || MULTI == OPENMP
+	if (n >= RLC_EPX_LOT_MULTI && core_get_threads() > 1) {
+		ep2_mul_sim_lot_multi(r, p, k, n);
+		return;
+	}
+#endif
 
-			/* Convert r to affine coordinates. */
-			ep2_norm(r, r);
-		} RLC_CATCH_ANY {
-			RLC_THROW(ERR_CAUGHT);
-		} RLC_FINALLY {
-			for (j = 0; j < 4; j++) {
-				bn_free(_k[j]);
-				for (i = 0; i < n; i++) {
-					ep2_free(_p[4*i + j]);
-				}
-			}
-		}
-		RLC_FREE(_l);
-		RLC_FREE(_p);
-		RLC_FREE(naf);
+	if (n <= 10) {
+		ep2_mul_sim_lot_inter(r, p, k, n);
 	} else {
-		const int w = RLC_MAX(2, util_bits_dig(n) - 2), c = (1 << (w - 2));
-		ep2_t s, t, u, v, *_p = RLC_ALLOCA(ep2_t, 4 * c);
-		int8_t ptr;
-
-		RLC_TRY {
-			ep2_null(s);
-			ep2_null(t);
-			ep2_null(u);
-			ep2_null(v);
-			ep2_new(s);
-			ep2_new(t);
-			ep2_new(u);
-			ep2_new(v);
-			for (i = 0; i < 4; i++) {
-				bn_null(_k[i]);
-				bn_new(_k[i]);
-				for (j = 0; j < c; j++) {
-					ep2_null(_p[i*c + j]);
-					ep2_new(_p[i*c + j]);
-					ep2_set_infty(_p[i*c + j]);
-				}
-			}
-
-			l = 0;
-			for (i = 0; i < n; i++) {
-				ep2_glv(_k, k[i]);
-				for (j = 0; j < 4; j++) {
-					_l[4*i + j] = len;
-					bn_rec_naf(&naf[(4*i + j)*len], &_l[4*i + j], _k[j], w);
-					l = RLC_MAX(l, _l[4*i + j]);
-				}
-			}
+		ep2_mul_sim_lot_bucket(r, p, k, n, n >= RLC_EPX_LOT_BASIC);
+	}
+}
 
-			for (i = 0; i < n; i++) {
-				for (j = 0; j < 4; j++) {
-					for (m = _l[4*i + j]; m < l; m++) {
-						naf[(4*i + j)*len + m] = 0;
-					}
-				}
-			}
+void ep2_mul_sim_lot_projc(ep2_t r, ep2_t p[], const bn_t k[], int n) {
+	if (n <= 0) {
+		ep2_set_infty(r);
+		return;
+	}
 
-			ep2_set_infty(s);
-			for (i = l - 1; i >= 0; i--) {
-				for (j = 0; j < n; j++) {
-					for (m = 0; m < 4; m++) {
-						ptr = naf[(4*j + m)*len + i];
-						if (ptr != 0) {
-							ep2_copy(t, p[j]);
-							if (ptr < 0) {
-								ptr = -ptr;
-								ep2_neg(t, t);
-							}
-							if (bn_sign(_k[m]) == RLC_NEG) {
-								ep2_neg(t, t);
-							}
-							ep2_add(_p[m*c + (ptr >> 1)], _p[m*c + (ptr >> 1)], t);
-						}
-					}
-				}
+	ep2_mul_sim_lot_bucket(r, p, k, n, 0);
+}
 
-				ep2_set_infty(t);
-				for (m = 3; m >= 0; m--) {
-					ep2_frb(t, t, 1);
-					ep2_set_infty(u);
-					ep2_set_infty(v);
-					for (j = c - 1; j >= 0; j--) {
-						ep2_add(u, u, _p[m*c + j]);
-						if (j == 0) {
-							ep2_dbl(v, v);
-						}
-						ep2_add(v, v, u);
-						ep2_set_infty(_p[m*c + j]);
-					}
-					ep2_add(t, t, v);
-				}
-				ep2_dbl(s, s);
-				ep2_add(s, s, t);
-			}
-
-			/* Convert r to affine coordinates. */
-			ep2_norm(r, s);
-		} RLC_CATCH_ANY {
-			RLC_THROW(ERR_CAUGHT);
-		} RLC_FINALLY {
-			ep2_free(s);
-			ep2_free(t);
-			ep2_free(u);
-			ep2_free(v);
-			for (i = 0; i < 4; i++) {
-				bn_free(_k[i]);
-				for (j = 0; j < c; j++) {
-					ep2_free(_p[i*c + j]);
-				}
-			}
-		}
-		RLC_FREE(_l);
-		RLC_FREE(_p);
-		RLC_FREE(naf);
+void ep2_mul_sim_lot_basic(ep2_t r, ep2_t p[], const bn_t k[], int n) {
+	if (n <= 0) {
+		ep2_set_infty(r);
+		return;
 	}
+
+	ep2_mul_sim_lot_bucket(r, p, k, n, 1);
 }
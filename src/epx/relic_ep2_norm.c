@@ -81,6 +81,69 @@ static void ep2_norm_imp(ep2_t r, ep2_t p, int inverted) {
 
 #endif /* EP_ADD == PROJC */
 
+/**
+ * Multiplies quadratic extension field elements pairwise, batching the
+ * underlying prime field multiplications through the vector interface.
+ *
+ * @param[out] c			- the results.
+ * @param[in] a				- the first elements to multiply.
+ * @param[in] b				- the second elements to multiply.
+ * @param[in] n				- the number of elements.
+ */
+static void ep2_mul_vec(fp2_t *c, fp2_t *a, fp2_t *b, int n) {
+	int i, j, qnr = fp_prime_get_qnr();
+	fp_t *s = RLC_ALLOCA(fp_t, 3 * n);
+	fp_t *t = RLC_ALLOCA(fp_t, 3 * n);
+
+	RLC_TRY {
+		if (s == NULL || t == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < 3 * n; i++) {
+			fp_null(s[i]);
+			fp_null(t[i]);
+			fp_new(s[i]);
+			fp_new(t[i]);
+		}
+
+		/* Karatsuba: a_0 * b_0, a_1 * b_1 and (a_0 + a_1) * (b_0 + b_1). */
+		for (i = 0; i < n; i++) {
+			fp_copy(s[i], a[i][0]);
+			fp_copy(s[n + i], a[i][1]);
+			fp_add(s[2 * n + i], a[i][0], a[i][1]);
+			fp_copy(t[i], b[i][0]);
+			fp_copy(t[n + i], b[i][1]);
+			fp_add(t[2 * n + i], b[i][0], b[i][1]);
+		}
+		fp_mul_vec(s, (const fp_t *)s, (const fp_t *)t, 3 * n);
+
+		for (i = 0; i < n; i++) {
+			/* c_1 = (a_0 + a_1) * (b_0 + b_1) - a_0 * b_0 - a_1 * b_1. */
+			fp_sub(c[i][1], s[2 * n + i], s[i]);
+			fp_sub(c[i][1], c[i][1], s[n + i]);
+			/* c_0 = a_0 * b_0 + u^2 * a_1 * b_1. */
+			fp_copy(c[i][0], s[i]);
+			for (j = 0; j > qnr; j--) {
+				fp_sub(c[i][0], c[i][0], s[n + i]);
+			}
+			for (j = 0; j < qnr; j++) {
+				fp_add(c[i][0], c[i][0], s[n + i]);
+			}
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		for (i = 0; i < 3 * n; i++) {
+			fp_free(s[i]);
+			fp_free(t[i]);
+		}
+		RLC_FREE(s);
+		RLC_FREE(t);
+	}
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -103,27 +166,57 @@ void ep2_norm(ep2_t r, ep2_t p) {
 void ep2_norm_sim(ep2_t *r, ep2_t *t, int n) {
 	int i;
 	fp2_t *a = RLC_ALLOCA(fp2_t, n);
+	fp2_t *u = RLC_ALLOCA(fp2_t, 2 * n);
+	fp2_t *v = RLC_ALLOCA(fp2_t, 2 * n);
 
 	RLC_TRY {
-		if (a == NULL) {
+		if (a == NULL || u == NULL || v == NULL) {
 			RLC_THROW(ERR_NO_MEMORY);
 		}
 		for (i = 0; i < n; i++) {
 			fp2_null(a[i]);
 			fp2_new(a[i]);
-			fp2_copy(a[i], t[i]->z);
+			if (ep2_is_infty(t[i])) {
+				fp2_set_dig(a[i], 1);
+			} else {
+				fp2_copy(a[i], t[i]->z);
+			}
+		}
+		for (i = 0; i < 2 * n; i++) {
+			fp2_null(u[i]);
+			fp2_null(v[i]);
+			fp2_new(u[i]);
+			fp2_new(v[i]);
 		}
 
 		fp2_inv_sim(a, a, n);
 
+		/* u = z^(-2). */
+		ep2_mul_vec(u, a, a, n);
+		/* (v_0, v_1) = (z^(-1), x) * (z^(-2), z^(-2)) = (z^(-3), x * z^(-2)). */
+		for (i = 0; i < n; i++) {
+			fp2_copy(u[n + i], u[i]);
+			fp2_copy(v[i], a[i]);
+			fp2_copy(v[n + i], t[i]->x);
+		}
+		ep2_mul_vec(v, v, u, 2 * n);
+		/* u = y * z^(-3). */
 		for (i = 0; i < n; i++) {
-			fp2_copy(r[i]->x, t[i]->x);
-			fp2_copy(r[i]->y, t[i]->y);
-			fp2_copy(r[i]->z, a[i]);
+			fp2_copy(u[i], t[i]->y);
 		}
+		ep2_mul_vec(u, u, v, n);
 
 		for (i = 0; i < n; i++) {
-			ep2_norm_imp(r[i], r[i], 1);
+			if (ep2_is_infty(t[i])) {
+				ep2_set_infty(r[i]);
+			} else if (t[i]->coord == BASIC) {
+				ep2_copy(r[i], t[i]);
+			} else {
+				fp2_copy(r[i]->x, v[n + i]);
+				fp2_copy(r[i]->y, u[i]);
+				fp2_set_dig(r[i]->z, 1);
+				r[i]->coord = BASIC;
+			}
 		}
 	}
 	RLC_CATCH_ANY {
@@ -133,6 +226,12 @@ void ep2_norm_sim(ep2_t *r, ep2_t *t, int n) {
 		for (i = 0; i < n; i++) {
 			fp2_free(a[i]);
 		}
+		for (i = 0; i < 2 * n; i++) {
+			fp2_free(u[i]);
+			fp2_free(v[i]);
+		}
 		RLC_FREE(a);
+		RLC_FREE(u);
+		RLC_FREE(v);
 	}
 }
@@ -32,6 +32,98 @@
 
 #include "relic_core.h"
 
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Reads a prime elliptic curve point over a quadratic extension from a byte
+ * vector, reporting invalid encodings instead of throwing errors. Invalid
+ * points are set to infinity.
+ *
+ * @param[out] a			- the result.
+ * @param[in] bin			- the byte vector.
+ * @param[in] len			- the buffer capacity.
+ * @return 1 if the encoding is valid and the point is in the curve, 0 otherwise.
+ */
+static int ep2_read_bin_imp(ep2_t a, const uint8_t *bin, int len) {
+	int r;
+
+	if (len == 1) {
+		ep2_set_infty(a);
+		return (bin[0] == 0);
+	}
+
+	a->coord = BASIC;
+	fp_set_dig(a->z[0], 1);
+	fp_zero(a->z[1]);
+	fp2_read_bin(a->x, bin + 1, 2 * RLC_FP_BYTES);
+	if (len == 2 * RLC_FP_BYTES + 1) {
+		fp2_zero(a->y);
+		fp_set_bit(a->y[0], 0, bin[0] & 1);
+		r = (bin[0] == 2 || bin[0] == 3) && ep2_upk(a, a);
+	} else {
+		fp2_read_bin(a->y, bin + 2 * RLC_FP_BYTES + 1, 2 * RLC_FP_BYTES);
+		r = (bin[0] == 4) && ep2_on_curve(a);
+	}
+	if (!r) {
+		ep2_set_infty(a);
+	}
+	return r;
+}
+
+/**
+ * Reads many prime elliptic curve points over a quadratic extension stored
+ * contiguously in a byte vector.
+ *
+ * @param[out] a			- the results.
+ * @param[out] r			- the flags indicating which points are valid.
+ * @param[in] bin			- the byte vector.
+ * @param[in] len			- the buffer capacity of each point.
+ * @param[in] n				- the number of points.
+ */
+static void ep2_read_bin_sim(ep2_t *a, int *r, const uint8_t *bin,
+		int len, int n) {
+	for (int i = 0; i < n; i++) {
+		r[i] = ep2_read_bin_imp(a[i], bin + i * len, len);
+	}
+}
+
+#if MULTI == PTHREAD || MULTI == OPENMP
+
+/**
+ * Arguments of a batch of points split among threads.
+ */
+typedef struct {
+	/** The results. */
+	ep2_t *a;
+	/** The flags indicating which points are valid. */
+	int *r;
+	/** The byte vector. */
+	const uint8_t *bin;
+	/** The buffer capacity of each point. */
+	int len;
+	/** The number of points. */
+	int n;
+} ep2_read_t;
+
+/**
+ * Reads a share of a batch of points.
+ *
+ * @param[in,out] args		- the batch of points.
+ * @param[in] i				- the index of the share.
+ * @param[in] c				- the number of shares.
+ */
+static void ep2_read_bin_job(void *args, int i, int c) {
+	ep2_read_t *job = (ep2_read_t *)args;
+	int m = RLC_CEIL(job->n, c), j = RLC_MIN(i * m, job->n);
+
+	ep2_read_bin_sim(job->a + j, job->r + j, job->bin + j * job->len, job->len,
+			RLC_MIN(m, job->n - j));
+}
+
+#endif /* MULTI == PTHREAD || MULTI == OPENMP */
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -285,6 +377,37 @@ void ep2_read_bin(ep2_t a, const uint8_t *bin, int len) {
 	}
 }
 
+int ep2_read_bin_batch(ep2_t *a, int *r, const uint8_t *bin, int len,
+		int n) {
+	int i, c = 0, multi = 0;
+
+	if (n <= 0) {
+		return 0;
+	}
+
+	if (len != 1 && len != (2 * RLC_FP_BYTES + 1) &&
+			len != (4 * RLC_FP_BYTES + 1)) {
+		RLC_THROW(ERR_NO_BUFFER);
+		return 0;
+	}
+
+#if MULTI == PTHREAD || MULTI == OPENMP
+	multi = (n >= RLC_EPX_READ_MULTI && core_get_threads() > 1);
+	if (multi) {
+		ep2_read_t job = { a, r, bin, len, n };
+		core_run(ep2_read_bin_job, &job, core_get_threads());
+	}
+#endif
+	if (!multi) {
+		ep2_read_bin_sim(a, r, bin, len, n);
+	}
+
+	for (i = 0; i < n; i++) {
+		c += r[i];
+	}
+	return c;
+}
+
 void ep2_write_bin(uint8_t *bin, int len, ep2_t a, int pack) {
 	ep2_t t;
 
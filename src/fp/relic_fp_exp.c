@@ -189,3 +189,127 @@ void fp_exp_monty(fp_t c, const fp_t a, const bn_t b) {
 }
 
 #endif
+
+void fp_exp_chain(fp_t c, const fp_t a, int id) {
+	ctx_t *ctx = core_get();
+	const uint8_t *win = ctx->exp_win[id];
+	fp_t t[1 << (RLC_FP_EXP_WIDTH - 1)], r;
+	int i, j, tab = ctx->exp_tab[id];
+
+	if (ctx->exp_len[id] == 0) {
+		fp_set_dig(c, 1);
+		return;
+	}
+
+	fp_null(r);
+	for (i = 0; i < tab; i++) {
+		fp_null(t[i]);
+	}
+
+	RLC_TRY {
+		fp_new(r);
+		for (i = 0; i < tab; i++) {
+			fp_new(t[i]);
+		}
+
+		/* Compute only the odd powers used by the recoding. */
+		fp_copy(t[0], a);
+		if (tab > 1) {
+			fp_sqr(r, a);
+			for (i = 1; i < tab; i++) {
+				fp_mul(t[i], t[i - 1], r);
+			}
+		}
+
+		/* The leading window is never zero, so start from its power. */
+		fp_copy(r, t[win[0] >> 1]);
+		for (i = 1; i < ctx->exp_len[id]; i++) {
+			if (win[i] == 0) {
+				fp_sqr(r, r);
+			} else {
+				for (j = 0; j < util_bits_dig(win[i]); j++) {
+					fp_sqr(r, r);
+				}
+				fp_mul(r, r, t[win[i] >> 1]);
+			}
+		}
+		fp_copy(c, r);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		for (i = 0; i < tab; i++) {
+			fp_free(t[i]);
+		}
+		fp_free(r);
+	}
+}
+
+void fp_exp_chain_vec(fp_t *c, const fp_t *a, int id, int n) {
+	ctx_t *ctx = core_get();
+	const uint8_t *win = ctx->exp_win[id];
+	int i, j, k, tab = ctx->exp_tab[id];
+	fp_t *t;
+
+	if (n <= 0) {
+		return;
+	}
+	if (ctx->exp_len[id] == 0) {
+		for (k = 0; k < n; k++) {
+			fp_set_dig(c[k], 1);
+		}
+		return;
+	}
+
+	/* The odd power 2i + 1 of all elements is stored from t + i * n. */
+	t = RLC_ALLOCA(fp_t, tab * n);
+
+	RLC_TRY {
+		if (t == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < tab * n; i++) {
+			fp_null(t[i]);
+			fp_new(t[i]);
+		}
+
+		for (k = 0; k < n; k++) {
+			fp_copy(t[k], a[k]);
+		}
+		if (tab > 1) {
+			fp_sqr_vec(c, (const fp_t *)t, n);
+			for (i = 1; i < tab; i++) {
+				fp_mul_vec(t + i * n, (const fp_t *)t + (i - 1) * n,
+						(const fp_t *)c, n);
+			}
+		}
+
+		/* Walk the same windows as fp_exp_chain() on all elements at once. */
+		for (k = 0; k < n; k++) {
+			fp_copy(c[k], t[(win[0] >> 1) * n + k]);
+		}
+		for (i = 1; i < ctx->exp_len[id]; i++) {
+			if (win[i] == 0) {
+				fp_sqr_vec(c, (const fp_t *)c, n);
+			} else {
+				for (j = 0; j < util_bits_dig(win[i]); j++) {
+					fp_sqr_vec(c, (const fp_t *)c, n);
+				}
+				fp_mul_vec(c, (const fp_t *)c,
+						(const fp_t *)t + (win[i] >> 1) * n, n);
+			}
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		if (t != NULL) {
+			for (i = 0; i < tab * n; i++) {
+				fp_free(t[i]);
+			}
+		}
+		RLC_FREE(t);
+	}
+}
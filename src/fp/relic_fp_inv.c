@@ -40,29 +40,11 @@
 #if FP_INV == BASIC || !defined(STRIP)
 
 void fp_inv_basic(fp_t c, const fp_t a) {
-	bn_t e;
-
-	bn_null(e);
-
 	if (fp_is_zero(a)) {
 		RLC_THROW(ERR_NO_VALID);
 	}
 
-	RLC_TRY {
-		bn_new(e);
-
-		e->used = RLC_FP_DIGS;
-		dv_copy(e->dp, fp_prime_get(), RLC_FP_DIGS);
-		bn_sub_dig(e, e, 2);
-
-		fp_exp(c, a, e);
-	}
-	RLC_CATCH_ANY {
-		RLC_THROW(ERR_CAUGHT);
-	}
-	RLC_FINALLY {
-		bn_free(e);
-	}
+	fp_exp_chain(c, a, RLC_FP_EXP_INV);
 }
 
 #endif
@@ -39,6 +39,46 @@
 /* Private definitions                                                        */
 /*============================================================================*/
 
+/**
+ * Precomputes an addition chain for a fixed exponent. The chain is the
+ * sliding-window recoding of the exponent for the window width that minimizes
+ * the number of squarings and multiplications, including those needed to
+ * build the table of odd powers.
+ *
+ * @param[in] id			- the identifier of the exponent.
+ * @param[in] e				- the exponent.
+ */
+static void fp_prime_set_exp(int id, const bn_t e) {
+	ctx_t *ctx = core_get();
+	uint8_t win[RLC_FP_BITS + 1];
+	int i, l, w, cost, tab, best = 0;
+
+	ctx->exp_len[id] = ctx->exp_tab[id] = 0;
+	if (bn_is_zero(e)) {
+		return;
+	}
+
+	for (w = 1; w <= RLC_FP_EXP_WIDTH; w++) {
+		l = RLC_FP_BITS + 1;
+		bn_rec_slw(win, &l, e, w);
+		tab = 0;
+		cost = 0;
+		for (i = 0; i < l; i++) {
+			tab = RLC_MAX(tab, (win[i] >> 1) + 1);
+			if (i > 0) {
+				cost += (win[i] == 0 ? 1 : util_bits_dig(win[i]) + 1);
+			}
+		}
+		cost += (tab > 1 ? tab : 0);
+		if (best == 0 || cost < best) {
+			best = cost;
+			memcpy(ctx->exp_win[id], win, l);
+			ctx->exp_len[id] = l;
+			ctx->exp_tab[id] = tab;
+		}
+	}
+}
+
 /**
  * Assigns the prime field modulus.
  *
@@ -84,6 +124,19 @@ static void fp_prime_set(const bn_t p) {
 
 		#endif /* FP_RDC == MONTY */
 
+		/* Precompute chains for the fixed exponents, as the search for a
+		 * non-residue below may need them. Exponents that are not integers
+		 * are truncated and unused. */
+		bn_sub_dig(t, p, 2);
+		fp_prime_set_exp(RLC_FP_EXP_INV, t);
+		bn_rsh(t, p, 1);
+		fp_prime_set_exp(RLC_FP_EXP_LEG, t);
+		bn_add_dig(t, p, 1);
+		bn_rsh(t, t, 2);
+		fp_prime_set_exp(RLC_FP_EXP_SRT, t);
+		bn_rsh(t, p, 2);
+		fp_prime_set_exp(RLC_FP_EXP_ISR, t);
+
 		/* Now look for proper quadratic/cubic non-residues. */
 		ctx->qnr = ctx->cnr = 0;
 		bn_mod_dig(&(ctx->mod8), &(ctx->prime), 8);
@@ -108,7 +161,7 @@ static void fp_prime_set(const bn_t p) {
 				/* Check if it is a quadratic non-residue or find another. */
 				fp_set_dig(r, -ctx->qnr);
 				fp_neg(r, r);
-				while (fp_srt(r, r) == 1) {
+				while (fp_smb(r) == 1) {
 					ctx->qnr--;
 					fp_set_dig(r, -ctx->qnr);
 					fp_neg(r, r);
@@ -151,6 +204,8 @@ void fp_prime_init(void) {
 	ctx_t *ctx = core_get();
 	ctx->fp_id = 0;
 	bn_init(&(ctx->prime), RLC_FP_DIGS);
+	memset(ctx->exp_len, 0, sizeof(ctx->exp_len));
+	memset(ctx->exp_tab, 0, sizeof(ctx->exp_tab));
 #if FP_RDC == QUICK || !defined(STRIP)
 	ctx->sps_len = 0;
 	memset(ctx->sps, 0, sizeof(ctx->sps));
@@ -0,0 +1,137 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (C) 2007-2020 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+
+/**
+ * @file
+ *
+ * Implementation of the Legendre symbol in the prime field.
+ *
+ * @ingroup fp
+ */
+
+#include "relic_core.h"
+
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+#if FP_SMB == BASIC || !defined(STRIP)
+
+int fp_smb_basic(const fp_t a) {
+	fp_t t;
+	int r = 0;
+
+	fp_null(t);
+
+	RLC_TRY {
+		fp_new(t);
+
+		/* Compute a^((p - 1)/2), which is either 0, 1 or -1. */
+		fp_exp_chain(t, a, RLC_FP_EXP_LEG);
+		if (!fp_is_zero(t)) {
+			r = (fp_cmp_dig(t, 1) == RLC_EQ ? 1 : -1);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		fp_free(t);
+	}
+	return r;
+}
+
+#endif
+
+#if FP_SMB == BINAR || !defined(STRIP)
+
+int fp_smb_binar(const fp_t a) {
+	dv_t f, g, t;
+	dig_t d, c, u, odd, swp, s = 0;
+	int i, j, r = 0;
+
+	dv_null(f);
+	dv_null(g);
+	dv_null(t);
+
+	RLC_TRY {
+		dv_new(f);
+		dv_new(g);
+		dv_new(t);
+
+		/* In Montgomery form, a is multiplied by 2^(RLC_FP_DIGS * RLC_DIG),
+		 * an even power of two, which is a square and does not change the
+		 * symbol. So the representation can be used as is. */
+		dv_copy(g, a, RLC_FP_DIGS);
+		dv_copy(f, fp_prime_get(), RLC_FP_DIGS);
+
+		/* Each step removes at least one bit from f or g, so after enough
+		 * steps g = 0 and f = gcd(a, p). The steps keep f odd and the sign
+		 * of (g/f) is accumulated in s. The limb loops are written out so
+		 * that each step takes only a few passes over the operands. */
+		for (i = 0; i < 2 * RLC_FP_BITS; i++) {
+			odd = -(g[0] & 1);
+			/* Compute t = g - f, the final borrow tells if g < f. */
+			c = 0;
+			for (j = 0; j < RLC_FP_DIGS; j++) {
+				d = g[j] - f[j];
+				u = (g[j] < f[j]);
+				t[j] = d - c;
+				c = u | (d < c);
+			}
+			/* When g < f, swap them and apply quadratic reciprocity. */
+			swp = odd & -c;
+			s ^= swp & ((g[0] & f[0]) >> 1);
+			/* Set f = g if swapping and g = |g - f| if g is odd. */
+			c = swp & 1;
+			for (j = 0; j < RLC_FP_DIGS; j++) {
+				f[j] ^= swp & (f[j] ^ g[j]);
+				u = (t[j] ^ swp) + c;
+				c = (u < c);
+				g[j] ^= odd & (g[j] ^ u);
+			}
+			/* Halve g and apply (2/f) = -1 when f = 3 or 5 mod 8. */
+			for (j = 0; j < RLC_FP_DIGS - 1; j++) {
+				g[j] = (g[j] >> 1) | (g[j + 1] << (RLC_DIG - 1));
+			}
+			g[RLC_FP_DIGS - 1] >>= 1;
+			s ^= (f[0] + 2) >> 2;
+		}
+
+		if (!fp_is_zero(a)) {
+			r = 1 - 2 * (int)(s & 1);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		dv_free(f);
+		dv_free(g);
+		dv_free(t);
+	}
+	return r;
+}
+
+#endif
@@ -55,37 +55,31 @@ int fp_srt(fp_t c, const fp_t a) {
 		fp_new(t0);
 		fp_new(t1);
 
-		/* Make e = p. */
-		e->used = RLC_FP_DIGS;
-		dv_copy(e->dp, fp_prime_get(), RLC_FP_DIGS);
-
 		if (fp_prime_get_mod8() == 3 || fp_prime_get_mod8() == 7) {
 			/* Easy case, compute a^((p + 1)/4). */
-			bn_add_dig(e, e, 1);
-			bn_rsh(e, e, 2);
-
-			fp_exp(t0, a, e);
+			fp_exp_chain(t0, a, RLC_FP_EXP_SRT);
 			fp_sqr(t1, t0);
 			r = (fp_cmp(t1, a) == RLC_EQ);
 			fp_copy(c, t0);
 		} else {
 			int f = 0, m = 0;
 
-			/* First, check if there is a root. Compute t1 = a^((p - 1)/2). */
+			/* Make e = (p - 1)/2. */
+			e->used = RLC_FP_DIGS;
+			dv_copy(e->dp, fp_prime_get(), RLC_FP_DIGS);
 			bn_rsh(e, e, 1);
-			fp_exp(t0, a, e);
 
-			if (fp_cmp_dig(t0, 1) != RLC_EQ) {
+			/* First, check if there is a root with the Legendre symbol. */
+			if (fp_smb(a) != 1) {
 				/* Nope, there is no square root. */
 				r = 0;
 			} else {
 				r = 1;
 				/* Find a quadratic non-residue modulo p, that is a number t2
-				 * such that (t2 | p) = t2^((p - 1)/2)!= 1. */
+				 * such that (t2 | p) = -1. */
 				do {
 					fp_rand(t1);
-					fp_exp(t0, t1, e);
-				} while (fp_cmp_dig(t0, 1) == RLC_EQ);
+				} while (fp_smb(t1) != -1);
 
 				/* Write p - 1 as (e * 2^f), odd e. */
 				bn_lsh(e, e, 1);
@@ -0,0 +1,253 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (C) 2007-2020 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+/**
+ * @file
+ *
+ * Implementation of the prime field arithmetic over arrays of elements.
+ *
+ * @ingroup fp
+ */
+
+#include "relic_core.h"
+
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+#if ARCH == X64 && WSIZE == 64 && FP_RDC == MONTY && (defined(__GNUC__) || defined(__clang__))
+
+#include <immintrin.h>
+
+/**
+ * Number of field elements processed at once by the vector kernel.
+ */
+#define VEC_LANES	8
+
+/**
+ * Number of 52-bit limbs used to represent a field element.
+ */
+#define VEC_LIMBS	((RLC_FP_DIGS * RLC_DIG + 51) / 52)
+
+/**
+ * Shift that takes the Montgomery radix 2^(64 * RLC_FP_DIGS) of the scalar
+ * code to the radix 2^(52 * VEC_LIMBS) of the vector kernel.
+ */
+#define VEC_SHIFT	(52 * VEC_LIMBS - RLC_FP_DIGS * RLC_DIG)
+
+/**
+ * Mask selecting the 52 bits of a limb.
+ */
+#define VEC_MASK	(((uint64_t)1 << 52) - 1)
+
+/**
+ * Writes the 52-bit limbs of a * 2^s to t, one limb every VEC_LANES words.
+ *
+ * @param[out] t			- the limbs.
+ * @param[in] a				- the field element.
+ * @param[in] s				- the shift amount, at most VEC_SHIFT.
+ */
+static void fp_split(uint64_t *t, const dig_t *a, int s) {
+	for (int j = 0; j < VEC_LIMBS; j++) {
+		int b = 52 * j - s, k, r;
+		uint64_t w;
+
+		if (b < 0) {
+			w = a[0] << (-b);
+		} else {
+			k = b / RLC_DIG;
+			r = b % RLC_DIG;
+			w = a[k] >> r;
+			if (r > RLC_DIG - 52 && k + 1 < RLC_FP_DIGS) {
+				w |= a[k + 1] << (RLC_DIG - r);
+			}
+		}
+		t[j * VEC_LANES] = w & VEC_MASK;
+	}
+}
+
+/**
+ * Reads a field element from its normalized 52-bit limbs, stored one limb
+ * every VEC_LANES words.
+ *
+ * @param[out] c			- the field element.
+ * @param[in] t				- the limbs.
+ */
+static void fp_join(dig_t *c, const uint64_t *t) {
+	for (int k = 0; k < RLC_FP_DIGS; k++) {
+		c[k] = 0;
+	}
+	for (int j = 0; j < VEC_LIMBS; j++) {
+		int k = (52 * j) / RLC_DIG, r = (52 * j) % RLC_DIG;
+
+		c[k] |= t[j * VEC_LANES] << r;
+		if (r > RLC_DIG - 52 && k + 1 < RLC_FP_DIGS) {
+			c[k + 1] |= t[j * VEC_LANES] >> (RLC_DIG - r);
+		}
+	}
+}
+
+/**
+ * Multiplies eight pairs of field elements in Montgomery form with AVX-512
+ * IFMA. Each lane holds the limbs of one element. Since the first operand is
+ * scaled by 2^VEC_SHIFT, the product carries the Montgomery radix of the
+ * scalar code.
+ *
+ * @param[out] c			- the limbs of the results.
+ * @param[in] a				- the limbs of the first operands, scaled.
+ * @param[in] b				- the limbs of the second operands.
+ * @param[in] p				- the limbs of the prime.
+ * @param[in] u				- the Montgomery constant -p^(-1) mod 2^52.
+ */
+__attribute__((target("avx512f,avx512ifma")))
+static void fp_mulm_ifma(uint64_t *c, const uint64_t *a, const uint64_t *b,
+		const uint64_t *p, uint64_t u) {
+	__m512i t[VEC_LIMBS + 1], x[VEC_LIMBS], y[VEC_LIMBS], q[VEC_LIMBS];
+	__m512i m, v, d, w, zero = _mm512_setzero_si512();
+	__m512i mask = _mm512_set1_epi64(VEC_MASK);
+	__mmask8 k;
+
+	for (int j = 0; j < VEC_LIMBS; j++) {
+		x[j] = _mm512_loadu_si512((const void *)(a + j * VEC_LANES));
+		y[j] = _mm512_loadu_si512((const void *)(b + j * VEC_LANES));
+		q[j] = _mm512_set1_epi64(p[j]);
+		t[j] = zero;
+	}
+	t[VEC_LIMBS] = zero;
+	v = _mm512_set1_epi64(u);
+
+	/* Interleaved Montgomery multiplication with one limb of b per step. The
+	 * limbs of t accumulate without carries and stay below 2^64. */
+	for (int i = 0; i < VEC_LIMBS; i++) {
+		for (int j = 0; j < VEC_LIMBS; j++) {
+			t[j] = _mm512_madd52lo_epu64(t[j], x[j], y[i]);
+			t[j + 1] = _mm512_madd52hi_epu64(t[j + 1], x[j], y[i]);
+		}
+		m = _mm512_madd52lo_epu64(zero, t[0], v);
+		for (int j = 0; j < VEC_LIMBS; j++) {
+			t[j] = _mm512_madd52lo_epu64(t[j], q[j], m);
+			t[j + 1] = _mm512_madd52hi_epu64(t[j + 1], q[j], m);
+		}
+		t[1] = _mm512_add_epi64(t[1], _mm512_srli_epi64(t[0], 52));
+		for (int j = 0; j < VEC_LIMBS; j++) {
+			t[j] = t[j + 1];
+		}
+		t[VEC_LIMBS] = zero;
+	}
+
+	/* Propagate the carries, the result is now below 2p. */
+	for (int j = 0; j < VEC_LIMBS - 1; j++) {
+		t[j + 1] = _mm512_add_epi64(t[j + 1], _mm512_srli_epi64(t[j], 52));
+		t[j] = _mm512_and_si512(t[j], mask);
+	}
+
+	/* Subtract p and keep the difference in the lanes without borrow. */
+	w = zero;
+	for (int j = 0; j < VEC_LIMBS; j++) {
+		d = _mm512_sub_epi64(_mm512_sub_epi64(t[j], q[j]), w);
+		w = _mm512_srli_epi64(d, 63);
+		x[j] = _mm512_and_si512(d, mask);
+	}
+	k = _mm512_cmpeq_epi64_mask(w, zero);
+	for (int j = 0; j < VEC_LIMBS; j++) {
+		t[j] = _mm512_mask_blend_epi64(k, t[j], x[j]);
+		_mm512_storeu_si512((void *)(c + j * VEC_LANES), t[j]);
+	}
+}
+
+/**
+ * Multiplies prime field elements pairwise with the vector kernel, leaving
+ * the last n mod VEC_LANES elements to the caller.
+ *
+ * @param[out] c			- the results.
+ * @param[in] a				- the first prime field elements to multiply.
+ * @param[in] b				- the second prime field elements to multiply.
+ * @param[in] n				- the number of elements.
+ * @return the number of elements processed.
+ */
+static int fp_mul_ifma(fp_t *c, const fp_t *a, const fp_t *b, int n) {
+	rlc_align uint64_t ta[VEC_LIMBS * VEC_LANES], tb[VEC_LIMBS * VEC_LANES];
+	rlc_align uint64_t tc[VEC_LIMBS * VEC_LANES], tp[VEC_LIMBS];
+	dig_t u;
+	int i, j;
+
+	if (!arch_cpu_has(RLC_ARCH_IFMA) || n < VEC_LANES) {
+		return 0;
+	}
+
+	fp_split(tc, fp_prime_get(), 0);
+	for (j = 0; j < VEC_LIMBS; j++) {
+		tp[j] = tc[j * VEC_LANES];
+	}
+	/* Compute -p^(-1) mod 2^52 with Newton iterations. */
+	u = fp_prime_get()[0];
+	for (j = 0; j < 6; j++) {
+		u *= 2 - fp_prime_get()[0] * u;
+	}
+	u = (-u) & VEC_MASK;
+
+	for (i = 0; i + VEC_LANES <= n; i += VEC_LANES) {
+		for (j = 0; j < VEC_LANES; j++) {
+			fp_split(ta + j, a[i + j], VEC_SHIFT);
+			fp_split(tb + j, b[i + j], 0);
+		}
+		fp_mulm_ifma(tc, ta, tb, tp, u);
+		for (j = 0; j < VEC_LANES; j++) {
+			fp_join(c[i + j], tc + j);
+		}
+	}
+	return i;
+}
+
+#endif
+
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+void fp_add_vec(fp_t *c, const fp_t *a, const fp_t *b, int n) {
+	for (int i = 0; i < n; i++) {
+		fp_add(c[i], a[i], b[i]);
+	}
+}
+
+void fp_mul_vec(fp_t *c, const fp_t *a, const fp_t *b, int n) {
+	int i = 0;
+
+#if ARCH == X64 && WSIZE == 64 && FP_RDC == MONTY && (defined(__GNUC__) || defined(__clang__))
+	i = fp_mul_ifma(c, a, b, n);
+#endif
+	for (; i < n; i++) {
+		fp_mul(c[i], a[i], b[i]);
+	}
+}
+
+void fp_sqr_vec(fp_t *c, const fp_t *a, int n) {
+	int i = 0;
+
+#if ARCH == X64 && WSIZE == 64 && FP_RDC == MONTY && (defined(__GNUC__) || defined(__clang__))
+	i = fp_mul_ifma(c, a, a, n);
+#endif
+	for (; i < n; i++) {
+		fp_sqr(c[i], a[i]);
+	}
+}
@@ -70,10 +70,10 @@ void fp2_field_init(void) {
 		fp_zero(t0[0]);
 		fp_set_dig(t0[1], 1);
 		/* If it does not work, attempt (u + 2), otherwise double. */
-		if (fp2_srt(t1, t0) == 1) {
+		if (fp2_smb(t0) == 1) {
 			ctx->qnr2 = 2;
 			fp_set_dig(t0[0], ctx->qnr2);
-			while (fp2_srt(t1, t0) == 1) {
+			while (fp2_smb(t0) == 1) {
 				/* Pick a power of 2 for efficiency. */
 				ctx->qnr2 *= 2;
 				fp_set_dig(t0[0], ctx->qnr2);
@@ -0,0 +1,68 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (C) 2007-2020 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+
+/**
+ * @file
+ *
+ * Implementation of the quadratic character in extensions defined over prime
+ * fields.
+ *
+ * @ingroup fpx
+ */
+
+#include "relic_core.h"
+
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+int fp2_smb(fp2_t a) {
+	fp_t t0, t1;
+	int r = 0;
+
+	fp_null(t0);
+	fp_null(t1);
+
+	RLC_TRY {
+		fp_new(t0);
+		fp_new(t1);
+
+		/* a is a square in Fp2 iff its norm a_0^2 - u^2 * a_1^2 is in Fp. */
+		fp_sqr(t0, a[0]);
+		fp_sqr(t1, a[1]);
+		for (int i = -1; i > fp_prime_get_qnr(); i--) {
+			fp_add(t0, t0, t1);
+		}
+		fp_add(t0, t0, t1);
+		r = fp_smb(t0);
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		fp_free(t0);
+		fp_free(t1);
+	}
+	return r;
+}
@@ -51,7 +51,37 @@ int fp2_srt(fp2_t c, fp2_t a) {
 		fp_new(t2);
 		fp_new(t3);
 
-		if (fp_is_zero(a[1])) {
+		if (fp_prime_get_mod8() % 4 == 3 && fp_prime_get_qnr() == -1) {
+			/* Constant-time method for p = 3 mod 4 and u = i = sqrt(-1). With
+			 * n = a_0^2 + a_1^2 and s = sqrt(n), let h = (a_0 + s)/2 and
+			 * g = h^((p - 3)/4). If h is a square, the root is X + Y * i with
+			 * X = h * g and Y = a_1 * g/2, otherwise it is Y - X * i. */
+			fp_sqr(t1, a[0]);
+			fp_sqr(t2, a[1]);
+			fp_add(t1, t1, t2);
+			fp_exp_chain(t2, t1, RLC_FP_EXP_SRT);
+			fp_sqr(t3, t2);
+			r = (fp_cmp(t3, t1) == RLC_EQ);
+
+			/* Take h = (a_0 - s)/2 instead if the other choice is zero. */
+			fp_add(t1, a[0], t2);
+			fp_sub(t3, a[0], t2);
+			dv_copy_cond(t1, t3, RLC_FP_DIGS, fp_is_zero(t1));
+			fp_hlv(t1, t1);
+
+			fp_exp_chain(t2, t1, RLC_FP_EXP_ISR);
+			fp_mul(t3, t1, t2);
+			fp_mul(t1, t3, t2);
+			/* Now h is a square if and only if h * g^2 = 1. */
+			int q = (fp_cmp_dig(t1, 1) == RLC_EQ);
+			fp_mul(t2, a[1], t2);
+			fp_hlv(t2, t2);
+			fp_neg(t1, t3);
+			fp_copy(c[0], t3);
+			fp_copy(c[1], t2);
+			dv_copy_cond(c[0], t2, RLC_FP_DIGS, q == 0);
+			dv_copy_cond(c[1], t1, RLC_FP_DIGS, q == 0);
+		} else if (fp_is_zero(a[1])) {
 			/* special case: either a[0] is square and sqrt is purely 'real'
 			 * or a[0] is non-square and sqrt is purely 'imaginary' */
 			r = 1;
@@ -92,12 +122,13 @@ int fp2_srt(fp2_t c, fp2_t a) {
 				fp_add(t1, a[0], t2);
 				fp_hlv(t1, t1);
 
-				if (!fp_srt(t3, t1)) {
+				/* Use the Legendre symbol to take a single square root. */
+				if (fp_smb(t1) != 1) {
 					/* t1 = (a_0 - sqrt(t1)) / 2 */
 					fp_sub(t1, a[0], t2);
 					fp_hlv(t1, t1);
-					fp_srt(t3, t1);
 				}
+				fp_srt(t3, t1);
 				/* c_0 = sqrt(t1) */
 				fp_copy(c[0], t3);
 				/* c_1 = a_1 / (2 * sqrt(t1)) */
@@ -41,18 +41,9 @@
 /*============================================================================*/
 
 void fp_invm_low(dig_t *c, const dig_t *a) {
-	bn_st e;
-
-	bn_init(&e, RLC_FP_DIGS);
-
-	e.used = RLC_FP_DIGS;
-	dv_copy(e.dp, fp_prime_get(), RLC_FP_DIGS);
-	bn_sub1_low(e.dp, e.dp, 2, RLC_FP_DIGS);
 #if AUTO == ALLOC
-	fp_exp(c, a, &e);
+	fp_exp_chain(c, a, RLC_FP_EXP_INV);
 #else
-	fp_exp(c, (const fp_t)a, &e);
+	fp_exp_chain(c, (const fp_t)a, RLC_FP_EXP_INV);
 #endif
-
-	bn_clean(&e);
 }
@@ -0,0 +1,428 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (C) 2007-2020 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+#include "relic_fp_low.h"
+
+/**
+ * @file
+ *
+ * Macros for low-level prime field arithmetic with the BMI2 and ADX
+ * instruction set extensions. MULX does not touch the flags, so ADCX and ADOX
+ * keep two independent carry chains for the low and high halves of partial
+ * products.
+ *
+ * @ingroup fp
+ */
+
+#if FP_PRIME == 381
+#define P0	0xB9FEFFFFFFFFAAAB
+#define P1	0x1EABFFFEB153FFFF
+#define P2	0x6730D2A0F6B0F624
+#define P3	0x64774B84F38512BF
+#define P4	0x4B1BA7B6434BACD7
+#define P5	0x1A0111EA397FE69A
+#define U0	0x89F3FFFCFFFCFFFD
+#else
+#error "The x64-asm-381 backend only supports FP_PRIME = 381."
+#endif
+
+#ifdef LOW_LABEL
+/* Keep the shared constants apart from other backends linked alongside. */
+#define p0		RLC_LOW_PREFIX(p0)
+#define p1		RLC_LOW_PREFIX(p1)
+#define p2		RLC_LOW_PREFIX(p2)
+#define p3		RLC_LOW_PREFIX(p3)
+#define p4		RLC_LOW_PREFIX(p4)
+#define p5		RLC_LOW_PREFIX(p5)
+#define bn_addp_low	RLC_LOW_PREFIX(bn_addp_low)
+#define u0		RLC_LOW_PREFIX(u0)
+#endif
+
+.text
+
+.macro ADD1 i j
+	movq	8*\i(%rsi), %r10
+	adcq	$0, %r10
+	movq	%r10, 8*\i(%rdi)
+	.if \i - \j
+		ADD1 "(\i + 1)" \j
+	.endif
+.endm
+
+.macro ADDN i j
+	movq	8*\i(%rdx), %r11
+	adcq	8*\i(%rsi), %r11
+	movq	%r11, 8*\i(%rdi)
+	.if \i - \j
+		ADDN "(\i + 1)" \j
+	.endif
+.endm
+
+.macro SUB1 i j
+	movq	8*\i(%rsi),%r10
+	sbbq	$0, %r10
+	movq	%r10,8*\i(%rdi)
+	.if \i - \j
+		SUB1 "(\i + 1)" \j
+	.endif
+.endm
+
+.macro SUBN i j
+	movq	8*\i(%rsi), %r8
+	sbbq	8*\i(%rdx), %r8
+	movq	%r8, 8*\i(%rdi)
+	.if \i - \j
+		SUBN "(\i + 1)" \j
+	.endif
+.endm
+
+.macro DBLN i j
+	movq	8*\i(%rsi), %r8
+	adcq	%r8, %r8
+	movq	%r8, 8*\i(%rdi)
+	.if \i - \j
+		DBLN "(\i + 1)" \j
+	.endif
+.endm
+
+/*
+ * Computes T0..T6 = rdx * A with a single carry chain.
+ */
+.macro MULX_ROW0 A, T0, T1, T2, T3, T4, T5, T6
+	mulx	0(\A), \T0, \T1
+	mulx	8(\A), %rax, \T2
+	addq	%rax, \T1
+	mulx	16(\A), %rax, \T3
+	adcq	%rax, \T2
+	mulx	24(\A), %rax, \T4
+	adcq	%rax, \T3
+	mulx	32(\A), %rax, \T5
+	adcq	%rax, \T4
+	mulx	40(\A), %rax, \T6
+	adcq	%rax, \T5
+	adcq	$0, \T6
+.endm
+
+/*
+ * Computes T0..T6 = T0..T5 + rdx * A, where the previous value of T6 is
+ * ignored. Requires the flags cleared and Z = 0.
+ */
+.macro MULX_ROW A, Z, T0, T1, T2, T3, T4, T5, T6
+	mulx	0(\A), %rax, %rbx
+	adcx	%rax, \T0
+	adox	%rbx, \T1
+	mulx	8(\A), %rax, %rbx
+	adcx	%rax, \T1
+	adox	%rbx, \T2
+	mulx	16(\A), %rax, %rbx
+	adcx	%rax, \T2
+	adox	%rbx, \T3
+	mulx	24(\A), %rax, %rbx
+	adcx	%rax, \T3
+	adox	%rbx, \T4
+	mulx	32(\A), %rax, %rbx
+	adcx	%rax, \T4
+	adox	%rbx, \T5
+	mulx	40(\A), %rax, \T6
+	adcx	%rax, \T5
+	adox	\Z, \T6
+	adcx	\Z, \T6
+.endm
+
+/*
+ * Performs one step of Montgomery reduction, adding m * p to T0..T6 for
+ * m = T0 * u mod 2^64, which clears T0. If NEW is set, the previous value of
+ * T6 is ignored. Requires Z = 0.
+ */
+.macro MONT_STEP Z, NEW, T0, T1, T2, T3, T4, T5, T6
+	movq	\T0, %rdx
+	imulq	u0(%rip), %rdx
+	xorq	%rax, %rax
+	mulx	p0(%rip), %rax, %rbx
+	adcx	%rax, \T0
+	adox	%rbx, \T1
+	mulx	p1(%rip), %rax, %rbx
+	adcx	%rax, \T1
+	adox	%rbx, \T2
+	mulx	p2(%rip), %rax, %rbx
+	adcx	%rax, \T2
+	adox	%rbx, \T3
+	mulx	p3(%rip), %rax, %rbx
+	adcx	%rax, \T3
+	adox	%rbx, \T4
+	mulx	p4(%rip), %rax, %rbx
+	adcx	%rax, \T4
+	adox	%rbx, \T5
+	.if \NEW
+		mulx	p5(%rip), %rax, \T6
+		adcx	%rax, \T5
+		adox	\Z, \T6
+	.else
+		mulx	p5(%rip), %rax, %rbx
+		adcx	%rax, \T5
+		adox	%rbx, \T6
+	.endif
+	adcx	\Z, \T6
+.endm
+
+/*
+ * Computes C = T0..T5 mod p for T0..T5 < 2p, using the registers R0..R5.
+ */
+.macro FP_RDC_FINAL C, T0, T1, T2, T3, T4, T5, R0, R1, R2, R3, R4, R5
+	movq	\T0, \R0
+	movq	\T1, \R1
+	movq	\T2, \R2
+	movq	\T3, \R3
+	movq	\T4, \R4
+	movq	\T5, \R5
+	subq	p0(%rip), \R0
+	sbbq	p1(%rip), \R1
+	sbbq	p2(%rip), \R2
+	sbbq	p3(%rip), \R3
+	sbbq	p4(%rip), \R4
+	sbbq	p5(%rip), \R5
+	cmovc	\T0, \R0
+	cmovc	\T1, \R1
+	cmovc	\T2, \R2
+	cmovc	\T3, \R3
+	cmovc	\T4, \R4
+	cmovc	\T5, \R5
+	movq	\R0, 0(\C)
+	movq	\R1, 8(\C)
+	movq	\R2, 16(\C)
+	movq	\R3, 24(\C)
+	movq	\R4, 32(\C)
+	movq	\R5, 40(\C)
+.endm
+
+/*
+ * Computes C = A * B, where B is in rcx. Uses rax, rbx, rdx and r8-r14.
+ */
+.macro FP_MULN_LOW C, A, B
+	movq	0(\B), %rdx
+	MULX_ROW0 \A, %r8, %r9, %r10, %r11, %r12, %r13, %r14
+	movq	%r8, 0(\C)
+	movq	8(\B), %rdx
+	xorq	%r8, %r8
+	MULX_ROW \A, %rbp, %r9, %r10, %r11, %r12, %r13, %r14, %r8
+	movq	%r9, 8(\C)
+	movq	16(\B), %rdx
+	xorq	%r9, %r9
+	MULX_ROW \A, %rbp, %r10, %r11, %r12, %r13, %r14, %r8, %r9
+	movq	%r10, 16(\C)
+	movq	24(\B), %rdx
+	xorq	%r10, %r10
+	MULX_ROW \A, %rbp, %r11, %r12, %r13, %r14, %r8, %r9, %r10
+	movq	%r11, 24(\C)
+	movq	32(\B), %rdx
+	xorq	%r11, %r11
+	MULX_ROW \A, %rbp, %r12, %r13, %r14, %r8, %r9, %r10, %r11
+	movq	%r12, 32(\C)
+	movq	40(\B), %rdx
+	xorq	%r12, %r12
+	MULX_ROW \A, %rbp, %r13, %r14, %r8, %r9, %r10, %r11, %r12
+	movq	%r13, 40(\C)
+	movq	%r14, 48(\C)
+	movq	%r8, 56(\C)
+	movq	%r9, 64(\C)
+	movq	%r10, 72(\C)
+	movq	%r11, 80(\C)
+	movq	%r12, 88(\C)
+.endm
+
+/*
+ * Computes C = A * B * 2^(-384) mod p by interleaving each row of the product
+ * with a Montgomery reduction step (CIOS). Uses rax, rbx, rdx and r8-r14.
+ */
+.macro FP_MULM_LOW C, A, B
+	movq	0(\B), %rdx
+	MULX_ROW0 \A, %r8, %r9, %r10, %r11, %r12, %r13, %r14
+	MONT_STEP %rbp, 0, %r8, %r9, %r10, %r11, %r12, %r13, %r14
+	movq	8(\B), %rdx
+	xorq	%rax, %rax
+	MULX_ROW \A, %rbp, %r9, %r10, %r11, %r12, %r13, %r14, %r8
+	MONT_STEP %rbp, 0, %r9, %r10, %r11, %r12, %r13, %r14, %r8
+	movq	16(\B), %rdx
+	xorq	%rax, %rax
+	MULX_ROW \A, %rbp, %r10, %r11, %r12, %r13, %r14, %r8, %r9
+	MONT_STEP %rbp, 0, %r10, %r11, %r12, %r13, %r14, %r8, %r9
+	movq	24(\B), %rdx
+	xorq	%rax, %rax
+	MULX_ROW \A, %rbp, %r11, %r12, %r13, %r14, %r8, %r9, %r10
+	MONT_STEP %rbp, 0, %r11, %r12, %r13, %r14, %r8, %r9, %r10
+	movq	32(\B), %rdx
+	xorq	%rax, %rax
+	MULX_ROW \A, %rbp, %r12, %r13, %r14, %r8, %r9, %r10, %r11
+	MONT_STEP %rbp, 0, %r12, %r13, %r14, %r8, %r9, %r10, %r11
+	movq	40(\B), %rdx
+	xorq	%rax, %rax
+	MULX_ROW \A, %rbp, %r13, %r14, %r8, %r9, %r10, %r11, %r12
+	MONT_STEP %rbp, 0, %r13, %r14, %r8, %r9, %r10, %r11, %r12
+	FP_RDC_FINAL \C, %r14, %r8, %r9, %r10, %r11, %r12, %rax, %rbx, %rcx, %rdx, %rsi, %r13
+.endm
+
+/*
+ * Computes C = A * 2^(-384) mod p for a double-precision A. Uses rax, rbx,
+ * rcx, rdx, rsi and r8-r14.
+ */
+.macro FP_RDCN_LOW C, A
+	movq	0(\A), %r8
+	movq	8(\A), %r9
+	movq	16(\A), %r10
+	movq	24(\A), %r11
+	movq	32(\A), %r12
+	movq	40(\A), %r13
+	MONT_STEP %rbp, 1, %r8, %r9, %r10, %r11, %r12, %r13, %r14
+	MONT_STEP %rbp, 1, %r9, %r10, %r11, %r12, %r13, %r14, %r8
+	MONT_STEP %rbp, 1, %r10, %r11, %r12, %r13, %r14, %r8, %r9
+	MONT_STEP %rbp, 1, %r11, %r12, %r13, %r14, %r8, %r9, %r10
+	MONT_STEP %rbp, 1, %r12, %r13, %r14, %r8, %r9, %r10, %r11
+	MONT_STEP %rbp, 1, %r13, %r14, %r8, %r9, %r10, %r11, %r12
+	/* Add the upper half of the input to the reduced lower half. */
+	addq	48(\A), %r14
+	adcq	56(\A), %r8
+	adcq	64(\A), %r9
+	adcq	72(\A), %r10
+	adcq	80(\A), %r11
+	adcq	88(\A), %r12
+	FP_RDC_FINAL \C, %r14, %r8, %r9, %r10, %r11, %r12, %rax, %rbx, %rcx, %rdx, %rsi, %r13
+.endm
+
+/*
+ * Computes C = A^2 by doubling the cross products and adding the squares of
+ * the digits. Uses rax, rbx, rdx and r8-r15, with rbp = 0.
+ */
+.macro FP_SQRN_LOW C, A
+	/* Cross products a0 * (a1, ..., a5) in r8-r13. */
+	movq	0(\A), %rdx
+	mulx	8(\A), %r8, %r9
+	mulx	16(\A), %rax, %r10
+	addq	%rax, %r9
+	mulx	24(\A), %rax, %r11
+	adcq	%rax, %r10
+	mulx	32(\A), %rax, %r12
+	adcq	%rax, %r11
+	mulx	40(\A), %rax, %r13
+	adcq	%rax, %r12
+	adcq	$0, %r13
+	movq	%r8, 8(\C)
+	movq	%r9, 16(\C)
+	/* Cross products a1 * (a2, ..., a5) in r10-r14. */
+	movq	8(\A), %rdx
+	xorq	%rax, %rax
+	mulx	16(\A), %rax, %rbx
+	adcx	%rax, %r10
+	adox	%rbx, %r11
+	mulx	24(\A), %rax, %rbx
+	adcx	%rax, %r11
+	adox	%rbx, %r12
+	mulx	32(\A), %rax, %rbx
+	adcx	%rax, %r12
+	adox	%rbx, %r13
+	mulx	40(\A), %rax, %r14
+	adcx	%rax, %r13
+	adox	%rbp, %r14
+	adcx	%rbp, %r14
+	movq	%r10, 24(\C)
+	movq	%r11, 32(\C)
+	/* Cross products a2 * (a3, a4, a5) in r12-r15. */
+	movq	16(\A), %rdx
+	xorq	%rax, %rax
+	mulx	24(\A), %rax, %rbx
+	adcx	%rax, %r12
+	adox	%rbx, %r13
+	mulx	32(\A), %rax, %rbx
+	adcx	%rax, %r13
+	adox	%rbx, %r14
+	mulx	40(\A), %rax, %r15
+	adcx	%rax, %r14
+	adox	%rbp, %r15
+	adcx	%rbp, %r15
+	/* Cross products a3 * (a4, a5) in r14, r15, r8. */
+	movq	24(\A), %rdx
+	xorq	%rax, %rax
+	mulx	32(\A), %rax, %rbx
+	adcx	%rax, %r14
+	adox	%rbx, %r15
+	mulx	40(\A), %rax, %r8
+	adcx	%rax, %r15
+	adox	%rbp, %r8
+	adcx	%rbp, %r8
+	/* Cross product a4 * a5 in r8, r9. */
+	movq	32(\A), %rdx
+	mulx	40(\A), %rax, %r9
+	addq	%rax, %r8
+	adcq	$0, %r9
+	/* Double the cross products and add the squares of the digits. */
+	movq	0(\A), %rdx
+	xorq	%rax, %rax
+	mulx	%rdx, %rax, %rbx
+	movq	%rax, 0(\C)
+	movq	8(\C), %r10
+	adox	%r10, %r10
+	adcx	%rbx, %r10
+	movq	%r10, 8(\C)
+	movq	8(\A), %rdx
+	mulx	%rdx, %rax, %rbx
+	movq	16(\C), %r10
+	adox	%r10, %r10
+	adcx	%rax, %r10
+	movq	%r10, 16(\C)
+	movq	24(\C), %r10
+	adox	%r10, %r10
+	adcx	%rbx, %r10
+	movq	%r10, 24(\C)
+	movq	16(\A), %rdx
+	mulx	%rdx, %rax, %rbx
+	movq	32(\C), %r10
+	adox	%r10, %r10
+	adcx	%rax, %r10
+	movq	%r10, 32(\C)
+	adox	%r12, %r12
+	adcx	%rbx, %r12
+	movq	%r12, 40(\C)
+	movq	24(\A), %rdx
+	mulx	%rdx, %rax, %rbx
+	adox	%r13, %r13
+	adcx	%rax, %r13
+	movq	%r13, 48(\C)
+	adox	%r14, %r14
+	adcx	%rbx, %r14
+	movq	%r14, 56(\C)
+	movq	32(\A), %rdx
+	mulx	%rdx, %rax, %rbx
+	adox	%r15, %r15
+	adcx	%rax, %r15
+	movq	%r15, 64(\C)
+	adox	%r8, %r8
+	adcx	%rbx, %r8
+	movq	%r8, 72(\C)
+	movq	40(\A), %rdx
+	mulx	%rdx, %rax, %rbx
+	adox	%r9, %r9
+	adcx	%rax, %r9
+	movq	%r9, 80(\C)
+	adox	%rbp, %rbx
+	adcx	%rbp, %rbx
+	movq	%rbx, 88(\C)
+.endm
@@ -0,0 +1,87 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (C) 2007-2020 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Implementation of the low-level prime field squaring functions with the
+ * BMI2 and ADX instruction set extensions.
+ *
+ * @ingroup fp
+ */
+
+#include "macro.s"
+
+.text
+
+.global fp_sqrn_low
+.global fp_sqrm_low
+
+/*
+ * Function: fp_sqrn_low
+ * Inputs: rdi = c, rsi = a
+ */
+fp_sqrn_low:
+	push	%rbx
+	push	%rbp
+	push	%r12
+	push	%r13
+	push	%r14
+	push	%r15
+	xorq	%rbp, %rbp
+
+	FP_SQRN_LOW %rdi, %rsi
+
+	pop		%r15
+	pop		%r14
+	pop		%r13
+	pop		%r12
+	pop		%rbp
+	pop		%rbx
+	ret
+
+/*
+ * Function: fp_sqrm_low
+ * Inputs: rdi = c, rsi = a
+ */
+fp_sqrm_low:
+	push	%rbx
+	push	%rbp
+	push	%r12
+	push	%r13
+	push	%r14
+	push	%r15
+	subq	$96, %rsp
+	xorq	%rbp, %rbp
+
+	FP_SQRN_LOW %rsp, %rsi
+	FP_RDCN_LOW %rdi, %rsp
+
+	addq	$96, %rsp
+	pop		%r15
+	pop		%r14
+	pop		%r13
+	pop		%r12
+	pop		%rbp
+	pop		%rbx
+	ret
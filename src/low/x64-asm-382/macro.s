@@ -50,6 +50,17 @@
 #define U0	0xDF615E50D79435E5
 #endif
 
+#ifdef LOW_LABEL
+/* Keep the shared constants apart from other backends linked alongside. */
+#define p0		RLC_LOW_PREFIX(p0)
+#define p1		RLC_LOW_PREFIX(p1)
+#define p2		RLC_LOW_PREFIX(p2)
+#define p3		RLC_LOW_PREFIX(p3)
+#define p4		RLC_LOW_PREFIX(p4)
+#define p5		RLC_LOW_PREFIX(p5)
+#define bn_addp_low	RLC_LOW_PREFIX(bn_addp_low)
+#endif
+
 .text
 
 .macro ADD1 i j
@@ -252,3 +263,54 @@
 	movq	%r15,32(\C)
 	movq	%rcx,40(\C)
 .endm
+
+/*
+ * Computes C = A + B over N digits without modular reduction. Uses rax.
+ */
+.macro FP2_ADDN C, A, B, N
+	.set	_j, 0
+	clc
+	.rept	\N
+		movq	8*_j(\A), %rax
+		adcq	8*_j(\B), %rax
+		movq	%rax, 8*_j(\C)
+		.set	_j, _j + 1
+	.endr
+.endm
+
+/*
+ * Computes C = A - B over N digits and leaves the borrow in CF. Uses rax.
+ */
+.macro FP2_SUBN C, A, B, N
+	.set	_j, 0
+	clc
+	.rept	\N
+		movq	8*_j(\A), %rax
+		sbbq	8*_j(\B), %rax
+		movq	%rax, 8*_j(\C)
+		.set	_j, _j + 1
+	.endr
+.endm
+
+/*
+ * Adds the prime to the RLC_FP_DIGS digits at C if rdx is all ones and leaves
+ * them untouched if rdx is zero. The masked prime is staged in T to keep the
+ * carry chain intact. Uses rax.
+ */
+.macro FP2_ADDP C, T
+	.set	_j, 0
+	.rept	RLC_FP_DIGS
+		movq	p0+8*_j(%rip), %rax
+		andq	%rdx, %rax
+		movq	%rax, 8*_j(\T)
+		.set	_j, _j + 1
+	.endr
+	.set	_j, 0
+	clc
+	.rept	RLC_FP_DIGS
+		movq	8*_j(\C), %rax
+		adcq	8*_j(\T), %rax
+		movq	%rax, 8*_j(\C)
+		.set	_j, _j + 1
+	.endr
+.endm
@@ -265,3 +265,54 @@
 	movq	%rcx,40(\C)
 	movq	%rbp,48(\C)
 .endm
+
+/*
+ * Computes C = A + B over N digits without modular reduction. Uses rax.
+ */
+.macro FP2_ADDN C, A, B, N
+	.set	_j, 0
+	clc
+	.rept	\N
+		movq	8*_j(\A), %rax
+		adcq	8*_j(\B), %rax
+		movq	%rax, 8*_j(\C)
+		.set	_j, _j + 1
+	.endr
+.endm
+
+/*
+ * Computes C = A - B over N digits and leaves the borrow in CF. Uses rax.
+ */
+.macro FP2_SUBN C, A, B, N
+	.set	_j, 0
+	clc
+	.rept	\N
+		movq	8*_j(\A), %rax
+		sbbq	8*_j(\B), %rax
+		movq	%rax, 8*_j(\C)
+		.set	_j, _j + 1
+	.endr
+.endm
+
+/*
+ * Adds the prime to the RLC_FP_DIGS digits at C if rdx is all ones and leaves
+ * them untouched if rdx is zero. The masked prime is staged in T to keep the
+ * carry chain intact. Uses rax.
+ */
+.macro FP2_ADDP C, T
+	.set	_j, 0
+	.rept	RLC_FP_DIGS
+		movq	p0+8*_j(%rip), %rax
+		andq	%rdx, %rax
+		movq	%rax, 8*_j(\T)
+		.set	_j, _j + 1
+	.endr
+	.set	_j, 0
+	clc
+	.rept	RLC_FP_DIGS
+		movq	8*_j(\C), %rax
+		adcq	8*_j(\T), %rax
+		movq	%rax, 8*_j(\C)
+		.set	_j, _j + 1
+	.endr
+.endm
@@ -0,0 +1,121 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (C) 2007-2020 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Implementation of the low-level quadratic extension field squaring
+ * functions. Complex squaring runs over double-precision products and each
+ * output coordinate is reduced only once.
+ *
+ * @ingroup fpx
+ */
+
+#include "relic_dv_low.h"
+
+#include "macro.s"
+
+#ifdef FP_QNRES
+
+/*
+ * Computes the unreduced quadratic extension square (C0, C1) = A^2 for
+ * u^2 = -1. Expects 4 * RLC_FP_DIGS digits of scratch space at rsp and the
+ * pointers in registers other than rax, rdx and r8-r13.
+ */
+.macro FP2_SQRN_LOW C0, C1, A
+	/* rsp[N..2N) = a0 - a1 mod p. */
+	leaq	(8*RLC_FP_DIGS)(\A), %r11
+	leaq	(8*RLC_FP_DIGS)(%rsp), %r12
+	FP2_SUBN %r12, \A, %r11, RLC_FP_DIGS
+	sbbq	%rdx, %rdx
+	leaq	(24*RLC_FP_DIGS)(%rsp), %r13
+	FP2_ADDP %r12, %r13
+
+	/* rsp[0..N) = a0 + a1, rsp[2N..3N) = 2 * a0, without reduction. */
+	FP2_ADDN %rsp, \A, %r11, RLC_FP_DIGS
+	leaq	(16*RLC_FP_DIGS)(%rsp), %r13
+	FP2_ADDN %r13, \A, \A, RLC_FP_DIGS
+
+	/* C1 = 2 * a0 * a1, C0 = (a0 + a1) * (a0 - a1). */
+	FP_MULN_LOW \C1, %r8, %r9, %r10, %r13, %r11
+	FP_MULN_LOW \C0, %r8, %r9, %r10, %rsp, %r12
+.endm
+
+.text
+
+.global fp2_sqrn_low
+.global fp2_sqrm_low
+
+/*
+ * Function: fp2_sqrn_low
+ * Inputs: rdi = c, rsi = a
+ */
+fp2_sqrn_low:
+	push	%r12
+	push	%r13
+	push	%r14
+	subq	$(32*RLC_FP_DIGS), %rsp
+	leaq	(8*RLC_DV_DIGS)(%rdi), %r14
+
+	FP2_SQRN_LOW %rdi, %r14, %rsi
+
+	addq	$(32*RLC_FP_DIGS), %rsp
+	pop		%r14
+	pop		%r13
+	pop		%r12
+	ret
+
+/*
+ * Function: fp2_sqrm_low
+ * Inputs: rdi = c, rsi = a
+ */
+fp2_sqrm_low:
+	push	%r12
+	push	%r13
+	push	%r14
+	push	%r15
+	push	%rbx
+	push	%rbp
+	subq	$(64*RLC_FP_DIGS), %rsp
+	leaq	(32*RLC_FP_DIGS)(%rsp), %r15
+	leaq	(48*RLC_FP_DIGS)(%rsp), %r14
+
+	FP2_SQRN_LOW %r15, %r14, %rsi
+
+	leaq	p0(%rip), %rbx
+	movq	%r15, %rsi
+	FP_RDCN_LOW %rdi, %r8, %r9, %r10, %rsi, %rbx
+	addq	$(8*RLC_FP_DIGS), %rdi
+	leaq	(48*RLC_FP_DIGS)(%rsp), %rsi
+	FP_RDCN_LOW %rdi, %r8, %r9, %r10, %rsi, %rbx
+
+	addq	$(64*RLC_FP_DIGS), %rsp
+	pop		%rbp
+	pop		%rbx
+	pop		%r15
+	pop		%r14
+	pop		%r13
+	pop		%r12
+	ret
+
+#endif
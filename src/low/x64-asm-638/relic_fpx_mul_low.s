@@ -0,0 +1,135 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (C) 2007-2020 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Implementation of the low-level quadratic extension field multiplication
+ * functions. Karatsuba runs over double-precision products and each output
+ * coordinate is reduced only once.
+ *
+ * @ingroup fpx
+ */
+
+#include "relic_dv_low.h"
+
+#include "macro.s"
+
+#ifdef FP_QNRES
+
+/*
+ * Computes the unreduced quadratic extension product (C0, C1) = A * B for
+ * u^2 = -1. Expects 7 * RLC_FP_DIGS digits of scratch space at rsp and the
+ * pointers in registers other than rax, rdx and r8-r13.
+ */
+.macro FP2_MULN_LOW C0, C1, A, B
+	/* rsp[0..N) = a0 + a1, rsp[N..2N) = b0 + b1, both without reduction. */
+	leaq	(8*RLC_FP_DIGS)(\A), %r11
+	FP2_ADDN %rsp, \A, %r11, RLC_FP_DIGS
+	leaq	(8*RLC_FP_DIGS)(%rsp), %r12
+	leaq	(8*RLC_FP_DIGS)(\B), %r13
+	FP2_ADDN %r12, \B, %r13, RLC_FP_DIGS
+
+	/* C0 = a0 * b0, C1 = a1 * b1. */
+	FP_MULN_LOW \C0, %r8, %r9, %r10, \A, \B
+	FP_MULN_LOW \C1, %r8, %r9, %r10, %r11, %r13
+
+	/* rsp[2N..4N) = (a0 + a1) * (b0 + b1). */
+	leaq	(16*RLC_FP_DIGS)(%rsp), %r11
+	FP_MULN_LOW %r11, %r8, %r9, %r10, %rsp, %r12
+
+	/* rsp[4N..6N) = a0 * b0 + a1 * b1. */
+	leaq	(32*RLC_FP_DIGS)(%rsp), %r12
+	FP2_ADDN %r12, \C0, \C1, (2*RLC_FP_DIGS)
+
+	/* C0 = a0 * b0 - a1 * b1, adding p * 2^(N * 64) on borrow. */
+	FP2_SUBN \C0, \C0, \C1, (2*RLC_FP_DIGS)
+	sbbq	%rdx, %rdx
+	leaq	(8*RLC_FP_DIGS)(\C0), %r13
+	leaq	(48*RLC_FP_DIGS)(%rsp), %r8
+	FP2_ADDP %r13, %r8
+
+	/* C1 = (a0 + a1) * (b0 + b1) - a0 * b0 - a1 * b1. */
+	FP2_SUBN \C1, %r11, %r12, (2*RLC_FP_DIGS)
+.endm
+
+.text
+
+.global cdecl(fp2_muln_low)
+.global cdecl(fp2_mulm_low)
+
+/*
+ * Function: fp2_muln_low
+ * Inputs: rdi = c, rsi = a, rdx = b
+ */
+cdecl(fp2_muln_low):
+	push	%r12
+	push	%r13
+	push	%r14
+	subq	$(56*RLC_FP_DIGS), %rsp
+	movq	%rdx, %rcx
+	leaq	(8*RLC_DV_DIGS)(%rdi), %r14
+
+	FP2_MULN_LOW %rdi, %r14, %rsi, %rcx
+
+	addq	$(56*RLC_FP_DIGS), %rsp
+	pop		%r14
+	pop		%r13
+	pop		%r12
+	ret
+
+/*
+ * Function: fp2_mulm_low
+ * Inputs: rdi = c, rsi = a, rdx = b
+ */
+cdecl(fp2_mulm_low):
+	push	%r12
+	push	%r13
+	push	%r14
+	push	%r15
+	push	%rbx
+	push	%rbp
+	subq	$(88*RLC_FP_DIGS), %rsp
+	movq	%rdx, %rcx
+	leaq	(56*RLC_FP_DIGS)(%rsp), %r15
+	leaq	(72*RLC_FP_DIGS)(%rsp), %r14
+
+	FP2_MULN_LOW %r15, %r14, %rsi, %rcx
+
+	leaq	p0(%rip), %rbx
+	movq	%r15, %rsi
+	FP_RDCN_LOW %rdi, %r8, %r9, %r10, %rsi, %rbx
+	addq	$(8*RLC_FP_DIGS), %rdi
+	leaq	(72*RLC_FP_DIGS)(%rsp), %rsi
+	FP_RDCN_LOW %rdi, %r8, %r9, %r10, %rsi, %rbx
+
+	addq	$(88*RLC_FP_DIGS), %rsp
+	pop		%rbp
+	pop		%rbx
+	pop		%r15
+	pop		%r14
+	pop		%r13
+	pop		%r12
+	ret
+
+#endif
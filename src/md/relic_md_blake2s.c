@@ -37,6 +37,54 @@
 #include "relic_md.h"
 #include "blake2.h"
 
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+#if MD_MAP == B2S160 || MD_MAP == B2S256 || !defined(STRIP)
+
+/**
+ * Makes sure that the BLAKE2s state fits in an incremental hash context.
+ */
+typedef char b2s_fits[sizeof(blake2s_state) <= sizeof(md_ctx_st) ? 1 : -1];
+
+/**
+ * Absorbs part of a message into a BLAKE2s state. The state is copied out of
+ * the context because the reference code may require a stricter alignment.
+ *
+ * @param[in,out] ctx			- the hash state.
+ * @param[in] msg				- the message part to hash.
+ * @param[in] len				- the message part length in bytes.
+ */
+static void b2s_update(md_ctx_t ctx, const uint8_t *msg, int len) {
+	blake2s_state state;
+
+	memcpy(&state, ctx->state, sizeof(state));
+	if (blake2s_update(&state, msg, len) != 0) {
+		RLC_THROW(ERR_NO_VALID);
+	}
+	memcpy(ctx->state, &state, sizeof(state));
+}
+
+/**
+ * Finishes the computation of a BLAKE2s state.
+ *
+ * @param[out] hash				- the digest.
+ * @param[in,out] ctx			- the hash state.
+ * @param[in] len				- the digest length in bytes.
+ */
+static void b2s_final(uint8_t *hash, md_ctx_t ctx, int len) {
+	blake2s_state state;
+
+	memcpy(&state, ctx->state, sizeof(state));
+	if (blake2s_final(&state, hash, len) != 0) {
+		RLC_THROW(ERR_NO_VALID);
+	}
+	memcpy(ctx->state, &state, sizeof(state));
+}
+
+#endif
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -47,6 +95,23 @@ void md_map_b2s160(uint8_t *hash, const uint8_t *msg, int len) {
 	blake2s(hash, msg, 0, 20, len, 0);
 }
 
+void md_init_b2s160(md_ctx_t ctx) {
+	blake2s_state state;
+
+	if (blake2s_init(&state, 20) != 0) {
+		RLC_THROW(ERR_NO_VALID);
+	}
+	memcpy(ctx->state, &state, sizeof(state));
+}
+
+void md_update_b2s160(md_ctx_t ctx, const uint8_t *msg, int len) {
+	b2s_update(ctx, msg, len);
+}
+
+void md_final_b2s160(uint8_t *hash, md_ctx_t ctx) {
+	b2s_final(hash, ctx, 20);
+}
+
 #endif
 
 #if MD_MAP == B2S256 || !defined(STRIP)
@@ -55,4 +120,21 @@ void md_map_b2s256(uint8_t *hash, const uint8_t *msg, int len) {
 	blake2s(hash, msg, 0, 32, len, 0);
 }
 
+void md_init_b2s256(md_ctx_t ctx) {
+	blake2s_state state;
+
+	if (blake2s_init(&state, 32) != 0) {
+		RLC_THROW(ERR_NO_VALID);
+	}
+	memcpy(ctx->state, &state, sizeof(state));
+}
+
+void md_update_b2s256(md_ctx_t ctx, const uint8_t *msg, int len) {
+	b2s_update(ctx, msg, len);
+}
+
+void md_final_b2s256(uint8_t *hash, md_ctx_t ctx) {
+	b2s_final(hash, ctx, 32);
+}
+
 #endif
@@ -37,41 +37,79 @@
 #include "relic_md.h"
 
 /*============================================================================*/
-/* Public definitions                                                         */
+/* Private definitions                                                        */
 /*============================================================================*/
 
-void md_hmac(uint8_t *mac, const uint8_t *in, int in_len, const uint8_t *key,
-    int key_len) {
-#if MD_MAP == SH224 || MD_MAP == SH256 || MD_MAP == BLAKE2S_160 || MD_MAP == BLAKE2S_256
-  #define block_size 64
-#elif MD_MAP == SH384 || MD_MAP == SH512
-  #define block_size  128
+/**
+ * Block size in bytes of the chosen hash function.
+ */
+#if MD_MAP == SH384 || MD_MAP == SH512
+#define block_size		128
+#else
+#define block_size		64
 #endif
-    uint8_t opad[block_size + RLC_MD_LEN];
-    uint8_t *ipad = RLC_ALLOCA(uint8_t, block_size + in_len);
-	uint8_t _key[RLC_MAX(RLC_MD_LEN, block_size)];
 
-    if (ipad == NULL) {
-        RLC_THROW(ERR_NO_MEMORY);
-    }
+/**
+ * Zeroes a buffer holding key material through a volatile pointer, so that the
+ * compiler cannot drop the stores.
+ *
+ * @param[out] buf			- the buffer to zero.
+ * @param[in] len			- the buffer length in bytes.
+ */
+static void md_hmac_wipe(void *buf, size_t len) {
+	volatile uint8_t *p = (volatile uint8_t *)buf;
+
+	while (len-- > 0) {
+		*p++ = 0;
+	}
+}
+
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+void md_hmac_init(md_hmac_ctx_t ctx, const uint8_t *key, int key_len) {
+	uint8_t ipad[block_size], _key[RLC_MAX(RLC_MD_LEN, block_size)];
 
 	if (key_len > block_size) {
 		md_map(_key, key, key_len);
-		key = _key;
 		key_len = RLC_MD_LEN;
-	}
-	if (key_len <= block_size) {
+	} else {
 		memcpy(_key, key, key_len);
-		memset(_key + key_len, 0, block_size - key_len);
-		key = _key;
 	}
+	memset(_key + key_len, 0, block_size - key_len);
 	for (int i = 0; i < block_size; i++) {
-		opad[i] = 0x5C ^ key[i];
-		ipad[i] = 0x36 ^ key[i];
+		ctx->opad[i] = 0x5C ^ _key[i];
+		ipad[i] = 0x36 ^ _key[i];
 	}
-	memcpy(ipad + block_size, in, in_len);
-	md_map(opad + block_size, ipad, block_size + in_len);
-	md_map(mac, opad, block_size + RLC_MD_LEN);
+	md_init(ctx->ctx);
+	md_update(ctx->ctx, ipad, block_size);
+	md_hmac_wipe(ipad, sizeof(ipad));
+	md_hmac_wipe(_key, sizeof(_key));
+}
+
+void md_hmac_update(md_hmac_ctx_t ctx, const uint8_t *in, int in_len) {
+	md_update(ctx->ctx, in, in_len);
+}
+
+void md_hmac_final(uint8_t *mac, md_hmac_ctx_t ctx) {
+	uint8_t h[RLC_MD_LEN];
+
+	md_final(h, ctx->ctx);
+	md_init(ctx->ctx);
+	md_update(ctx->ctx, ctx->opad, block_size);
+	md_update(ctx->ctx, h, RLC_MD_LEN);
+	md_final(mac, ctx->ctx);
+	/* the outer pad and hash state are key-dependent, so erase them */
+	md_hmac_wipe(h, sizeof(h));
+	md_hmac_wipe(ctx, sizeof(md_hmac_ctx_st));
+}
+
+void md_hmac(uint8_t *mac, const uint8_t *in, int in_len, const uint8_t *key,
+		int key_len) {
+	md_hmac_ctx_t ctx;
 
-    RLC_FREE(ipad);
+	md_hmac_init(ctx, key, key_len);
+	md_hmac_update(ctx, in, in_len);
+	md_hmac_final(mac, ctx);
 }
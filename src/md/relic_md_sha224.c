@@ -54,4 +54,23 @@ void md_map_sh224(uint8_t *hash, const uint8_t *msg, int len) {
 	}
 }
 
+
+void md_init_sh224(md_ctx_t ctx) {
+	if (SHA224Reset((SHA224Context *)ctx->state) != shaSuccess) {
+		RLC_THROW(ERR_NO_VALID);
+	}
+}
+
+void md_update_sh224(md_ctx_t ctx, const uint8_t *msg, int len) {
+	if (SHA224Input((SHA224Context *)ctx->state, msg, len) != shaSuccess) {
+		RLC_THROW(ERR_NO_VALID);
+	}
+}
+
+void md_final_sh224(uint8_t *hash, md_ctx_t ctx) {
+	if (SHA224Result((SHA224Context *)ctx->state, hash) != shaSuccess) {
+		RLC_THROW(ERR_NO_VALID);
+	}
+}
+
 #endif
@@ -32,6 +32,7 @@
 #include "relic_conf.h"
 #include "relic_core.h"
 #include "relic_md.h"
+#include "relic_arch.h"
 #include "sha.h"
 
 /*============================================================================*/
@@ -54,4 +55,42 @@ void md_map_sh256(uint8_t *hash, const uint8_t *msg, int len) {
 	}
 }
 
+void md_map_sh256_many(uint8_t *hash, const uint8_t *msg[], const int len[],
+		int n) {
+	int i = 0;
+
+#if ARCH == X64 && (defined(__GNUC__) || defined(__clang__))
+	/* The SHA extensions hash a single stream faster than eight AVX2 lanes. */
+	if (arch_cpu_has(RLC_ARCH_AVX2) && !arch_cpu_has(RLC_ARCH_SHA)) {
+		for (; i + 1 < n; i += 8) {
+			SHA256x8(hash + i * RLC_MD_LEN_SH256, msg + i, len + i,
+					RLC_MIN(8, n - i));
+		}
+	}
+#endif
+
+	for (; i < n; i++) {
+		md_map_sh256(hash + i * RLC_MD_LEN_SH256, msg[i], len[i]);
+	}
+}
+
+
+void md_init_sh256(md_ctx_t ctx) {
+	if (SHA256Reset((SHA256Context *)ctx->state) != shaSuccess) {
+		RLC_THROW(ERR_NO_VALID);
+	}
+}
+
+void md_update_sh256(md_ctx_t ctx, const uint8_t *msg, int len) {
+	if (SHA256Input((SHA256Context *)ctx->state, msg, len) != shaSuccess) {
+		RLC_THROW(ERR_NO_VALID);
+	}
+}
+
+void md_final_sh256(uint8_t *hash, md_ctx_t ctx) {
+	if (SHA256Result((SHA256Context *)ctx->state, hash) != shaSuccess) {
+		RLC_THROW(ERR_NO_VALID);
+	}
+}
+
 #endif
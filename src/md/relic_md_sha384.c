@@ -54,4 +54,23 @@ void md_map_sh384(uint8_t *hash, const uint8_t *msg, int len) {
 	}
 }
 
+
+void md_init_sh384(md_ctx_t ctx) {
+	if (SHA384Reset((SHA384Context *)ctx->state) != shaSuccess) {
+		RLC_THROW(ERR_NO_VALID);
+	}
+}
+
+void md_update_sh384(md_ctx_t ctx, const uint8_t *msg, int len) {
+	if (SHA384Input((SHA384Context *)ctx->state, msg, len) != shaSuccess) {
+		RLC_THROW(ERR_NO_VALID);
+	}
+}
+
+void md_final_sh384(uint8_t *hash, md_ctx_t ctx) {
+	if (SHA384Result((SHA384Context *)ctx->state, hash) != shaSuccess) {
+		RLC_THROW(ERR_NO_VALID);
+	}
+}
+
 #endif
@@ -34,6 +34,15 @@
 #include "relic_md.h"
 #include "sha.h"
 
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Makes sure that the largest SHA-2 state fits in an incremental hash context.
+ */
+typedef char sha512_fits[sizeof(SHA512Context) <= sizeof(md_ctx_st) ? 1 : -1];
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -54,4 +63,23 @@ void md_map_sh512(uint8_t *hash, const uint8_t *msg, int len) {
 	}
 }
 
+
+void md_init_sh512(md_ctx_t ctx) {
+	if (SHA512Reset((SHA512Context *)ctx->state) != shaSuccess) {
+		RLC_THROW(ERR_NO_VALID);
+	}
+}
+
+void md_update_sh512(md_ctx_t ctx, const uint8_t *msg, int len) {
+	if (SHA512Input((SHA512Context *)ctx->state, msg, len) != shaSuccess) {
+		RLC_THROW(ERR_NO_VALID);
+	}
+}
+
+void md_final_sh512(uint8_t *hash, md_ctx_t ctx) {
+	if (SHA512Result((SHA512Context *)ctx->state, hash) != shaSuccess) {
+		RLC_THROW(ERR_NO_VALID);
+	}
+}
+
 #endif
@@ -33,6 +33,7 @@
 
 #include "relic_conf.h"
 #include "relic_core.h"
+#include "relic_md.h"
 #include "sha.h"
 
 /*============================================================================*/
@@ -49,6 +50,15 @@
 		}                                                                      \
 	} while (0)
 
+/**
+ * Block size in bytes of the chosen hash function.
+ */
+#if MD_MAP == SH384 || MD_MAP == SH512
+#define block_size		128
+#else
+#define block_size		64
+#endif
+
 /**
  * Construct an extensible-output function based on HASH, which must be
  * one of SHA224, SHA256, SHA384, or SHA512.
@@ -109,6 +119,34 @@
 		}                                                                                                         \
 	}
 
+#if MD_MAP == SH256 || !defined(STRIP)
+
+/**
+ * Computes the block b_0 of md_xmd with SHA-256, resuming from the state after
+ * the zero padding block cached in a prepared domain separation tag.
+ *
+ * @param[out] b_0				- the resulting block.
+ * @param[in] buf_len			- the requested size of the output.
+ * @param[in] in				- the message to hash.
+ * @param[in] in_len			- the message length in bytes.
+ * @param[in] ctx				- the prepared domain separation tag.
+ */
+static void xmd_sh256_b_0(uint8_t *b_0, int buf_len, const uint8_t *in,
+		int in_len, const md_xmd_ctx_t ctx) {
+	const uint8_t l_i_b_0_str[] = { buf_len >> 8, buf_len & 0xff, 0 };
+	SHA256Context sha;
+
+	_check_md(SHA256Reset(&sha));
+	memcpy(sha.Intermediate_Hash, ctx->mid, sizeof(ctx->mid));
+	sha.Length_Low = 8 * SHA256_Message_Block_Size;
+	_check_md(SHA256Input(&sha, in, in_len));
+	_check_md(SHA256Input(&sha, l_i_b_0_str, 3));
+	_check_md(SHA256Input(&sha, ctx->dst, ctx->dst_len + 1));
+	_check_md(SHA256Result(&sha, b_0));
+}
+
+#endif
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -128,3 +166,173 @@ make_md_xmd(SHA384, sh384)
 #if MD_MAP == SH512 || !defined(STRIP)
 make_md_xmd(SHA512, sh512)
 #endif
+
+#if MD_MAP == SH256 || !defined(STRIP)
+
+void md_xmd_sh256_many(uint8_t *buf, int buf_len, const uint8_t *in[],
+		const int in_len[], int n, const uint8_t *dst, int dst_len) {
+	const int ell = (buf_len + SHA256HashSize - 1) / SHA256HashSize;
+	uint8_t b_0[8][SHA256HashSize], b_i[8 * SHA256HashSize];
+	uint8_t str[8][SHA256HashSize + 1 + 255 + 1];
+	const uint8_t *ptr[8];
+	int len[8];
+	md_xmd_ctx_t ctx;
+
+	if (buf_len < 0 || ell > 255 || dst_len > 255 || dst_len < 0) {
+		RLC_THROW(ERR_NO_VALID);
+		return;
+	}
+
+	md_xmd_ctx_init(ctx, dst, dst_len);
+	for (int k = 0; k < n; k += 8) {
+		const int m = RLC_MIN(8, n - k);
+
+		/* compute b_0 for each message, these have different lengths */
+		for (int j = 0; j < m; j++) {
+			xmd_sh256_b_0(b_0[j], buf_len, in[k + j], in_len[k + j], ctx);
+			memset(b_i + j * SHA256HashSize, 0, SHA256HashSize);
+			memcpy(str[j] + SHA256HashSize + 1, ctx->dst, dst_len + 1);
+			ptr[j] = str[j];
+			len[j] = SHA256HashSize + 1 + dst_len + 1;
+		}
+
+		/* compute b_i of all messages at once, these have the same length */
+		for (int i = 1; i <= ell; i++) {
+			const int rem_after = buf_len - i * SHA256HashSize;
+			const int copy_len = SHA256HashSize + RLC_MIN(rem_after, 0);
+
+			for (int j = 0; j < m; j++) {
+				for (int l = 0; l < SHA256HashSize; l++) {
+					str[j][l] = b_0[j][l] ^ b_i[j * SHA256HashSize + l];
+				}
+				str[j][SHA256HashSize] = i;
+			}
+			md_map_sh256_many(b_i, ptr, len, m);
+			for (int j = 0; j < m; j++) {
+				memcpy(buf + (k + j) * buf_len + (i - 1) * SHA256HashSize,
+						b_i + j * SHA256HashSize, copy_len);
+			}
+		}
+	}
+}
+
+#endif
+
+void md_xmd_ctx_init(md_xmd_ctx_t ctx, const uint8_t *dst, int dst_len) {
+	if (dst_len < 0 || dst_len > 255) {
+		RLC_THROW(ERR_NO_VALID);
+		return;
+	}
+
+	memcpy(ctx->dst, dst, dst_len);
+	ctx->dst[dst_len] = dst_len;
+	ctx->dst_len = dst_len;
+
+#if MD_MAP == SH256 || !defined(STRIP)
+	const uint8_t Z_pad[SHA256_Message_Block_Size] = { 0 };
+	/* the input of every b_i is b_0 ^ b_(i-1) || I2OSP(i, 1) || DST_prime */
+	const int len = SHA256HashSize + 1 + dst_len + 1;
+	const uint64_t bits = 8 * (uint64_t)len;
+	SHA256Context sha;
+
+	_check_md(SHA256Reset(&sha));
+	_check_md(SHA256Input(&sha, Z_pad, SHA256_Message_Block_Size));
+	memcpy(ctx->mid, sha.Intermediate_Hash, sizeof(ctx->mid));
+
+	/* pad the input of b_i once, leaving room for the leading bytes */
+	ctx->blocks = (len + 9 + SHA256_Message_Block_Size - 1) /
+			SHA256_Message_Block_Size;
+	memset(ctx->pad, 0, sizeof(ctx->pad));
+	memcpy(ctx->pad + SHA256HashSize + 1, ctx->dst, dst_len + 1);
+	ctx->pad[len] = 0x80;
+	for (int i = 0; i < 8; i++) {
+		ctx->pad[ctx->blocks * SHA256_Message_Block_Size - 1 - i] =
+				(uint8_t)(bits >> (8 * i));
+	}
+#endif
+}
+
+void md_xmd_ctx_run(uint8_t *buf, int buf_len, const uint8_t *in, int in_len,
+		const md_xmd_ctx_t ctx) {
+#if MD_MAP == SH256
+	const int ell = (buf_len + SHA256HashSize - 1) / SHA256HashSize;
+	uint8_t b_0[SHA256HashSize], b_i[SHA256HashSize] = { 0 };
+	uint8_t pad[sizeof(ctx->pad)];
+	SHA256Context sha;
+
+	if (buf_len < 0 || ell > 255) {
+		RLC_THROW(ERR_NO_VALID);
+		return;
+	}
+
+	xmd_sh256_b_0(b_0, buf_len, in, in_len, ctx);
+
+	memcpy(pad, ctx->pad, ctx->blocks * SHA256_Message_Block_Size);
+	for (int i = 1; i <= ell; i++) {
+		const int rem_after = buf_len - i * SHA256HashSize;
+		const int copy_len = SHA256HashSize + RLC_MIN(rem_after, 0);
+
+		for (int j = 0; j < SHA256HashSize; j++) {
+			pad[j] = b_0[j] ^ b_i[j];
+		}
+		pad[SHA256HashSize] = i;
+
+		/* compress the padded blocks directly from the initial state */
+		_check_md(SHA256Reset(&sha));
+		SHA256ProcessBlocks(sha.Intermediate_Hash, pad, ctx->blocks);
+		for (int j = 0; j < SHA256HashSize; j++) {
+			b_i[j] = sha.Intermediate_Hash[j >> 2] >> (8 * (3 - (j & 3)));
+		}
+		memcpy(buf + (i - 1) * SHA256HashSize, b_i, copy_len);
+	}
+#else
+	md_xmd(buf, buf_len, in, in_len, ctx->dst, ctx->dst_len);
+#endif
+}
+
+void md_xmd_init(md_ctx_t ctx) {
+	const uint8_t Z_pad[block_size] = { 0 };
+
+	md_init(ctx);
+	md_update(ctx, Z_pad, block_size);
+}
+
+void md_xmd_update(md_ctx_t ctx, const uint8_t *in, int in_len) {
+	md_update(ctx, in, in_len);
+}
+
+void md_xmd_final(uint8_t *buf, int buf_len, md_ctx_t ctx, const uint8_t *dst,
+		int dst_len) {
+	const int ell = (buf_len + RLC_MD_LEN - 1) / RLC_MD_LEN;
+	const uint8_t l_i_b_0_str[] = { buf_len >> 8, buf_len & 0xff, 0, dst_len };
+	const uint8_t *dstlen_str = l_i_b_0_str + 3;
+	uint8_t b_0[RLC_MD_LEN], b_i[RLC_MD_LEN + 1] = { 0 };
+
+	if (buf_len < 0 || ell > 255 || dst_len < 0 || dst_len > 255) {
+		RLC_THROW(ERR_NO_VALID);
+		return;
+	}
+
+	/* finish b_0 after the zero padding and the message */
+	md_update(ctx, l_i_b_0_str, 3);
+	md_update(ctx, dst, dst_len);
+	md_update(ctx, dstlen_str, 1);
+	md_final(b_0, ctx);
+
+	for (int i = 1; i <= ell; i++) {
+		const int rem_after = buf_len - i * RLC_MD_LEN;
+		const int copy_len = RLC_MD_LEN + RLC_MIN(rem_after, 0);
+
+		for (int j = 0; j < RLC_MD_LEN; j++) {
+			b_i[j] = b_0[j] ^ b_i[j];
+		}
+		b_i[RLC_MD_LEN] = i;
+
+		md_init(ctx);
+		md_update(ctx, b_i, RLC_MD_LEN + 1);
+		md_update(ctx, dst, dst_len);
+		md_update(ctx, dstlen_str, 1);
+		md_final(b_i, ctx);
+		memcpy(buf + (i - 1) * RLC_MD_LEN, b_i, copy_len);
+	}
+}
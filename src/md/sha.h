@@ -174,6 +174,16 @@ extern int SHA256FinalBits(SHA256Context *, const uint8_t bits,
 extern int SHA256Result(SHA256Context *,
                         uint8_t Message_Digest[SHA256HashSize]);
 
+/* Compresses whole blocks into a SHA-256 intermediate hash */
+extern void SHA256ProcessBlocks(uint32_t Intermediate_Hash[],
+                                const uint8_t *data, unsigned int blocks);
+
+/* SHA-256 kernels for x86-64 processors, see sha256-x64.c */
+extern void SHA256ProcessBlocksSHANI(uint32_t H[8], const uint8_t *data,
+                                     unsigned int blocks);
+extern void SHA256x8(uint8_t *hash, const uint8_t *msg[], const int len[],
+                     int n);
+
 /* SHA-384 */
 extern int SHA384Reset(SHA384Context *);
 extern int SHA384Input(SHA384Context *, const uint8_t *bytes,
@@ -36,6 +36,8 @@
  *   final few bits of the input.
  */
 
+#include "relic_conf.h"
+#include "relic_arch.h"
 #include "sha.h"
 
 /* Define the SHA shift, rotate left and rotate right macro */
@@ -69,6 +71,8 @@ static void SHA224_256Finalize(SHA256Context *context,
 static void SHA224_256PadMessage(SHA256Context *context,
   uint8_t Pad_Byte);
 static void SHA224_256ProcessMessageBlock(SHA256Context *context);
+static void SHA224_256ProcessBlocks(uint32_t *Intermediate_Hash,
+  const uint8_t *data, unsigned int blocks);
 static int SHA224_256Reset(SHA256Context *context, uint32_t *H0);
 static int SHA224_256ResultN(SHA256Context *context,
   uint8_t Message_Digest[], int HashSize);
@@ -234,7 +238,27 @@ int SHA256Input(SHA256Context *context, const uint8_t *message_array,
   if (context->Corrupted)
      return context->Corrupted;
 
-  while (length-- && !context->Corrupted) {
+  while (length && !context->Corrupted) {
+    /*
+     * Compress whole blocks directly from the message when no
+     * partial block is buffered.
+     */
+    if (context->Message_Block_Index == 0 &&
+        length >= SHA256_Message_Block_Size) {
+      unsigned int blocks = length / SHA256_Message_Block_Size;
+      unsigned int i;
+      uint32_t addTemp;
+      for (i = 0; i < blocks && !context->Corrupted; i++)
+        SHA224_256AddLength(context, 8 * SHA256_Message_Block_Size);
+      if (context->Corrupted)
+        break;
+      SHA224_256ProcessBlocks(context->Intermediate_Hash, message_array,
+        blocks);
+      message_array += blocks * SHA256_Message_Block_Size;
+      length -= blocks * SHA256_Message_Block_Size;
+      continue;
+    }
+
     context->Message_Block[context->Message_Block_Index++] =
     		(uint8_t)(*message_array & 0xFF);
 
@@ -244,6 +268,7 @@ int SHA256Input(SHA256Context *context, const uint8_t *message_array,
       SHA224_256ProcessMessageBlock(context);
 
     message_array++;
+    length--;
   }
 
   return shaSuccess;
@@ -308,6 +333,30 @@ int SHA256FinalBits(SHA256Context *context,
   return shaSuccess;
 }
 
+/*
+ * SHA256ProcessBlocks
+ *
+ * Description:
+ *   This function compresses whole, already padded 512-bit blocks
+ *   into an intermediate hash, bypassing the message buffer.
+ *
+ * Parameters:
+ *   Intermediate_Hash: [in/out]
+ *     The intermediate hash to update.
+ *   data: [in]
+ *     The message blocks.
+ *   blocks: [in]
+ *     The number of blocks.
+ *
+ * Returns:
+ *   Nothing.
+ */
+void SHA256ProcessBlocks(uint32_t Intermediate_Hash[], const uint8_t *data,
+    unsigned int blocks)
+{
+  SHA224_256ProcessBlocks(Intermediate_Hash, data, blocks);
+}
+
 /*
  * SHA256Result
  *
@@ -434,13 +483,39 @@ static void SHA224_256PadMessage(SHA256Context *context,
  *
  * Returns:
  *   Nothing.
+ */
+static void SHA224_256ProcessMessageBlock(SHA256Context *context)
+{
+  SHA224_256ProcessBlocks(context->Intermediate_Hash,
+    context->Message_Block, 1);
+  context->Message_Block_Index = 0;
+}
+
+/*
+ * SHA224_256ProcessBlocks
+ *
+ * Description:
+ *   This function will process consecutive 512-bit blocks of the
+ *   message, using the SHA extensions when the processor has them.
+ *
+ * Parameters:
+ *   Intermediate_Hash: [in/out]
+ *     The intermediate hash to update
+ *   data: [in]
+ *     The message blocks
+ *   blocks: [in]
+ *     The number of blocks
+ *
+ * Returns:
+ *   Nothing.
  *
  * Comments:
  *   Many of the variable names in this code, especially the
  *   single character names, were used because those were the
  *   names used in the publication.
  */
-static void SHA224_256ProcessMessageBlock(SHA256Context *context)
+static void SHA224_256ProcessBlocks(uint32_t *Intermediate_Hash,
+  const uint8_t *data, unsigned int blocks)
 {
   /* Constants defined in FIPS-180-2, section 4.2.2 */
   static const uint32_t K[64] = {
@@ -463,51 +538,58 @@ static void SHA224_256ProcessMessageBlock(SHA256Context *context)
   uint32_t   W[64];                   /* Word sequence */
   uint32_t   A, B, C, D, E, F, G, H;  /* Word buffers */
 
-  /*
-   * Initialize the first 16 words in the array W
-   */
-  for (t = t4 = 0; t < 16; t++, t4 += 4)
-    W[t] = (((uint32_t)context->Message_Block[t4]) << 24) |
-           (((uint32_t)context->Message_Block[t4 + 1]) << 16) |
-           (((uint32_t)context->Message_Block[t4 + 2]) << 8) |
-           (((uint32_t)context->Message_Block[t4 + 3]));
-
-  for (t = 16; t < 64; t++)
-    W[t] = SHA256_sigma1(W[t-2]) + W[t-7] +
-        SHA256_sigma0(W[t-15]) + W[t-16];
-
-  A = context->Intermediate_Hash[0];
-  B = context->Intermediate_Hash[1];
-  C = context->Intermediate_Hash[2];
-  D = context->Intermediate_Hash[3];
-  E = context->Intermediate_Hash[4];
-  F = context->Intermediate_Hash[5];
-  G = context->Intermediate_Hash[6];
-  H = context->Intermediate_Hash[7];
-
-  for (t = 0; t < 64; t++) {
-    temp1 = H + SHA256_SIGMA1(E) + SHA_Ch(E,F,G) + K[t] + W[t];
-    temp2 = SHA256_SIGMA0(A) + SHA_Maj(A,B,C);
-    H = G;
-    G = F;
-    F = E;
-    E = D + temp1;
-    D = C;
-    C = B;
-    B = A;
-    A = temp1 + temp2;
+#if ARCH == X64 && (defined(__GNUC__) || defined(__clang__))
+  if (arch_cpu_has(RLC_ARCH_SHA)) {
+    SHA256ProcessBlocksSHANI(Intermediate_Hash, data, blocks);
+    return;
+  }
+#endif
+
+  for (; blocks > 0; blocks--, data += SHA256_Message_Block_Size) {
+    /*
+     * Initialize the first 16 words in the array W
+     */
+    for (t = t4 = 0; t < 16; t++, t4 += 4)
+      W[t] = (((uint32_t)data[t4]) << 24) |
+             (((uint32_t)data[t4 + 1]) << 16) |
+             (((uint32_t)data[t4 + 2]) << 8) |
+             (((uint32_t)data[t4 + 3]));
+
+    for (t = 16; t < 64; t++)
+      W[t] = SHA256_sigma1(W[t-2]) + W[t-7] +
+          SHA256_sigma0(W[t-15]) + W[t-16];
+
+    A = Intermediate_Hash[0];
+    B = Intermediate_Hash[1];
+    C = Intermediate_Hash[2];
+    D = Intermediate_Hash[3];
+    E = Intermediate_Hash[4];
+    F = Intermediate_Hash[5];
+    G = Intermediate_Hash[6];
+    H = Intermediate_Hash[7];
+
+    for (t = 0; t < 64; t++) {
+      temp1 = H + SHA256_SIGMA1(E) + SHA_Ch(E,F,G) + K[t] + W[t];
+      temp2 = SHA256_SIGMA0(A) + SHA_Maj(A,B,C);
+      H = G;
+      G = F;
+      F = E;
+      E = D + temp1;
+      D = C;
+      C = B;
+      B = A;
+      A = temp1 + temp2;
+    }
+
+    Intermediate_Hash[0] += A;
+    Intermediate_Hash[1] += B;
+    Intermediate_Hash[2] += C;
+    Intermediate_Hash[3] += D;
+    Intermediate_Hash[4] += E;
+    Intermediate_Hash[5] += F;
+    Intermediate_Hash[6] += G;
+    Intermediate_Hash[7] += H;
   }
-
-  context->Intermediate_Hash[0] += A;
-  context->Intermediate_Hash[1] += B;
-  context->Intermediate_Hash[2] += C;
-  context->Intermediate_Hash[3] += D;
-  context->Intermediate_Hash[4] += E;
-  context->Intermediate_Hash[5] += F;
-  context->Intermediate_Hash[6] += G;
-  context->Intermediate_Hash[7] += H;
-
-  context->Message_Block_Index = 0;
 }
 
 /*
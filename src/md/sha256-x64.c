@@ -0,0 +1,306 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (c) 2009 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Implementation of the SHA-256 compression function with the SHA extensions
+ * and of an eight-lane SHA-256 with AVX2 for x86-64 processors. The kernels
+ * are compiled for their instruction sets with function attributes and must
+ * only be called after arch_cpu_has() reports the extension.
+ *
+ * @ingroup md
+ */
+
+#include <string.h>
+
+#include "relic_conf.h"
+#include "sha.h"
+
+#if ARCH == X64 && (defined(__GNUC__) || defined(__clang__))
+
+#include <immintrin.h>
+
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Round constants defined in FIPS 180-4, section 4.2.2.
+ */
+static const uint32_t K256[64] __attribute__((aligned(16))) = {
+	0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1,
+	0x923f82a4, 0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+	0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786,
+	0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+	0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147,
+	0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+	0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b,
+	0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+	0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a,
+	0x5b9cca4f, 0x682e6ff3, 0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+	0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+/**
+ * Initial hash value defined in FIPS 180-4, section 5.3.3.
+ */
+static const uint32_t H256[8] = {
+	0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+	0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+};
+
+/**
+ * Performs four rounds with the SHA extensions, given the next four message
+ * words.
+ *
+ * @param[in,out] S0		- the state words A, B, E, F.
+ * @param[in,out] S1		- the state words C, D, G, H.
+ * @param[in] M				- the message words.
+ * @param[in] I				- the index of the four rounds.
+ */
+#define SHANI_RNDS(S0, S1, M, I)											\
+	T = _mm_add_epi32(M, _mm_load_si128((const __m128i *)(K256 + 4 * (I))));\
+	S1 = _mm_sha256rnds2_epu32(S1, S0, T);									\
+	T = _mm_shuffle_epi32(T, 0x0E);											\
+	S0 = _mm_sha256rnds2_epu32(S0, S1, T);
+
+/**
+ * Computes the next four message words with the SHA extensions, overwriting
+ * the oldest ones.
+ *
+ * @param[in,out] W0		- the oldest message words.
+ * @param[in] W1, W2, W3	- the remaining message words, from oldest.
+ */
+#define SHANI_SCHED(W0, W1, W2, W3)											\
+	W0 = _mm_sha256msg1_epu32(W0, W1);										\
+	W0 = _mm_add_epi32(W0, _mm_alignr_epi8(W3, W2, 4));						\
+	W0 = _mm_sha256msg2_epu32(W0, W3);
+
+/**
+ * Rotates the lanes of a vector of 32-bit words to the right.
+ *
+ * @param[in] X				- the vector.
+ * @param[in] N				- the number of bits.
+ */
+#define AVX2_ROR(X, N)														\
+	_mm256_or_si256(_mm256_srli_epi32(X, N), _mm256_slli_epi32(X, 32 - (N)))
+
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+__attribute__((target("sha,sse4.1,ssse3")))
+void SHA256ProcessBlocksSHANI(uint32_t H[8], const uint8_t *data, unsigned n) {
+	__m128i S0, S1, T, W0, W1, W2, W3, ABEF, CDGH;
+	const __m128i mask = _mm_set_epi64x(0x0C0D0E0F08090A0BULL,
+			0x0405060700010203ULL);
+
+	/* Load the state in the order A, B, E, F and C, D, G, H. */
+	T = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)H), 0xB1);
+	S1 = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)(H + 4)), 0x1B);
+	S0 = _mm_alignr_epi8(T, S1, 8);
+	S1 = _mm_blend_epi16(S1, T, 0xF0);
+
+	for (; n > 0; n--, data += SHA256_Message_Block_Size) {
+		ABEF = S0;
+		CDGH = S1;
+
+		W0 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)data), mask);
+		SHANI_RNDS(S0, S1, W0, 0);
+		W1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 16)),
+				mask);
+		SHANI_RNDS(S0, S1, W1, 1);
+		W2 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 32)),
+				mask);
+		SHANI_RNDS(S0, S1, W2, 2);
+		W3 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 48)),
+				mask);
+		SHANI_RNDS(S0, S1, W3, 3);
+
+		for (int i = 4; i < 16; i += 4) {
+			SHANI_SCHED(W0, W1, W2, W3);
+			SHANI_RNDS(S0, S1, W0, i);
+			SHANI_SCHED(W1, W2, W3, W0);
+			SHANI_RNDS(S0, S1, W1, i + 1);
+			SHANI_SCHED(W2, W3, W0, W1);
+			SHANI_RNDS(S0, S1, W2, i + 2);
+			SHANI_SCHED(W3, W0, W1, W2);
+			SHANI_RNDS(S0, S1, W3, i + 3);
+		}
+
+		S0 = _mm_add_epi32(S0, ABEF);
+		S1 = _mm_add_epi32(S1, CDGH);
+	}
+
+	/* Store the state back in the order A, B, C, D and E, F, G, H. */
+	T = _mm_shuffle_epi32(S0, 0x1B);
+	S1 = _mm_shuffle_epi32(S1, 0xB1);
+	S0 = _mm_blend_epi16(T, S1, 0xF0);
+	S1 = _mm_alignr_epi8(S1, T, 8);
+	_mm_storeu_si128((__m128i *)H, S0);
+	_mm_storeu_si128((__m128i *)(H + 4), S1);
+}
+
+/**
+ * Compresses one block of each of eight independent messages with AVX2. Word
+ * j of the state of lane i is stored in H[j][i].
+ *
+ * @param[in,out] H			- the transposed states.
+ * @param[in] blk			- the blocks to compress.
+ */
+__attribute__((target("avx2")))
+static void SHA256ProcessBlocksx8(__m256i H[8], const uint8_t *blk[8]) {
+	__m256i W[16], A, B, C, D, E, F, G, X, Y, T1, T2;
+	int t, i;
+
+	for (t = 0; t < 16; t++) {
+		uint32_t w[8];
+		for (i = 0; i < 8; i++) {
+			w[i] = ((uint32_t)blk[i][4 * t] << 24) |
+					((uint32_t)blk[i][4 * t + 1] << 16) |
+					((uint32_t)blk[i][4 * t + 2] << 8) |
+					((uint32_t)blk[i][4 * t + 3]);
+		}
+		W[t] = _mm256_loadu_si256((const __m256i *)w);
+	}
+
+	A = H[0];
+	B = H[1];
+	C = H[2];
+	D = H[3];
+	E = H[4];
+	F = H[5];
+	G = H[6];
+	X = H[7];
+
+	for (t = 0; t < 64; t++) {
+		if (t >= 16) {
+			/* W[t] = s1(W[t-2]) + W[t-7] + s0(W[t-15]) + W[t-16]. */
+			Y = W[(t - 15) & 15];
+			T1 = _mm256_xor_si256(AVX2_ROR(Y, 7), AVX2_ROR(Y, 18));
+			T1 = _mm256_xor_si256(T1, _mm256_srli_epi32(Y, 3));
+			Y = W[(t - 2) & 15];
+			T2 = _mm256_xor_si256(AVX2_ROR(Y, 17), AVX2_ROR(Y, 19));
+			T2 = _mm256_xor_si256(T2, _mm256_srli_epi32(Y, 10));
+			T1 = _mm256_add_epi32(T1, T2);
+			T1 = _mm256_add_epi32(T1, W[(t - 7) & 15]);
+			W[t & 15] = _mm256_add_epi32(T1, W[t & 15]);
+		}
+		/* T1 = H + S1(E) + Ch(E, F, G) + K[t] + W[t]. */
+		T1 = _mm256_xor_si256(AVX2_ROR(E, 6), AVX2_ROR(E, 11));
+		T1 = _mm256_xor_si256(T1, AVX2_ROR(E, 25));
+		T1 = _mm256_add_epi32(T1, X);
+		T2 = _mm256_xor_si256(_mm256_and_si256(E, F),
+				_mm256_andnot_si256(E, G));
+		T1 = _mm256_add_epi32(T1, T2);
+		T1 = _mm256_add_epi32(T1, _mm256_set1_epi32((int)K256[t]));
+		T1 = _mm256_add_epi32(T1, W[t & 15]);
+		/* T2 = S0(A) + Maj(A, B, C). */
+		T2 = _mm256_xor_si256(AVX2_ROR(A, 2), AVX2_ROR(A, 13));
+		T2 = _mm256_xor_si256(T2, AVX2_ROR(A, 22));
+		Y = _mm256_or_si256(_mm256_and_si256(A, B),
+				_mm256_and_si256(C, _mm256_or_si256(A, B)));
+		T2 = _mm256_add_epi32(T2, Y);
+		X = G;
+		G = F;
+		F = E;
+		E = _mm256_add_epi32(D, T1);
+		D = C;
+		C = B;
+		B = A;
+		A = _mm256_add_epi32(T1, T2);
+	}
+
+	H[0] = _mm256_add_epi32(H[0], A);
+	H[1] = _mm256_add_epi32(H[1], B);
+	H[2] = _mm256_add_epi32(H[2], C);
+	H[3] = _mm256_add_epi32(H[3], D);
+	H[4] = _mm256_add_epi32(H[4], E);
+	H[5] = _mm256_add_epi32(H[5], F);
+	H[6] = _mm256_add_epi32(H[6], G);
+	H[7] = _mm256_add_epi32(H[7], X);
+}
+
+__attribute__((target("avx2")))
+void SHA256x8(uint8_t *hash, const uint8_t *msg[], const int len[], int n) {
+	/* Each lane needs at most two padded blocks after its full blocks. */
+	uint8_t tail[8][2 * SHA256_Message_Block_Size];
+	const uint8_t zero[SHA256_Message_Block_Size] = { 0 };
+	const uint8_t *blk[8];
+	int full[8], total[8], max = 0, i, j;
+	__m256i H[8];
+	uint32_t out[8][8];
+
+	for (i = 0; i < 8; i++) {
+		int l = (i < n ? len[i] : 0);
+		uint64_t bits = (uint64_t)l << 3;
+		int rem = l % SHA256_Message_Block_Size;
+
+		full[i] = l / SHA256_Message_Block_Size;
+		total[i] = full[i] + (rem < SHA256_Message_Block_Size - 8 ? 1 : 2);
+		memset(tail[i], 0, sizeof(tail[i]));
+		if (rem > 0) {
+			memcpy(tail[i], msg[i] + full[i] * SHA256_Message_Block_Size, rem);
+		}
+		tail[i][rem] = 0x80;
+		for (j = 0; j < 8; j++) {
+			tail[i][(total[i] - full[i]) * SHA256_Message_Block_Size - 1 - j] =
+					(uint8_t)(bits >> (8 * j));
+		}
+		if (i < n) {
+			max = (total[i] > max ? total[i] : max);
+		}
+	}
+
+	for (j = 0; j < 8; j++) {
+		H[j] = _mm256_set1_epi32((int)H256[j]);
+	}
+	for (int b = 0; b < max; b++) {
+		for (i = 0; i < 8; i++) {
+			if (b < full[i]) {
+				blk[i] = msg[i] + b * SHA256_Message_Block_Size;
+			} else if (b < total[i]) {
+				blk[i] = tail[i] + (b - full[i]) * SHA256_Message_Block_Size;
+			} else {
+				blk[i] = zero;
+			}
+		}
+		SHA256ProcessBlocksx8(H, blk);
+		/* Save the digests of lanes that just finished. */
+		for (j = 0; j < 8; j++) {
+			_mm256_storeu_si256((__m256i *)out[j], H[j]);
+		}
+		for (i = 0; i < n; i++) {
+			if (b == total[i] - 1) {
+				for (j = 0; j < 32; j++) {
+					hash[i * SHA256HashSize + j] =
+							(uint8_t)(out[j >> 2][i] >> (8 * (3 - (j & 3))));
+				}
+			}
+		}
+	}
+	memset(tail, 0, sizeof(tail));
+}
+
+#endif /* ARCH == X64 && (__GNUC__ || __clang__) */
@@ -43,6 +43,271 @@
  */
 #define gt_rand_imp(A)			RLC_CAT(RLC_GT_LOWER, rand)(A)
 
+/**
+ * Multiplies a point in G_1 by the curve parameter. The parameter is short and
+ * sparse, so the binary method is used to avoid the scalar decomposition
+ * performed by the GLV method, which only holds inside the subgroup.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the point to multiply.
+ * @param[in] x				- the curve parameter.
+ */
+static void g1_mul_par(g1_t c, const g1_t a, const bn_t x) {
+	g1_t t;
+
+	g1_null(t);
+
+	RLC_TRY {
+		g1_new(t);
+
+		g1_copy(t, a);
+		for (int i = bn_bits(x) - 2; i >= 0; i--) {
+			g1_dbl(t, t);
+			if (bn_get_bit(x, i)) {
+				g1_add(t, t, a);
+			}
+		}
+		if (bn_sign(x) == RLC_NEG) {
+			g1_neg(t, t);
+		}
+		g1_copy(c, t);
+	} RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	} RLC_FINALLY {
+		g1_free(t);
+	}
+}
+
+/**
+ * Multiplies a point in G_2 by the curve parameter with the binary method.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the point to multiply.
+ * @param[in] x				- the curve parameter.
+ */
+static void g2_mul_par(g2_t c, g2_t a, const bn_t x) {
+	g2_t t;
+
+	g2_null(t);
+
+	RLC_TRY {
+		g2_new(t);
+
+		g2_copy(t, a);
+		for (int i = bn_bits(x) - 2; i >= 0; i--) {
+			g2_dbl(t, t);
+			if (bn_get_bit(x, i)) {
+				g2_add(t, t, a);
+			}
+		}
+		if (bn_sign(x) == RLC_NEG) {
+			g2_neg(t, t);
+		}
+		g2_copy(c, t);
+	} RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	} RLC_FINALLY {
+		g2_free(t);
+	}
+}
+
+/**
+ * Exponentiates an element of the cyclotomic subgroup by the curve parameter,
+ * walking its sparse signed representation. Uncompressed cyclotomic squarings
+ * are used, because decompression fails on inputs such as the identity.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the element to exponentiate.
+ * @param[in] x				- the curve parameter.
+ */
+static void gt_exp_par(gt_t c, gt_t a, const bn_t x) {
+	const int *b;
+	int i, j, k, l;
+	gt_t t, u;
+
+	gt_null(t);
+	gt_null(u);
+
+	RLC_TRY {
+		gt_new(t);
+		gt_new(u);
+
+		b = fp_prime_get_par_sps(&l);
+		fp12_copy(t, a);
+		fp12_set_dig(c, 1);
+		for (j = 0, i = 0; i < l; i++) {
+			k = (b[i] < 0 ? -b[i] : b[i]);
+			for (; j < k; j++) {
+				fp12_sqr_cyc(t, t);
+			}
+			if (b[i] < 0) {
+				fp12_inv_cyc(u, t);
+				fp12_mul(c, c, u);
+			} else {
+				fp12_mul(c, c, t);
+			}
+		}
+		if (bn_sign(x) == RLC_NEG) {
+			fp12_inv_cyc(c, c);
+		}
+	} RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	} RLC_FINALLY {
+		gt_free(t);
+		gt_free(u);
+	}
+}
+
+/**
+ * Checks if the endomorphism of the current curve acts on G_1 as the scalar
+ * -x^2, where x is the curve parameter. This holds for BLS12 curves when the
+ * cube root of unity stored in the library context is chosen to match.
+ *
+ * @param[in] x				- the curve parameter.
+ * @return a boolean value indicating if the endomorphism has the eigenvalue.
+ */
+static int g1_is_psi_par(const bn_t x) {
+	int r = 0;
+#if defined(EP_ENDOM) && (EP_MUL == LWNAF || EP_FIX == COMBS || EP_FIX == LWNAF || EP_SIM == INTER || !defined(STRIP))
+	bn_t n, t, v1[3], v2[3];
+
+	if (ep_curve_is_pairf() != EP_B12 || !ep_curve_is_endom()) {
+		return 0;
+	}
+
+	bn_null(n);
+	bn_null(t);
+
+	RLC_TRY {
+		bn_new(n);
+		bn_new(t);
+		for (int i = 0; i < 3; i++) {
+			bn_null(v1[i]);
+			bn_null(v2[i]);
+			bn_new(v1[i]);
+			bn_new(v2[i]);
+		}
+
+		/* The GLV basis satisfies v[1] + v[2] * lambda = 0 mod n. */
+		ep_curve_get_ord(n);
+		ep_curve_get_v1(v1);
+		ep_curve_get_v2(v2);
+		bn_sqr(t, x);
+		bn_mul(t, t, v1[2]);
+		bn_sub(t, v1[1], t);
+		bn_mod(t, t, n);
+		r = bn_is_zero(t);
+		bn_sqr(t, x);
+		bn_mul(t, t, v2[2]);
+		bn_sub(t, v2[1], t);
+		bn_mod(t, t, n);
+		r &= bn_is_zero(t);
+	} RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	} RLC_FINALLY {
+		bn_free(n);
+		bn_free(t);
+		for (int i = 0; i < 3; i++) {
+			bn_free(v1[i]);
+			bn_free(v2[i]);
+		}
+	}
+#else
+	(void)x;
+#endif
+	return r;
+}
+
+/**
+ * Checks the subgroup membership of many points in G_1 or G_2, clearing the
+ * flags of points that are not valid and setting them to infinity. Points
+ * already flagged as invalid are skipped.
+ *
+ * @param[in,out] p			- the points in G_1, or NULL.
+ * @param[in,out] q			- the points in G_2, or NULL.
+ * @param[in,out] r			- the flags indicating which points are valid.
+ * @param[in] n				- the number of points.
+ */
+static void pc_is_valid_sim(g1_t *p, g2_t *q, int *r, int n) {
+	for (int i = 0; i < n; i++) {
+		if (r[i] && p != NULL && !g1_is_valid(p[i])) {
+			g1_set_infty(p[i]);
+			r[i] = 0;
+		}
+		if (r[i] && q != NULL && !g2_is_valid(q[i])) {
+			g2_set_infty(q[i]);
+			r[i] = 0;
+		}
+	}
+}
+
+#if MULTI == PTHREAD || MULTI == OPENMP
+
+/**
+ * Arguments of a batch of subgroup membership tests split among threads.
+ */
+typedef struct {
+	/** The points in G_1, or NULL. */
+	g1_t *p;
+	/** The points in G_2, or NULL. */
+	g2_t *q;
+	/** The flags indicating which points are valid. */
+	int *r;
+	/** The number of points. */
+	int n;
+} pc_valid_t;
+
+/**
+ * Checks a share of a batch of points.
+ *
+ * @param[in,out] args		- the batch of points.
+ * @param[in] i				- the index of the share.
+ * @param[in] c				- the number of shares.
+ */
+static void pc_is_valid_job(void *args, int i, int c) {
+	pc_valid_t *job = (pc_valid_t *)args;
+	int m = RLC_CEIL(job->n, c), j = RLC_MIN(i * m, job->n);
+
+	pc_is_valid_sim(job->p == NULL ? NULL : job->p + j,
+			job->q == NULL ? NULL : job->q + j, job->r + j,
+			RLC_MIN(m, job->n - j));
+}
+
+#endif /* MULTI == PTHREAD || MULTI == OPENMP */
+
+/**
+ * Checks the subgroup membership of many points in G_1 or G_2, splitting them
+ * among threads if there are at least m points.
+ *
+ * @param[in,out] p			- the points in G_1, or NULL.
+ * @param[in,out] q			- the points in G_2, or NULL.
+ * @param[in,out] r			- the flags indicating which points are valid.
+ * @param[in] n				- the number of points.
+ * @param[in] m				- the minimum number of points to use threads.
+ * @return the number of valid points.
+ */
+static int pc_is_valid_batch(g1_t *p, g2_t *q, int *r, int n, int m) {
+	int i, c = 0, multi = 0;
+
+#if MULTI == PTHREAD || MULTI == OPENMP
+	multi = (n >= m && core_get_threads() > 1);
+	if (multi) {
+		pc_valid_t job = { p, q, r, n };
+		core_run(pc_is_valid_job, &job, core_get_threads());
+	}
+#else
+	(void)m;
+#endif
+	if (!multi) {
+		pc_is_valid_sim(p, q, r, n);
+	}
+
+	for (i = 0; i < n; i++) {
+		c += r[i];
+	}
+	return c;
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -81,20 +346,35 @@ void gt_get_gen(gt_t g) {
 
 int g1_is_valid(g1_t a) {
 	bn_t n;
-	g1_t u;
+	g1_t u, v;
 	int r;
 
 	bn_null(n);
 	g1_null(u);
+	g1_null(v);
 
 	RLC_TRY {
 		bn_new(n);
 		g1_new(u);
+		g1_new(v);
 
 		ep_curve_get_cof(n);
 		if (bn_cmp_dig(n, 1) == RLC_EQ) {
 			/* If curve has prime order, simpler to check if point on curve. */
 			return ep_on_curve(a);
+		}
+		fp_prime_get_par(n);
+		if (g1_is_psi_par(n)) {
+			/* Check if psi(a) = -x^2 * a, as done by Scott for BLS12. */
+			if (g1_is_infty(a)) {
+				r = 1;
+			} else {
+				g1_mul_par(u, a, n);
+				g1_mul_par(u, u, n);
+				g1_neg(u, u);
+				ep_psi(v, a);
+				r = ep_on_curve(a) && (g1_cmp(u, v) == RLC_EQ);
+			}
 		} else {
 			/* Otherwise, check order explicitly. */
 			pc_get_ord(n);
@@ -110,31 +390,55 @@ int g1_is_valid(g1_t a) {
 	} RLC_FINALLY {
 		bn_free(n);
 		g1_free(u);
+		g1_free(v);
 	}
 
 	return r;
 }
 
 int g2_is_valid(g2_t a) {
-	bn_t p, n;
-	g2_t u, v;
+	bn_t p, n, x;
+	g2_t u, v, w;
 	int r;
 
 	bn_null(n);
 	bn_null(p);
+	bn_null(x);
 	g2_null(u);
 	g2_null(v);
+	g2_null(w);
 
 	RLC_TRY {
 		bn_new(n);
 		bn_new(p);
+		bn_new(x);
 		g2_new(u);
 		g2_new(v);
+		g2_new(w);
 
 		pc_get_ord(n);
 		ep_curve_get_cof(p);
+		fp_prime_get_par(x);
 
-		if (bn_cmp_dig(p, 1) == RLC_EQ) {
+		if (g2_is_infty(a)) {
+			r = 1;
+		} else if (ep_curve_is_pairf() == EP_B12) {
+			/* Check if psi(a) = xa, following Scott for BLS12. */
+			g2_mul_par(u, a, x);
+			ep2_frb(v, a, 1);
+			r = ep2_on_curve(a) && (g2_cmp(u, v) == RLC_EQ);
+		} else if (ep_curve_is_pairf() == EP_BN) {
+			/* Check if (x + 1)a + psi(xa) + psi^2(xa) = psi^3(2xa). */
+			g2_mul_par(u, a, x);
+			ep2_frb(v, u, 1);
+			g2_add(v, v, a);
+			g2_add(v, v, u);
+			ep2_frb(w, u, 2);
+			g2_add(v, v, w);
+			g2_dbl(u, u);
+			ep2_frb(u, u, 3);
+			r = ep2_on_curve(a) && (g2_cmp(u, v) == RLC_EQ);
+		} else if (bn_cmp_dig(p, 1) == RLC_EQ) {
 			/* Trick for curves of prime order or subgroup-secure. */
 			bn_mul(n, n, p);
 			dv_copy(p->dp, fp_prime_get(), RLC_FP_DIGS);
@@ -164,33 +468,65 @@ int g2_is_valid(g2_t a) {
 	} RLC_FINALLY {
 		bn_free(p);
 		bn_free(n);
+		bn_free(x);
 		g2_free(u);
 		g2_free(v);
+		g2_free(w);
 	}
 
 	return r;
 }
 
 int gt_is_valid(gt_t a) {
-	bn_t p, n;
-	gt_t u, v;
-	int r;
+	bn_t p, n, x;
+	gt_t u, v, w;
+	int r = 0;
 
 	bn_null(n);
 	bn_null(p);
+	bn_null(x);
 	gt_null(u);
 	gt_null(v);
+	gt_null(w);
 
 	RLC_TRY {
 		bn_new(n);
 		bn_new(p);
+		bn_new(x);
 		gt_new(u);
 		gt_new(v);
+		gt_new(w);
 
 		pc_get_ord(n);
 		ep_curve_get_cof(p);
+		fp_prime_get_par(x);
 
-		if (bn_cmp_dig(p, 1) == RLC_EQ) {
+		if (fp12_is_zero(a)) {
+			/* Zero is not invertible, so it is never in G_T. */
+			r = 0;
+		} else if (ep_curve_is_pairf() == EP_B12) {
+			/* Check if a is cyclotomic and a^p = a^x, following Scott. */
+			r = fp12_test_cyc(a);
+			if (r) {
+				gt_exp_par(u, a, x);
+				fp12_frb(v, a, 1);
+				r = (gt_cmp(u, v) == RLC_EQ);
+			}
+		} else if (ep_curve_is_pairf() == EP_BN) {
+			/* Check if a is cyclotomic and a^(x + 1 + xp + xp^2) = a^(2xp^3). */
+			r = fp12_test_cyc(a);
+			if (r) {
+				gt_exp_par(u, a, x);
+				fp12_frb(v, u, 1);
+				gt_mul(v, v, a);
+				gt_mul(v, v, u);
+				fp12_frb(w, u, 2);
+				gt_mul(v, v, w);
+				gt_sqr(u, u);
+				fp12_frb(u, u, 3);
+				r = (gt_cmp(u, v) == RLC_EQ);
+			}
+		} else if (bn_cmp_dig(p, 1) == RLC_EQ) {
 			dv_copy(p->dp, fp_prime_get(), RLC_FP_DIGS);
 			p->used = RLC_FP_DIGS;
 			p->sign = RLC_POS;
@@ -214,13 +550,32 @@ int gt_is_valid(gt_t a) {
 			r = (gt_cmp(u, a) == RLC_EQ);
 		}
 	} RLC_CATCH_ANY {
+		r = 0;
 		RLC_THROW(ERR_CAUGHT);
 	} RLC_FINALLY {
 		bn_free(p);
 		bn_free(n);
+		bn_free(x);
 		gt_free(u);
 		gt_free(v);
+		gt_free(w);
 	}
 
 	return r;
 }
+
+int g1_read_bin_batch(g1_t *a, int *r, const uint8_t *bin, int len, int n) {
+	if (n <= 0) {
+		return 0;
+	}
+	RLC_CAT(RLC_G1_LOWER, read_bin_batch)(a, r, bin, len, n);
+	return pc_is_valid_batch(a, NULL, r, n, RLC_EP_READ_MULTI);
+}
+
+int g2_read_bin_batch(g2_t *a, int *r, const uint8_t *bin, int len, int n) {
+	if (n <= 0) {
+		return 0;
+	}
+	RLC_CAT(RLC_G2_LOWER, read_bin_batch)(a, r, bin, len, n);
+	return pc_is_valid_batch(NULL, a, r, n, RLC_EPX_READ_MULTI);
+}
@@ -230,6 +230,215 @@ static void pp_fin_k12_oatep(fp12_t r, ep2_t t, ep2_t q, ep_t p) {
 	}
 }
 
+/**
+ * Stores the coefficients of a line function evaluated at the point (1, 1).
+ *
+ * @param[out] t			- the coefficients of the line.
+ * @param[in] l				- the line function.
+ */
+static void pp_pre_line_k12(fp2_t *t, fp12_t l) {
+	int one = 1, zero = 0;
+
+	if (ep2_curve_is_twist() == RLC_EP_MTYPE) {
+		one ^= 1;
+		zero ^= 1;
+	}
+
+	fp2_copy(t[0], l[one][one]);
+	fp2_copy(t[1], l[one][zero]);
+	fp2_copy(t[2], l[zero][zero]);
+}
+
+/**
+ * Evaluates a line function with precomputed coefficients at a point.
+ *
+ * @param[out] l			- the result of the evaluation.
+ * @param[in] t				- the coefficients of the line.
+ * @param[in] p				- the affine point to evaluate the line function.
+ */
+static void pp_eval_line_k12(fp12_t l, fp2_t *t, ep_t p) {
+	int one = 1, zero = 0;
+
+	if (ep2_curve_is_twist() == RLC_EP_MTYPE) {
+		one ^= 1;
+		zero ^= 1;
+	}
+
+	fp2_copy(l[one][one], t[0]);
+	fp_mul(l[one][zero][0], t[1][0], p->x);
+	fp_mul(l[one][zero][1], t[1][1], p->x);
+	fp_mul(l[zero][zero][0], t[2][0], p->y);
+	fp_mul(l[zero][zero][1], t[2][1], p->y);
+}
+
+/**
+ * Computes the loop parameter of the optimal ate pairing and recodes it in
+ * sparse form.
+ *
+ * @param[out] a			- the loop parameter.
+ * @param[out] s			- the recoded parameter.
+ * @param[out] len			- the length of the recoding.
+ */
+static void pp_par_k12(bn_t a, int8_t *s, int *len) {
+	fp_prime_get_par(a);
+	if (ep_curve_is_pairf() == EP_BN) {
+		bn_mul_dig(a, a, 6);
+		bn_add_dig(a, a, 2);
+	}
+	*len = bn_bits(a) + 1;
+	bn_rec_naf(s, len, a, 2);
+}
+
+/**
+ * Computes the Miller loop of the optimal ate multi-pairing, including the
+ * final lines on BN curves.
+ *
+ * @param[out] r			- the result.
+ * @param[in] q				- the first arguments in affine coordinates.
+ * @param[in] p				- the second arguments in affine coordinates.
+ * @param[in] m 			- the number of pairings to evaluate.
+ */
+static void pp_mil_oatep_k12(fp12_t r, ep2_t *q, ep_t *p, int m) {
+	ep2_t *t = RLC_ALLOCA(ep2_t, m);
+	bn_t a;
+	int i;
+
+	bn_null(a);
+
+	RLC_TRY {
+		bn_new(a);
+		if (t == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < m; i++) {
+			ep2_null(t[i]);
+			ep2_new(t[i]);
+		}
+
+		fp_prime_get_par(a);
+		fp12_set_dig(r, 1);
+
+		switch (ep_curve_is_pairf()) {
+			case EP_BN:
+				bn_mul_dig(a, a, 6);
+				bn_add_dig(a, a, 2);
+				/* r = f_{|a|,Q}(P). */
+				pp_mil_k12(r, t, q, p, m, a);
+				if (bn_sign(a) == RLC_NEG) {
+					/* f_{-a,Q}(P) = 1/f_{a,Q}(P). */
+					fp12_inv_cyc(r, r);
+				}
+				for (i = 0; i < m; i++) {
+					if (bn_sign(a) == RLC_NEG) {
+						ep2_neg(t[i], t[i]);
+					}
+					pp_fin_k12_oatep(r, t[i], q[i], p[i]);
+				}
+				break;
+			case EP_B12:
+				/* r = f_{|a|,Q}(P). */
+				pp_mil_k12(r, t, q, p, m, a);
+				if (bn_sign(a) == RLC_NEG) {
+					fp12_inv_cyc(r, r);
+				}
+				break;
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		bn_free(a);
+		for (i = 0; i < m; i++) {
+			ep2_free(t[i]);
+		}
+		RLC_FREE(t);
+	}
+}
+
+#if MULTI == PTHREAD || MULTI == OPENMP
+
+/**
+ * Arguments of the Miller loop of a multi-pairing split among threads.
+ */
+typedef struct {
+	/** The partial results, one per share. */
+	fp12_t *t;
+	/** The first pairing arguments. */
+	ep2_t *q;
+	/** The second pairing arguments. */
+	ep_t *p;
+	/** The number of pairings. */
+	int m;
+} pp_mil_t;
+
+/**
+ * Computes a share of the Miller loop of a multi-pairing.
+ *
+ * @param[in,out] args		- the multi-pairing.
+ * @param[in] i				- the index of the share.
+ * @param[in] c				- the number of shares.
+ */
+static void pp_mil_oatep_k12_job(void *args, int i, int c) {
+	pp_mil_t *job = (pp_mil_t *)args;
+	int n = RLC_CEIL(job->m, c), j = RLC_MIN(i * n, job->m);
+
+	n = RLC_MIN(n, job->m - j);
+	if (n == 0) {
+		fp12_set_dig(job->t[i], 1);
+	} else {
+		pp_mil_oatep_k12(job->t[i], job->q + j, job->p + j, n);
+	}
+}
+
+/**
+ * Computes the Miller loop of the optimal ate multi-pairing by splitting the
+ * pairings among up to core_get_threads() threads and multiplying the partial
+ * results. Shares take at least RLC_PP_MAP_MULTI / 4 pairings.
+ *
+ * @param[out] r			- the result.
+ * @param[in] q				- the first arguments in affine coordinates.
+ * @param[in] p				- the second arguments in affine coordinates.
+ * @param[in] m 			- the number of pairings to evaluate.
+ */
+static void pp_mil_oatep_k12_multi(fp12_t r, ep2_t *q, ep_t *p, int m) {
+	const int c = RLC_MAX(1, RLC_MIN(core_get_threads(),
+			4 * m / RLC_PP_MAP_MULTI));
+	int i;
+	fp12_t *t = RLC_ALLOCA(fp12_t, c);
+	pp_mil_t job = { t, q, p, m };
+
+	RLC_TRY {
+		if (t == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < c; i++) {
+			fp12_null(t[i]);
+			fp12_new(t[i]);
+		}
+
+		core_run(pp_mil_oatep_k12_job, &job, c);
+
+		fp12_set_dig(r, 1);
+		for (i = 0; i < c; i++) {
+			fp12_mul(r, r, t[i]);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		if (t != NULL) {
+			for (i = 0; i < c; i++) {
+				fp12_free(t[i]);
+			}
+		}
+		RLC_FREE(t);
+	}
+}
+
+#endif /* MULTI == PTHREAD || MULTI == OPENMP */
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -522,23 +731,18 @@ void pp_map_oatep_k12(fp12_t r, ep_t p, ep2_t q) {
 
 void pp_map_sim_oatep_k12(fp12_t r, ep_t *p, ep2_t *q, int m) {
 	ep_t *_p = RLC_ALLOCA(ep_t, m);
-	ep2_t *t = RLC_ALLOCA(ep2_t, m), *_q = RLC_ALLOCA(ep2_t, m);
-	bn_t a;
+	ep2_t *_q = RLC_ALLOCA(ep2_t, m);
 	int i, j;
 
 	RLC_TRY {
-		bn_null(a);
-		bn_new(a);
-		if (_p == NULL || _q == NULL || t == NULL) {
+		if (_p == NULL || _q == NULL) {
 			RLC_THROW(ERR_NO_MEMORY);
 		}
 		for (i = 0; i < m; i++) {
 			ep_null(_p[i]);
 			ep2_null(_q[i]);
-			ep2_null(t[i]);
 			ep_new(_p[i]);
 			ep2_new(_q[i]);
-			ep2_new(t[i]);
 		}
 
 		j = 0;
@@ -549,52 +753,217 @@ void pp_map_sim_oatep_k12(fp12_t r, ep_t *p, ep2_t *q, int m) {
 			}
 		}
 
-		fp_prime_get_par(a);
 		fp12_set_dig(r, 1);
-
 		if (j > 0) {
-			switch (ep_curve_is_pairf()) {
-				case EP_BN:
-					bn_mul_dig(a, a, 6);
-					bn_add_dig(a, a, 2);
-					/* r = f_{|a|,Q}(P). */
-					pp_mil_k12(r, t, _q, _p, j, a);
-					if (bn_sign(a) == RLC_NEG) {
-						/* f_{-a,Q}(P) = 1/f_{a,Q}(P). */
-						fp12_inv_cyc(r, r);
-					}
-					for (i = 0; i < j; i++) {
-						if (bn_sign(a) == RLC_NEG) {
-							ep2_neg(t[i], t[i]);
-						}
-						pp_fin_k12_oatep(r, t[i], _q[i], _p[i]);
-					}
-					pp_exp_k12(r, r);
-					break;
-				case EP_B12:
-					/* r = f_{|a|,Q}(P). */
-					pp_mil_k12(r, t, _q, _p, j, a);
-					if (bn_sign(a) == RLC_NEG) {
-						fp12_inv_cyc(r, r);
-					}
-					pp_exp_k12(r, r);
-					break;
+#if MULTI == PTHREAD || MULTI == OPENMP
+			if (j >= RLC_PP_MAP_MULTI && core_get_threads() > 1) {
+				pp_mil_oatep_k12_multi(r, _q, _p, j);
+			} else {
+				pp_mil_oatep_k12(r, _q, _p, j);
 			}
+#else
+			pp_mil_oatep_k12(r, _q, _p, j);
+#endif
+			pp_exp_k12(r, r);
 		}
 	}
 	RLC_CATCH_ANY {
 		RLC_THROW(ERR_CAUGHT);
 	}
 	RLC_FINALLY {
-		bn_free(a);
 		for (i = 0; i < m; i++) {
 			ep_free(_p[i]);
 			ep2_free(_q[i]);
-			ep2_free(t[i]);
 		}
 		RLC_FREE(_p);
 		RLC_FREE(_q);
-		RLC_FREE(t);
+	}
+}
+
+#endif
+
+#if PP_MAP == OATEP || !defined(STRIP)
+
+void pp_map_pre_k12(fp2_t *t, ep2_t q) {
+	fp12_t l;
+	ep_t u;
+	ep2_t r, _q, n;
+	bn_t a;
+	int8_t s[RLC_FP_BITS + 1];
+	int i, k = 0, len;
+
+	fp12_null(l);
+	ep_null(u);
+	ep2_null(r);
+	ep2_null(_q);
+	ep2_null(n);
+	bn_null(a);
+
+	RLC_TRY {
+		fp12_new(l);
+		ep_new(u);
+		ep2_new(r);
+		ep2_new(_q);
+		ep2_new(n);
+		bn_new(a);
+
+		for (i = 0; i < RLC_PP_TABLE_K12; i++) {
+			fp2_zero(t[i]);
+		}
+
+		ep2_norm(_q, q);
+		if (!ep2_is_infty(_q)) {
+			/* Evaluating at (1, 1) leaves the coefficients of the lines. */
+			fp_set_dig(u->x, 1);
+			fp_set_dig(u->y, 1);
+			fp_set_dig(u->z, 1);
+			u->coord = BASIC;
+
+			pp_par_k12(a, s, &len);
+			for (i = len - 2; i >= 0; i--) {
+				k += (s[i] != 0 ? 6 : 3);
+			}
+			if (k + 6 > RLC_PP_TABLE_K12) {
+				RLC_THROW(ERR_NO_BUFFER);
+			}
+			k = 0;
+
+			fp12_zero(l);
+			ep2_copy(r, _q);
+			ep2_neg(n, _q);
+			for (i = len - 2; i >= 0; i--) {
+				pp_dbl_k12(l, r, r, u);
+				pp_pre_line_k12(t + k, l);
+				k += 3;
+				if (s[i] > 0) {
+					pp_add_k12(l, r, _q, u);
+				}
+				if (s[i] < 0) {
+					pp_add_k12(l, r, n, u);
+				}
+				if (s[i] != 0) {
+					pp_pre_line_k12(t + k, l);
+					k += 3;
+				}
+			}
+
+			if (ep_curve_is_pairf() == EP_BN) {
+				if (bn_sign(a) == RLC_NEG) {
+					ep2_neg(r, r);
+				}
+				/* Store the final lines f_{T,pi(Q)} and f_{T+pi(Q),-pi^2(Q)}. */
+				ep2_frb(n, _q, 1);
+				pp_add_k12(l, r, n, u);
+				pp_pre_line_k12(t + k, l);
+				k += 3;
+				ep2_frb(n, _q, 2);
+				ep2_neg(n, n);
+				pp_add_k12(l, r, n, u);
+				pp_pre_line_k12(t + k, l);
+			}
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		fp12_free(l);
+		ep_free(u);
+		ep2_free(r);
+		ep2_free(_q);
+		ep2_free(n);
+		bn_free(a);
+	}
+}
+
+void pp_map_sim_oatep_k12_pre(fp12_t r, ep_t *p, fp2_t *t[], int m) {
+	fp12_t l;
+	ep_t *_p = RLC_ALLOCA(ep_t, m), *_n = RLC_ALLOCA(ep_t, m);
+	fp2_t **_t = RLC_ALLOCA(fp2_t *, m);
+	bn_t a;
+	int8_t s[RLC_FP_BITS + 1];
+	int i, j, k, len, n = 0;
+
+	fp12_null(l);
+	bn_null(a);
+
+	RLC_TRY {
+		fp12_new(l);
+		bn_new(a);
+		if (_p == NULL || _n == NULL || _t == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < m; i++) {
+			ep_null(_p[i]);
+			ep_null(_n[i]);
+			ep_new(_p[i]);
+			ep_new(_n[i]);
+		}
+
+		/* Tables for the point at infinity start with an empty line. */
+		for (i = 0; i < m; i++) {
+			if (!ep_is_infty(p[i]) && !fp2_is_zero(t[i][2])) {
+				ep_norm(_p[n], p[i]);
+#if EP_ADD == BASIC
+				ep_neg(_n[n], _p[n]);
+#else
+				fp_add(_n[n]->x, _p[n]->x, _p[n]->x);
+				fp_add(_n[n]->x, _n[n]->x, _p[n]->x);
+				fp_neg(_n[n]->y, _p[n]->y);
+#endif
+				_t[n++] = t[i];
+			}
+		}
+
+		fp12_set_dig(r, 1);
+		if (n > 0) {
+			fp12_zero(l);
+			pp_par_k12(a, s, &len);
+
+			k = 0;
+			for (i = len - 2; i >= 0; i--) {
+				if (i < len - 2) {
+					fp12_sqr(r, r);
+				}
+				for (j = 0; j < n; j++) {
+					pp_eval_line_k12(l, _t[j] + k, _n[j]);
+					fp12_mul_dxs(r, r, l);
+					if (s[i] != 0) {
+						pp_eval_line_k12(l, _t[j] + k + 3, _p[j]);
+						fp12_mul_dxs(r, r, l);
+					}
+				}
+				k += (s[i] != 0 ? 6 : 3);
+			}
+			if (bn_sign(a) == RLC_NEG) {
+				/* f_{-a,Q}(P) = 1/f_{a,Q}(P). */
+				fp12_inv_cyc(r, r);
+			}
+
+			if (ep_curve_is_pairf() == EP_BN) {
+				for (j = 0; j < n; j++) {
+					pp_eval_line_k12(l, _t[j] + k, _p[j]);
+					fp12_mul_dxs(r, r, l);
+					pp_eval_line_k12(l, _t[j] + k + 3, _p[j]);
+					fp12_mul_dxs(r, r, l);
+				}
+			}
+			pp_exp_k12(r, r);
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		fp12_free(l);
+		bn_free(a);
+		for (i = 0; i < m; i++) {
+			ep_free(_p[i]);
+			ep_free(_n[i]);
+		}
+		RLC_FREE(_p);
+		RLC_FREE(_n);
+		RLC_FREE(_t);
 	}
 }
 
@@ -72,22 +72,22 @@ static void rand_stub(uint8_t *buf, int size, void *args) {
 #if RAND == CALL
 
 void rand_bytes(uint8_t *buf, int size) {
-	ctx_t *ctx = core_get();
+	thr_t *thr = core_thr();
 
-	ctx->rand_call(buf, size, ctx->rand_args);
+	thr->rand_call(buf, size, thr->rand_args);
 }
 
 void rand_seed(void (*callback)(uint8_t *, int, void *), void *args) {
-	ctx_t *ctx = core_get();
+	thr_t *thr = core_thr();
 
 	if (callback == NULL) {
-		ctx->rand_call = rand_stub;
-		ctx->rand_args = NULL;
+		thr->rand_call = rand_stub;
+		thr->rand_args = NULL;
 	} else {
-		ctx->rand_call = callback;
-		ctx->rand_args = args;
+		thr->rand_call = callback;
+		thr->rand_args = args;
 	}
-	core_get()->seeded = 1;
+	core_thr()->seeded = 1;
 }
 
 #endif
\ No newline at end of file
@@ -83,7 +83,7 @@ void rand_init(void) {
 	uint8_t buf[RLC_RAND_SEED];
 
 #if RAND == UDEV
-	int *fd = (int *)&(core_get()->rand);
+	int *fd = (int *)&(core_thr()->rand);
 
 	*fd = open(RLC_RAND_PATH, O_RDONLY);
 	if (*fd == -1) {
@@ -167,7 +167,7 @@ void rand_init(void) {
 #endif /* RAND == UDEV */
 
 #if RAND != CALL
-	core_get()->seeded = 0;
+	core_thr()->seeded = 0;
 	rand_seed(buf, RLC_RAND_SEED);
 #else
 	rand_seed(NULL, NULL);
@@ -175,18 +175,16 @@ void rand_init(void) {
 }
 
 void rand_clean(void) {
-	ctx_t *ctx = core_get();
-	if (ctx != NULL) {
+	thr_t *thr = core_thr();
 #if RAND == UDEV
-		int *fd = (int *)&(ctx->rand);
-		close(*fd);
+	int *fd = (int *)&(thr->rand);
+	close(*fd);
 #endif
 #if RAND != CALL
-		memset(ctx->rand, 0, sizeof(ctx->rand));
+	memset(thr->rand, 0, sizeof(thr->rand));
 #else
-		ctx->rand_call = NULL;
-		ctx->rand_args = NULL;
+	thr->rand_call = NULL;
+	thr->rand_args = NULL;
 #endif
-		ctx->seeded = 0;
-	}
+	thr->seeded = 0;
 }
@@ -0,0 +1,243 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (C) 2007-2020 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Implementation of the CTR_DRBG pseudo-random number generator with AES-256
+ * and the block cipher derivation function.
+ *
+ * @ingroup rand
+ */
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "relic_conf.h"
+#include "relic_core.h"
+#include "relic_label.h"
+#include "relic_rand.h"
+#include "relic_bc.h"
+#include "relic_err.h"
+
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+#if RAND == CTRDR
+
+/**
+ * Length of the AES-256 key in the internal state.
+ */
+#define RAND_KEY		32
+
+/**
+ * Length of the seed material, the key followed by the counter block.
+ */
+#define RAND_LEN		(RAND_KEY + RLC_BC_LEN)
+
+/**
+ * Adds a small integer to a big-endian counter block.
+ *
+ * @param[in,out] ctr		- the counter block.
+ * @param[in] digit			- the small integer.
+ */
+static void rand_inc(uint8_t *ctr, int digit) {
+	for (int i = RLC_BC_LEN - 1; i >= 0; i--) {
+		digit += ctr[i];
+		ctr[i] = digit & 0xFF;
+		digit >>= 8;
+	}
+}
+
+/**
+ * Produces the key stream of AES in CTR mode under the internal state. The
+ * state keeps the next counter block, which is advanced past the output.
+ *
+ * @param[out] out			- the buffer to write.
+ * @param[in] out_len		- the number of bytes to write.
+ * @param[in,out] state		- the internal state.
+ */
+static void rand_ctr(uint8_t *out, int out_len, uint8_t *state) {
+	int len = out_len;
+
+	memset(out, 0, out_len);
+	bc_aes_ctr_enc(out, &len, out, out_len, state, RAND_KEY, state + RAND_KEY);
+	rand_inc(state + RAND_KEY, RLC_CEIL(out_len, RLC_BC_LEN));
+}
+
+/**
+ * Updates the internal state with provided data.
+ *
+ * @param[in,out] state		- the internal state.
+ * @param[in] data			- the provided data, or NULL for zeros.
+ */
+static void rand_update(uint8_t *state, const uint8_t *data) {
+	uint8_t t[RAND_LEN];
+
+	rand_ctr(t, RAND_LEN, state);
+	if (data != NULL) {
+		for (int i = 0; i < RAND_LEN; i++) {
+			t[i] ^= data[i];
+		}
+	}
+	/* Key = t[0..32), V = t[32..48) and store V + 1 as the next counter. */
+	memcpy(state, t, RAND_LEN);
+	rand_inc(state + RAND_KEY, 1);
+	memset(t, 0, sizeof(t));
+}
+
+/**
+ * Computes the block cipher derivation function.
+ *
+ * @param[out] out			- the resulting seed material.
+ * @param[in] in			- the input string.
+ * @param[in] in_len		- the number of bytes in the input.
+ */
+static void rand_df(uint8_t *out, const uint8_t *in, int in_len) {
+	/* The input is IV || L || N || in || 0x80, padded to whole blocks. */
+	int len = RLC_BC_LEN * RLC_CEIL(RLC_BC_LEN + 8 + in_len + 1, RLC_BC_LEN);
+	int c_len = len + RLC_BC_LEN;
+	uint8_t *s = RLC_ALLOCA(uint8_t, len);
+	uint8_t *c = RLC_ALLOCA(uint8_t, c_len);
+	uint8_t k[RAND_KEY], iv[RLC_BC_LEN] = { 0 }, t[RAND_LEN];
+	uint8_t zero[RAND_LEN] = { 0 };
+	uint32_t j;
+
+	if (s == NULL || c == NULL) {
+		RLC_FREE(s);
+		RLC_FREE(c);
+		RLC_THROW(ERR_NO_MEMORY);
+		return;
+	}
+
+	memset(s, 0, len);
+	j = util_conv_big(in_len);
+	memcpy(s + RLC_BC_LEN, &j, sizeof(uint32_t));
+	j = util_conv_big(RAND_LEN);
+	memcpy(s + RLC_BC_LEN + 4, &j, sizeof(uint32_t));
+	memcpy(s + RLC_BC_LEN + 8, in, in_len);
+	s[RLC_BC_LEN + 8 + in_len] = 0x80;
+
+	for (int i = 0; i < RAND_KEY; i++) {
+		k[i] = i;
+	}
+	for (int i = 0; i < RAND_LEN / RLC_BC_LEN; i++) {
+		/* temp = temp || BCC(K, i || S), a CBC-MAC with zero IV. */
+		j = util_conv_big(i);
+		memcpy(s, &j, sizeof(uint32_t));
+		c_len = len + RLC_BC_LEN;
+		bc_aes_cbc_enc(c, &c_len, s, len, k, RAND_KEY, iv);
+		memcpy(t + i * RLC_BC_LEN, c + len - RLC_BC_LEN, RLC_BC_LEN);
+	}
+	/* Iterate the cipher under the new key, starting from X = temp[32..48). */
+	c_len = len + RLC_BC_LEN;
+	bc_aes_cbc_enc(c, &c_len, zero, RAND_LEN, t, RAND_KEY, t + RAND_KEY);
+	memcpy(out, c, RAND_LEN);
+
+	memset(s, 0, len);
+	memset(t, 0, sizeof(t));
+	RLC_FREE(s);
+	RLC_FREE(c);
+}
+
+/**
+ * Generates pseudo-random bytes and updates the internal state.
+ *
+ * @param[out] out 			- the buffer to write.
+ * @param[in] out_len		- the number of bytes to write.
+ */
+static void rand_gen(uint8_t *out, int out_len) {
+	thr_t *thr = core_thr();
+
+	if (thr->counter > RLC_RAND_RESEED) {
+		/* Instantiate again with fresh entropy from the seeder. */
+		rand_init();
+	}
+	rand_ctr(out, out_len, thr->rand);
+	rand_update(thr->rand, NULL);
+	thr->counter++;
+}
+
+#endif
+
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+#if RAND == CTRDR
+
+void rand_bytes(uint8_t *buf, int size) {
+	thr_t *thr = core_thr();
+	uint8_t *pool = thr->rand + RAND_LEN;
+	int len;
+
+	if (sizeof(int) > 2 && size > (1 << 16)) {
+		RLC_THROW(ERR_NO_VALID);
+	}
+
+	while (size > 0) {
+		if (thr->rand_left == 0) {
+			if (size >= RLC_RAND_BUF) {
+				/* Serve large requests directly. */
+				rand_gen(buf, size);
+				return;
+			}
+			rand_gen(pool, RLC_RAND_BUF);
+			thr->rand_left = RLC_RAND_BUF;
+		}
+		len = RLC_MIN(size, thr->rand_left);
+		/* Consume buffered bytes in order and erase them. */
+		memcpy(buf, pool + RLC_RAND_BUF - thr->rand_left, len);
+		memset(pool + RLC_RAND_BUF - thr->rand_left, 0, len);
+		thr->rand_left -= len;
+		buf += len;
+		size -= len;
+	}
+}
+
+void rand_seed(uint8_t *buf, int size) {
+	thr_t *thr = core_thr();
+	uint8_t seed[RAND_LEN];
+
+	if (size <= 0) {
+		RLC_THROW(ERR_NO_VALID);
+	}
+
+	/* seed_material = df(entropy_input). */
+	rand_df(seed, buf, size);
+	if (thr->seeded == 0) {
+		/* Key = 0, V = 0, so the next counter block is 1. */
+		memset(thr->rand, 0, RAND_LEN);
+		thr->rand[RAND_LEN - 1] = 1;
+	}
+	rand_update(thr->rand, seed);
+	/* Discard output buffered under the previous state. */
+	memset(thr->rand + RAND_LEN, 0, RLC_RAND_BUF);
+	thr->rand_left = 0;
+	thr->counter = thr->seeded = 1;
+	memset(seed, 0, sizeof(seed));
+}
+
+#endif
@@ -125,10 +125,10 @@ static int rand_add(uint8_t *state, uint8_t *hash, int size) {
 static void rand_gen(uint8_t *out, int out_len) {
 	int m = RLC_CEIL(out_len, RLC_MD_LEN);
 	uint8_t hash[RLC_MD_LEN], data[(RLC_RAND_SIZE - 1)/2];
-	ctx_t *ctx = core_get();
+	thr_t *thr = core_thr();
 
 	/* data = V */
-	memcpy(data, ctx->rand + 1, (RLC_RAND_SIZE - 1)/2);
+	memcpy(data, thr->rand + 1, (RLC_RAND_SIZE - 1)/2);
 	for (int i = 0; i < m; i++) {
 		/* w_i = Hash(data) */
 		md_map(hash, data, sizeof(data));
@@ -152,7 +152,7 @@ static void rand_gen(uint8_t *out, int out_len) {
 void rand_bytes(uint8_t *buf, int size) {
 	uint8_t hash[RLC_MD_LEN];
 	int carry, len  = (RLC_RAND_SIZE - 1)/2;
-	ctx_t *ctx = core_get();
+	thr_t *thr = core_thr();
 
 	if (sizeof(int) > 2 && size > (1 << 16)) {
 		RLC_THROW(ERR_NO_VALID);
@@ -161,18 +161,18 @@ void rand_bytes(uint8_t *buf, int size) {
 	/* buf = hash_gen(size) */
 	rand_gen(buf, size);
 	/* H = hash(03 || V) */
-	ctx->rand[0] = 0x3;
-	md_map(hash, ctx->rand, 1 + len);
+	thr->rand[0] = 0x3;
+	md_map(hash, thr->rand, 1 + len);
 	/* V = V + H + C  + reseed_counter. */
-	rand_add(ctx->rand + 1, ctx->rand + 1 + len, len);
-	carry = rand_add(ctx->rand + 1 + (len - RLC_MD_LEN), hash, RLC_MD_LEN);
-	rand_inc(ctx->rand, len - RLC_MD_LEN + 1, carry);
-	rand_inc(ctx->rand, len + 1, ctx->counter);
-	ctx->counter = ctx->counter + 1;
+	rand_add(thr->rand + 1, thr->rand + 1 + len, len);
+	carry = rand_add(thr->rand + 1 + (len - RLC_MD_LEN), hash, RLC_MD_LEN);
+	rand_inc(thr->rand, len - RLC_MD_LEN + 1, carry);
+	rand_inc(thr->rand, len + 1, thr->counter);
+	thr->counter = thr->counter + 1;
 }
 
 void rand_seed(uint8_t *buf, int size) {
-	ctx_t *ctx = core_get();
+	thr_t *thr = core_thr();
 	int len = (RLC_RAND_SIZE - 1) / 2;
 
 	if (size <= 0) {
@@ -183,12 +183,12 @@ void rand_seed(uint8_t *buf, int size) {
 		RLC_THROW(ERR_NO_VALID);
 	}
 
-	ctx->rand[0] = 0x0;
-	if (ctx->seeded == 0) {
+	thr->rand[0] = 0x0;
+	if (thr->seeded == 0) {
 		/* V = hash_df(seed). */
-		rand_hash(ctx->rand + 1, len, buf, size);
+		rand_hash(thr->rand + 1, len, buf, size);
 		/* C = hash_df(00 || V). */
-		rand_hash(ctx->rand + 1 + len, len, ctx->rand, len + 1);
+		rand_hash(thr->rand + 1 + len, len, thr->rand, len + 1);
 	} else {
 		/* V = hash_df(01 || V || seed). */
         int tmp_size = 1 + len + size;
@@ -197,14 +197,14 @@ void rand_seed(uint8_t *buf, int size) {
 			RLC_THROW(ERR_NO_MEMORY);
 		}
 		tmp[0] = 1;
-		memcpy(tmp + 1, ctx->rand + 1, len);
+		memcpy(tmp + 1, thr->rand + 1, len);
 		memcpy(tmp + 1 + len, buf, size);
-		rand_hash(ctx->rand + 1, len, tmp, tmp_size);
+		rand_hash(thr->rand + 1, len, tmp, tmp_size);
 		/* C = hash_df(00 || V). */
-		rand_hash(ctx->rand + 1 + len, len, ctx->rand, len + 1);
+		rand_hash(thr->rand + 1 + len, len, thr->rand, len + 1);
 		RLC_FREE(tmp);
 	}
-	ctx->counter = ctx->seeded = 1;
+	thr->counter = thr->seeded = 1;
 }
 
 #endif
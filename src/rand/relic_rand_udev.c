@@ -52,7 +52,7 @@
 #if RAND == UDEV
 
 void rand_bytes(uint8_t *buf, int size) {
-	int c, l, *fd = (int *)&(core_get()->rand);
+	int c, l, *fd = (int *)&(core_thr()->rand);
 
 	l = 0;
 	do {
@@ -66,7 +66,7 @@ void rand_bytes(uint8_t *buf, int size) {
 
 void rand_seed(uint8_t *buf, int size) {
 	/* Do nothing, only mark as seeded. */
-	core_get()->seeded = 1;
+	core_thr()->seeded = 1;
 }
 
 #endif
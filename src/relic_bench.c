@@ -114,14 +114,14 @@ typedef unsigned long long bench_t;
 #if defined(OVERH) && defined(TIMER) && BENCH > 1
 
 void bench_overhead(void) {
-	ctx_t *ctx = core_get();
+	thr_t *thr = core_thr();
 	int a[BENCH + 1];
 	int *tmpa;
 
 	do {
-		ctx->over = 0;
+		thr->over = 0;
 		for (int l = 0; l < BENCH; l++) {
-			ctx->total = 0;
+			thr->total = 0;
 			/* Measure the cost of (n^2 + over). */
 			bench_before();
 			for (int i = 0; i < BENCH; i++) {
@@ -132,10 +132,10 @@ void bench_overhead(void) {
 			}
 			bench_after();
 			/* Add the cost of (n^2 + over). */
-			ctx->over += ctx->total;
+			thr->over += thr->total;
 		}
 		/* Overhead stores the cost of n*(n^2 + over) = n^3 + n*over. */
-		ctx->total = 0;
+		thr->total = 0;
 		/* Measure the cost of (n^3 + over). */
 		bench_before();
 		for (int i = 0; i < BENCH; i++) {
@@ -148,14 +148,14 @@ void bench_overhead(void) {
 		}
 		bench_after();
 		/* Subtract the cost of (n^3 + over). */
-		ctx->over -= ctx->total;
+		thr->over -= thr->total;
 		/* Now overhead stores (n - 1)*over, so take the average to obtain the
 		 * overhead to execute BENCH operations inside a benchmark. */
-		ctx->over /= (BENCH - 1);
+		thr->over /= (BENCH - 1);
 		/* Divide to obtain the overhead of one operation pair. */
-		ctx->over /= BENCH;
-	} while (ctx->over < 0);
-	ctx->total = ctx->over;
+		thr->over /= BENCH;
+	} while (thr->over < 0);
+	thr->total = thr->over;
 	bench_print();
 }
 
@@ -163,79 +163,79 @@ void bench_overhead(void) {
 
 void bench_reset(void) {
 #ifdef TIMER
-	core_get()->total = 0;
+	core_thr()->total = 0;
 #endif
 }
 
 void bench_before(void) {
 #if OPSYS == DUINO && TIMER == HREAL
-	core_get()->before = micros();
+	core_thr()->before = micros();
 #elif TIMER == HREAL || TIMER == HPROC || TIMER == HTHRD
-	clock_gettime(CLOCK, &(core_get()->before));
+	clock_gettime(CLOCK, &(core_thr()->before));
 #elif TIMER == ANSI
-	core_get()->before = clock();
+	core_thr()->before = clock();
 #elif TIMER == POSIX
-	gettimeofday(&(core_get()->before), NULL);
+	gettimeofday(&(core_thr()->before), NULL);
 #elif TIMER == CYCLE
-	core_get()->before = arch_cycles();
+	core_thr()->before = arch_cycles();
 #endif
 }
 
 void bench_after(void) {
-	ctx_t *ctx = core_get();
+	thr_t *thr = core_thr();
 	long long result;
 
 #if OPSYS == DUINO && TIMER == HREAL
-	core_get()->after = micros();
-	result = (ctx->after - ctx->before);
+	core_thr()->after = micros();
+	result = (thr->after - thr->before);
 #elif TIMER == HREAL || TIMER == HPROC || TIMER == HTHRD
-	clock_gettime(CLOCK, &(ctx->after));
-	result = ((long)ctx->after.tv_sec - (long)ctx->before.tv_sec) * 1000000000;
-	result += (ctx->after.tv_nsec - ctx->before.tv_nsec);
+	clock_gettime(CLOCK, &(thr->after));
+	result = ((long)thr->after.tv_sec - (long)thr->before.tv_sec) * 1000000000;
+	result += (thr->after.tv_nsec - thr->before.tv_nsec);
 #elif TIMER == ANSI
-	ctx->after = clock();
-	result = (ctx->after - ctx->before) * 1000000 / CLOCKS_PER_SEC;
+	thr->after = clock();
+	result = (thr->after - thr->before) * 1000000 / CLOCKS_PER_SEC;
 #elif TIMER == POSIX
-	gettimeofday(&(ctx->after), NULL);
-	result = ((long)ctx->after.tv_sec - (long)ctx->before.tv_sec) * 1000000;
-	result += (ctx->after.tv_usec - ctx->before.tv_usec);
+	gettimeofday(&(thr->after), NULL);
+	result = ((long)thr->after.tv_sec - (long)thr->before.tv_sec) * 1000000;
+	result += (thr->after.tv_usec - thr->before.tv_usec);
 #elif TIMER == CYCLE
-	ctx->after = arch_cycles();
-  	result = (ctx->after - ctx->before);
+	thr->after = arch_cycles();
+  	result = (thr->after - thr->before);
 #endif
 
 #ifdef TIMER
-	ctx->total += result;
+	thr->total += result;
 #else
 	(void)result;
-	(void)ctx;
+	(void)thr;
 #endif
 }
 
 void bench_compute(int benches) {
-	ctx_t *ctx = core_get();
+	thr_t *thr = core_thr();
 #ifdef TIMER
-	ctx->total = ctx->total / benches;
+	thr->total = thr->total / benches;
 #ifdef OVERH
-	ctx->total = ctx->total - ctx->over;
+	thr->total = thr->total - thr->over;
 #endif /* OVERH */
 #else
 	(void)benches;
-	(void)ctx;
+	(void)thr;
 #endif /* TIMER */
 }
 
 void bench_print(void) {
-	ctx_t *ctx = core_get();
+	thr_t *thr = core_thr();
 
 #if TIMER == POSIX || TIMER == ANSI || (OPSYS == DUINO && TIMER == HREAL)
-	util_print("%lld microsec", ctx->total);
+	util_print("%lld microsec", thr->total);
 #elif TIMER == CYCLE
-	util_print("%lld cycles", ctx->total);
+	util_print("%lld cycles", thr->total);
 #else
-	util_print("%lld nanosec", ctx->total);
+	util_print("%lld nanosec", thr->total);
 #endif
-	if (ctx->total < 0) {
+	if (thr->total < 0) {
 		util_print(" (overflow or bad overhead estimation)\n");
 	} else {
 		util_print("\n");
@@ -243,5 +243,5 @@ void bench_print(void) {
 }
 
 ull_t bench_total(void) {
-	return core_get()->total;
+	return core_thr()->total;
 }
@@ -78,6 +78,14 @@ void conf_print(void) {
 	util_print("** Arithmetic backend: " QUOTE(ARITH) "\n\n");
 #endif
 
+#if defined(ARITH_ALT) && ARITH_ALT == EASY
+	util_print("** Fallback arithmetic backend: easy\n\n");
+#elif defined(ARITH_ALT) && ARITH_ALT == GMP
+	util_print("** Fallback arithmetic backend: gmp\n\n");
+#elif defined(ARITH_ALT)
+	util_print("** Fallback arithmetic backend: " QUOTE(ARITH_ALT) "\n\n");
+#endif
+
 #ifdef LABEL
 	util_print("** Configured label: " QUOTE(LABEL) "\n\n");
 #endif
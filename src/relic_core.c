@@ -74,11 +74,10 @@
 /*============================================================================*/
 
 /**
- * Default library context.
+ * Default library context. With multithreading support, contexts are allocated
+ * by core_init() instead, so threads do not carry one each.
  */
-#if MULTI
-rlc_thread ctx_t first_ctx;
-#else
+#if !MULTI
 static ctx_t first_ctx;
 #endif
 
@@ -88,6 +87,11 @@ static ctx_t first_ctx;
  */
 void (*core_thread_initializer)(void* init_ptr) = NULL;
 void* core_init_ptr = NULL;
+
+/*
+ * Number of threads among which large multi-point operations are split.
+ */
+static int core_threads = CORES;
 #endif
 
 #if MULTI
@@ -96,33 +100,285 @@ rlc_thread ctx_t *core_ctx = NULL;
 static ctx_t *core_ctx = NULL;
 #endif
 
-int core_init(void) {
-	if (core_ctx == NULL) {
-		core_ctx = &(first_ctx);
+/**
+ * State of the calling thread.
+ */
+#if MULTI
+rlc_thread thr_t core_thr_ctx;
+#else
+static thr_t core_thr_ctx;
+#endif
+
+#if MULTI == PTHREAD
+/**
+ * Lock protecting the reference counters of shared contexts.
+ */
+static pthread_mutex_t core_lock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+/**
+ * Adds a value to the number of threads sharing a library context.
+ *
+ * @param[in,out] ctx		- the library context.
+ * @param[in] inc			- the value to add.
+ * @return the updated number of threads.
+ */
+static int core_ref(ctx_t *ctx, int inc) {
+	int refs;
+
+#if MULTI == PTHREAD
+	pthread_mutex_lock(&core_lock);
+#elif MULTI == OPENMP
+	#pragma omp critical (core_ref)
+#endif
+	{
+		ctx->refs += inc;
+		refs = ctx->refs;
+	}
+#if MULTI == PTHREAD
+	pthread_mutex_unlock(&core_lock);
+#endif
+	return refs;
+}
+
+#if MULTI != RELIC_NONE
+
+/**
+ * Share of an operation assigned to a thread.
+ */
+typedef struct core_share {
+	/** The function computing the share. */
+	core_job_t job;
+	/** The arguments of the operation. */
+	void *args;
+	/** The index of the share. */
+	int i;
+	/** The number of shares. */
+	int c;
+	/** The library context of the caller. */
+	ctx_t *ctx;
+	/** The flag indicating if the share was computed. */
+	int done;
+	/** The number of shares of the operation still being computed. */
+	int *pending;
+	/** The next share in the queue of the worker pool. */
+	struct core_share *next;
+} core_share_t;
+
+/**
+ * Computes a share of an operation. Threads without a library context attach
+ * to the one of the caller, while threads holding another context leave the
+ * share to the caller. Shares that fail are also left to the caller, which
+ * computes them again and reports the error.
+ *
+ * @param[in,out] ptr		- the share to compute.
+ * @return NULL.
+ */
+static void *core_share(void *ptr) {
+	core_share_t *share = (core_share_t *)ptr;
+	int attached = (core_attach(share->ctx) == RLC_OK);
+
+	if (!attached && core_ctx != share->ctx) {
+		return NULL;
+	}
+	/* Errors must not unwind past a thread, so the caller repeats the share. */
+	RLC_TRY {
+		share->job(share->args, share->i, share->c);
+		share->done = (err_get_code() == RLC_OK);
+	}
+	RLC_CATCH_ANY {
+		err_get_code();
+	}
+	if (attached) {
+		core_clean();
+	}
+	return NULL;
+}
+
+#endif
+
+#if MULTI == PTHREAD
+/**
+ * Lock protecting the worker pool and its queue of shares.
+ */
+static pthread_mutex_t pool_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/**
+ * Condition signaled when shares are queued or the pool is stopped.
+ */
+static pthread_cond_t pool_work = PTHREAD_COND_INITIALIZER;
+
+/**
+ * Condition signaled when a worker finishes a share.
+ */
+static pthread_cond_t pool_done = PTHREAD_COND_INITIALIZER;
+
+/**
+ * First and last shares waiting for a worker.
+ */
+static core_share_t *pool_head = NULL, *pool_tail = NULL;
+
+/**
+ * Persistent worker threads, created on demand by core_run().
+ */
+static pthread_t *pool_thread = NULL;
+
+/**
+ * Number of worker threads and flag telling them to exit.
+ */
+static int pool_size = 0, pool_stop = 0;
+
+/**
+ * Takes shares from the queue of the worker pool until the pool is stopped.
+ *
+ * @param[in] ptr			- the unused argument.
+ * @return NULL.
+ */
+static void *core_worker(void *ptr) {
+	core_share_t *share;
+
+	(void)ptr;
+	pthread_mutex_lock(&pool_lock);
+	while (!pool_stop) {
+		share = pool_head;
+		if (share == NULL) {
+			pthread_cond_wait(&pool_work, &pool_lock);
+			continue;
+		}
+		pool_head = share->next;
+		if (pool_head == NULL) {
+			pool_tail = NULL;
+		}
+		pthread_mutex_unlock(&pool_lock);
+		core_share(share);
+		pthread_mutex_lock(&pool_lock);
+		(*share->pending)--;
+		pthread_cond_broadcast(&pool_done);
+	}
+	pthread_mutex_unlock(&pool_lock);
+	return NULL;
+}
+
+/**
+ * Makes the worker pool have at least n threads. Must be called with the lock
+ * of the pool held. Threads that cannot be created are not retried, since the
+ * caller computes the shares left in the queue.
+ *
+ * @param[in] n				- the number of threads.
+ */
+static void core_pool_grow(int n) {
+	pthread_t *thread;
+
+	if (pool_stop || n <= 0 || n <= pool_size) {
+		return;
+	}
+	thread = (pthread_t *)realloc(pool_thread, n * sizeof(pthread_t));
+	if (thread == NULL) {
+		return;
+	}
+	pool_thread = thread;
+	while (pool_size < n) {
+		if (pthread_create(&pool_thread[pool_size], NULL, core_worker, NULL)) {
+			break;
+		}
+		pool_size++;
+	}
+}
+
+/**
+ * Stops and joins the threads of the worker pool. The pool is created again
+ * by the next operation split among threads.
+ */
+static void core_pool_stop(void) {
+	pthread_t *thread;
+	int i, size;
+
+	pthread_mutex_lock(&pool_lock);
+	pool_stop = 1;
+	thread = pool_thread;
+	size = pool_size;
+	pool_thread = NULL;
+	pool_size = 0;
+	pthread_cond_broadcast(&pool_work);
+	pthread_mutex_unlock(&pool_lock);
+
+	for (i = 0; i < size; i++) {
+		pthread_join(thread[i], NULL);
 	}
+	free(thread);
+
+	pthread_mutex_lock(&pool_lock);
+	pool_stop = 0;
+	pthread_mutex_unlock(&pool_lock);
+}
+#endif
+
+/**
+ * Initializes the state of the calling thread.
+ */
+static void core_thr_init(void) {
+	thr_t *thr = &core_thr_ctx;
+
+	/* Mark the state first, since seeding the PRNG may throw errors. */
+	thr->init = 1;
+	thr->ctx = NULL;
 
 #ifdef CHECK
-	core_ctx->reason[ERR_NO_MEMORY] = MSG_NO_MEMORY;
-	core_ctx->reason[ERR_NO_PRECI] = MSG_NO_PRECI;
-	core_ctx->reason[ERR_NO_FILE] = MSG_NO_FILE;
-	core_ctx->reason[ERR_NO_READ] = MSG_NO_READ;
-	core_ctx->reason[ERR_NO_VALID] = MSG_NO_VALID;
-	core_ctx->reason[ERR_NO_BUFFER] = MSG_NO_BUFFER;
-	core_ctx->reason[ERR_NO_FIELD] = MSG_NO_FIELD;
-	core_ctx->reason[ERR_NO_CURVE] = MSG_NO_CURVE;
-	core_ctx->reason[ERR_NO_CONFIG] = MSG_NO_CONFIG;
-	core_ctx->last = NULL;
+	thr->reason[ERR_NO_MEMORY] = MSG_NO_MEMORY;
+	thr->reason[ERR_NO_PRECI] = MSG_NO_PRECI;
+	thr->reason[ERR_NO_FILE] = MSG_NO_FILE;
+	thr->reason[ERR_NO_READ] = MSG_NO_READ;
+	thr->reason[ERR_NO_VALID] = MSG_NO_VALID;
+	thr->reason[ERR_NO_BUFFER] = MSG_NO_BUFFER;
+	thr->reason[ERR_NO_FIELD] = MSG_NO_FIELD;
+	thr->reason[ERR_NO_CURVE] = MSG_NO_CURVE;
+	thr->reason[ERR_NO_CONFIG] = MSG_NO_CONFIG;
+	thr->last = NULL;
 #endif /* CHECK */
 
 #ifdef OVERH
-	core_ctx->over = 0;
+	thr->over = 0;
 #endif
 
-	core_ctx->code = RLC_OK;
+	thr->code = RLC_OK;
+
+	rand_init();
+}
+
+int core_init(void) {
+	thr_t *thr;
+	ctx_t *ctx = core_ctx;
+
+	arch_init();
+	if (!core_thr_ctx.init) {
+		core_thr_init();
+		if (core_thr_ctx.code != RLC_OK) {
+			return RLC_ERR;
+		}
+	}
+	thr = &core_thr_ctx;
+	thr->code = RLC_OK;
+
+	if (ctx == NULL) {
+#if MULTI
+		ctx = (ctx_t *)calloc(1, sizeof(ctx_t));
+		if (ctx == NULL) {
+			return RLC_ERR;
+		}
+		ctx->alloc = 1;
+#else
+		ctx = &(first_ctx);
+		ctx->alloc = 0;
+#endif
+		ctx->refs = 1;
+	} else if (ctx != thr->ctx) {
+		/* A context installed with core_set() belongs to the caller. */
+		ctx->alloc = 0;
+		ctx->refs = 1;
+	}
+	core_ctx = thr->ctx = ctx;
 
 	RLC_TRY {
-		arch_init();
-		rand_init();
 #ifdef WITH_FP
 		fp_prime_init();
 #endif
@@ -151,30 +407,53 @@ int core_init(void) {
 	return RLC_OK;
 }
 
+int core_attach(ctx_t *ctx) {
+	/* Refuse to drop the reference held on the current context. */
+	if (ctx == NULL || core_ctx != NULL) {
+		return RLC_ERR;
+	}
+	core_ref(ctx, 1);
+	core_ctx = core_thr()->ctx = ctx;
+	return RLC_OK;
+}
+
 int core_clean(void) {
-	rand_clean();
+	ctx_t *ctx = core_ctx;
+
+	if (ctx != NULL && core_ref(ctx, -1) <= 0) {
 #ifdef WITH_FP
-	fp_prime_clean();
+		fp_prime_clean();
 #endif
 #ifdef WITH_FB
-	fb_poly_clean();
+		fb_poly_clean();
 #endif
 #ifdef WITH_EP
-	ep_curve_clean();
+		ep_curve_clean();
 #endif
 #ifdef WITH_EB
-	eb_curve_clean();
+		eb_curve_clean();
 #endif
 #ifdef WITH_ED
-	ed_curve_clean();
+		ed_curve_clean();
 #endif
 #ifdef WITH_PP
-	pp_map_clean();
+		pp_map_clean();
 #endif
 #ifdef WITH_PC
-	pc_core_clean();
+		pc_core_clean();
+#endif
+		arch_clean();
+#if MULTI == PTHREAD
+		core_pool_stop();
 #endif
-	arch_clean();
+		if (ctx->alloc) {
+			free(ctx);
+		}
+	}
+	if (core_thr_ctx.init) {
+		rand_clean();
+		core_thr_ctx.init = 0;
+	}
 	core_ctx = NULL;
 	return RLC_OK;
 }
@@ -192,9 +471,102 @@ void core_set(ctx_t *ctx) {
 	core_ctx = ctx;
 }
 
+thr_t *core_thr(void) {
+	if (!core_thr_ctx.init) {
+		core_thr_init();
+	}
+	return &core_thr_ctx;
+}
+
 #if MULTI != RELIC_NONE
 void core_set_thread_initializer(void(*init)(void *init_ptr), void* init_ptr) {
     core_thread_initializer = init;
     core_init_ptr = init_ptr;
 }
+
+void core_set_threads(int n) {
+	core_threads = RLC_MAX(n, 1);
+}
+
+int core_get_threads(void) {
+	return core_threads;
+}
+
+void core_run(core_job_t job, void *args, int c) {
+	int i;
+	core_share_t *share = RLC_ALLOCA(core_share_t, c);
+#if MULTI == PTHREAD
+	core_share_t **prev;
+	int pending = 0;
+#endif
+
+	RLC_TRY {
+		if (share == NULL) {
+			RLC_THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < c; i++) {
+			share[i].job = job;
+			share[i].args = args;
+			share[i].i = i;
+			share[i].c = c;
+			share[i].ctx = core_get();
+			share[i].done = 0;
+		}
+
+#if MULTI == PTHREAD
+		pthread_mutex_lock(&pool_lock);
+		core_pool_grow(c - 1);
+		for (i = 1; i < c; i++) {
+			share[i].pending = &pending;
+			share[i].next = NULL;
+			if (pool_tail == NULL) {
+				pool_head = &share[i];
+			} else {
+				pool_tail->next = &share[i];
+			}
+			pool_tail = &share[i];
+			pending++;
+		}
+		pthread_cond_broadcast(&pool_work);
+		pthread_mutex_unlock(&pool_lock);
+
+		core_share(&share[0]);
+
+		/* Take back the shares that no worker has started yet. */
+		pthread_mutex_lock(&pool_lock);
+		pool_tail = NULL;
+		for (prev = &pool_head; *prev != NULL;) {
+			if ((*prev)->pending == &pending) {
+				*prev = (*prev)->next;
+				pending--;
+			} else {
+				pool_tail = *prev;
+				prev = &(*prev)->next;
+			}
+		}
+		while (pending > 0) {
+			pthread_cond_wait(&pool_done, &pool_lock);
+		}
+		pthread_mutex_unlock(&pool_lock);
+#elif MULTI == OPENMP
+		#pragma omp parallel for num_threads(c)
+		for (i = 0; i < c; i++) {
+			core_share(&share[i]);
+		}
+#endif
+
+		/* Compute the shares that could not be delegated. */
+		for (i = 0; i < c; i++) {
+			if (!share[i].done) {
+				job(args, i, c);
+			}
+		}
+	}
+	RLC_CATCH_ANY {
+		RLC_THROW(ERR_CAUGHT);
+	}
+	RLC_FINALLY {
+		RLC_FREE(share);
+	}
+}
 #endif
@@ -50,7 +50,7 @@
 
 void err_simple_msg(int error) {
 	if (error != ERR_CAUGHT) {
-		fprintf(stderr, "\nERROR: %s.\n", core_get()->reason[error]);
+		fprintf(stderr, "\nERROR: %s.\n", core_thr()->reason[error]);
 	}
 }
 
@@ -58,13 +58,13 @@ void err_simple_msg(int error) {
 
 void err_full_msg(const char *function, const char *file, int line,
 		int error) {
-	ctx_t *ctx = core_get();
+	thr_t *thr = core_thr();
 
 	if (error == ERR_CAUGHT) {
 		fprintf(stderr, "\tCAUGHT in %s() at %s,%d.\n", function, file, line);
 	} else {
 		fprintf(stderr, "\nERROR in %s() at %s,%d: %s.\n", function, file, line,
-				ctx->reason[error]);
+				thr->reason[error]);
 
 #if OPSYS == LINUX && HAVE_BACKTRACE && HAVE_BACKTRACE_SYMBOLS 
 		void *trace[100];
@@ -90,17 +90,17 @@ void err_full_msg(const char *function, const char *file, int line,
 #endif /* VERBS */
 
 void err_get_msg(err_t *e, char **msg) {
-	ctx_t *ctx = core_get();
-	*e = *(ctx->last->error);
-	*msg = ctx->reason[*e];
-	ctx->last = NULL;
+	thr_t *thr = core_thr();
+	*e = *(thr->last->error);
+	*msg = thr->reason[*e];
+	thr->last = NULL;
 }
 
 #endif /* CHECK */
 
 int err_get_code(void) {
-	ctx_t *ctx = core_get();
-	int r = ctx->code;
-	ctx->code = RLC_OK;
+	thr_t *thr = core_thr();
+	int r = thr->code;
+	thr->code = RLC_OK;
 	return r;
 }
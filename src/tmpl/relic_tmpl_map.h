@@ -118,6 +118,10 @@
 			CUR##_copy(q, p);												\
 			return;															\
 		}																	\
+		if (CUR##_is_infty(p)) {											\
+			CUR##_set_infty(q);												\
+			return;															\
+		}																	\
 		/* XXX need to add real support for input projective points */		\
 		if (p->coord != BASIC) {											\
 			CUR##_norm(p, p);												\
@@ -167,18 +171,107 @@
 #define TMPL_MAP_CALL_ISOMAP(CUR, PT) /* No isogeny map call in this case. */
 #endif
 
+/**
+ * Adds two points on the isogenous curve used by the SSWU map, given in affine
+ * coordinates with the x-coordinates as fractions x0/d0 and x1/d1, without
+ * any inversion. The sum is returned in Jacobian coordinates.
+ */
+#define TMPL_MAP_ISOGENY_ADD(CUR, PFX, PTR_TY)								\
+	/* declaring this function inline suppresses unused warnings */			\
+	static inline void CUR##_iso_add(CUR##_t r, PFX##_t x0, PFX##_t d0,		\
+			PFX##_t y0, PFX##_t x1, PFX##_t d1, PFX##_t y1) {				\
+		PFX##_t t0, t1, t2, t3, t4;											\
+		PTR_TY *a = core_get()->CUR##_map_c[2];								\
+																			\
+		PFX##_null(t0);														\
+		PFX##_null(t1);														\
+		PFX##_null(t2);														\
+		PFX##_null(t3);														\
+		PFX##_null(t4);														\
+																			\
+		RLC_TRY {															\
+			PFX##_new(t0);													\
+			PFX##_new(t1);													\
+			PFX##_new(t2);													\
+			PFX##_new(t3);													\
+			PFX##_new(t4);													\
+																			\
+			PFX##_mul(t0, x1, d0);											\
+			PFX##_mul(t1, x0, d1);											\
+			PFX##_sub(t2, t0, t1);	/* t2 = x1 * d0 - x0 * d1 */			\
+			PFX##_add(t1, t0, t1);	/* t1 = x1 * d0 + x0 * d1 */			\
+			PFX##_mul(t0, d0, d1);	/* t0 = d0 * d1 */						\
+			if (!PFX##_is_zero(t2)) {										\
+				/* lambda = (y1 - y0) * d0 * d1 / t2 */						\
+				PFX##_sub(t3, y1, y0);										\
+				PFX##_mul(t3, t3, t0);										\
+			} else if (PFX##_cmp(y0, y1) == RLC_EQ && !PFX##_is_zero(y0)) {	\
+				/* lambda = (3 * x0^2 + a * d0^2) / (2 * y0 * d0^2) */		\
+				PFX##_sqr(t4, d0);											\
+				PFX##_mul(t2, t4, y0);										\
+				PFX##_dbl(t2, t2);											\
+				PFX##_mul(t4, t4, a);										\
+				PFX##_sqr(t3, x0);											\
+				PFX##_add(t4, t4, t3);										\
+				PFX##_dbl(t3, t3);											\
+				PFX##_add(t3, t3, t4);										\
+			} else {														\
+				/* the points are opposite, so the sum is the identity. */	\
+				PFX##_zero(t2);												\
+			}																\
+			if (PFX##_is_zero(t2)) {										\
+				CUR##_set_infty(r);											\
+			} else {														\
+				/* lambda = t3 / t2, take Z = t2 * d0 * d1. */				\
+				PFX##_sqr(t4, t2);											\
+				PFX##_mul(t1, t1, t4);										\
+				PFX##_mul(r->z, t2, t0);									\
+				/* X = d0 * d1 * (t3^2 * d0 * d1 - t1 * t2^2). */			\
+				PFX##_sqr(t2, t3);											\
+				PFX##_mul(t2, t2, t0);										\
+				PFX##_sub(t2, t2, t1);										\
+				PFX##_mul(r->x, t2, t0);									\
+				/* Y = t3 * d0 * d1 * (x0 / d0 * Z^2 - X) - y0 * Z^3. */	\
+				PFX##_mul(t1, x0, d1);										\
+				PFX##_mul(t1, t1, t4);										\
+				PFX##_mul(t1, t1, t0);										\
+				PFX##_sub(t1, t1, r->x);									\
+				PFX##_mul(t1, t1, t3);										\
+				PFX##_mul(t1, t1, t0);										\
+				PFX##_sqr(t4, r->z);										\
+				PFX##_mul(t4, t4, r->z);									\
+				PFX##_mul(t4, t4, y0);										\
+				PFX##_sub(r->y, t1, t4);									\
+				r->coord = JACOB;											\
+			}																\
+		}																	\
+		RLC_CATCH_ANY { RLC_THROW(ERR_CAUGHT); }							\
+		RLC_FINALLY {														\
+			PFX##_free(t0);													\
+			PFX##_free(t1);													\
+			PFX##_free(t2);													\
+			PFX##_free(t3);													\
+			PFX##_free(t4);													\
+		}																	\
+	}
+
 /**
  * Simplified SWU mapping from Section 4 of
- * "Fast and simple constant-time hashing to the BLS12-381 Elliptic Curve"
+ * "Fast and simple constant-time hashing to the BLS12-381 Elliptic Curve",
+ * following the straight-line description of RFC 9380, Appendix F.2. The
+ * x-coordinate is returned as the fraction xn/xd, and the caller must provide
+ * a PFX##_srt_ratio(y, u, v) function that computes sqrt(u/v) if u/v is a
+ * square and sqrt(Z * u/v) otherwise, returning whether u/v is a square.
  */
 #define TMPL_MAP_SSWU(CUR, PFX, PTR_TY, COPY_COND)							\
-	static void CUR##_map_sswu(CUR##_t p, PFX##_t t) {						\
+	static void CUR##_map_sswu_frac(PFX##_t xn, PFX##_t xd, PFX##_t y,		\
+			PFX##_t t) {													\
 		PFX##_t t0, t1, t2, t3;												\
 		ctx_t *ctx = core_get();											\
-		PTR_TY *mBoverA = ctx->CUR##_map_c[0];								\
 		PTR_TY *a = ctx->CUR##_map_c[2];									\
 		PTR_TY *b = ctx->CUR##_map_c[3];									\
 		PTR_TY *u = ctx->CUR##_map_u;										\
+		int e;																\
                                                                             \
 		PFX##_null(t0);														\
 		PFX##_null(t1);														\
@@ -195,44 +288,35 @@
 			PFX##_sqr(t0, t);												\
 			PFX##_mul(t0, t0, u);  /* t0 = u * t^2 */						\
 			PFX##_sqr(t1, t0);     /* t1 = u^2 * t^4 */						\
-			PFX##_add(t2, t1, t0); /* t2 = u^2 * t^4 + u * t^2 */			\
+			PFX##_add(t1, t1, t0); /* t1 = u^2 * t^4 + u * t^2 */			\
+			PFX##_add_dig(xn, t1, 1);										\
+			PFX##_mul(xn, xn, b);  /* xn = b * (t1 + 1) */					\
 																			\
-			/* handle the exceptional cases */												\
-			/* XXX(rsw) should be done projectively */										\
-			{																				\
-				const int e1 = PFX##_is_zero(t2);											\
-				PFX##_neg(t3, u);         /* t3 = -u */										\
-				COPY_COND(t2, t3, e1);        /* exception: -u instead of u^2t^4 + ut^2 */	\
-				PFX##_inv(t2, t2);        /* t2 = -1/u or 1/(u^2 * t^4 + u*t^2) */			\
-				PFX##_add_dig(t3, t2, 1); /* t3 = 1 + t2 */									\
-				COPY_COND(t2, t3, e1 == 0);      /* only add 1 if t2 != -1/u */				\
-			}																				\
-			/* e1 goes out of scope */														\
-                                                                                			\
-			/* compute x1, g(x1) */															\
-			PFX##_mul(p->x, t2, mBoverA); /* -B / A * (1 + 1 / (u^2 * t^4 + u * t^2)) */	\
-			PFX##_sqr(p->y, p->x);        /* x^2 */											\
-			PFX##_add(p->y, p->y, a);     /* x^2 + a */										\
-			PFX##_mul(p->y, p->y, p->x);  /* x^3 + a x */									\
-			PFX##_add(p->y, p->y, b);     /* x^3 + a x + b */								\
-                                                                                    		\
-			/* compute x2, g(x2) */															\
-			PFX##_mul(t2, t0, p->x); /* t2 = u * t^2 * x1 */								\
-			PFX##_mul(t1, t0, t1);   /* t1 = u^3 * t^6 */									\
-			PFX##_mul(t3, t1, p->y); /* t5 = g(t2) = u^3 * t^6 * g(p->x) */					\
-																							\
-			/* XXX(rsw)                                                               */	\
-			/* This should be done in constant time and without computing 2 sqrts.    */	\
-			/* Avoiding a second sqrt relies on knowing the 2-adicity of the modulus. */	\
-			if (!PFX##_srt(p->y, p->y)) {													\
-				/* try x2, g(x2) */															\
-				PFX##_copy(p->x, t2);														\
-				if (!PFX##_srt(p->y, t3)) {													\
-					RLC_THROW(ERR_NO_VALID);												\
-				}																			\
-			}																				\
-			PFX##_set_dig(p->z, 1);											\
-			p->coord = BASIC;												\
+			/* handle the exceptional case by using xd = a * u if t1 = 0 */	\
+			e = PFX##_is_zero(t1);											\
+			PFX##_neg(xd, t1);												\
+			COPY_COND(xd, u, e);											\
+			PFX##_mul(xd, xd, a);  /* xd = -a * t1 or a * u */				\
+																			\
+			/* g(x1) = (xn^3 + a * xn * xd^2 + b * xd^3) / xd^3 */			\
+			PFX##_sqr(t2, xn);												\
+			PFX##_sqr(t3, xd);												\
+			PFX##_mul(t1, t3, a);											\
+			PFX##_add(t2, t2, t1);											\
+			PFX##_mul(t2, t2, xn);											\
+			PFX##_mul(t3, t3, xd);											\
+			PFX##_mul(t1, t3, b);											\
+			PFX##_add(t2, t2, t1);											\
+																			\
+			/* a single exponentiation gives either y1 or y2 / (u * t^3) */	\
+			e = PFX##_srt_ratio(y, t2, t3);									\
+																			\
+			/* x2 = u * t^2 * x1 and y2 = u * t^3 * sqrt(u * g(x1)) */		\
+			PFX##_mul(t1, t0, xn);											\
+			COPY_COND(xn, t1, e == 0);										\
+			PFX##_mul(t1, t0, y);											\
+			PFX##_mul(t1, t1, t);											\
+			COPY_COND(y, t1, e == 0);										\
 		}																	\
 		RLC_CATCH_ANY { RLC_THROW(ERR_CAUGHT); }							\
 		RLC_FINALLY {														\
@@ -241,6 +325,14 @@
 			PFX##_free(t2);													\
 			PFX##_free(t3);													\
 		}																	\
+	}																		\
+																			\
+	static void CUR##_map_sswu(CUR##_t p, PFX##_t t) {						\
+		CUR##_map_sswu_frac(p->x, p->z, p->y, t);							\
+		PFX##_inv(p->z, p->z);												\
+		PFX##_mul(p->x, p->x, p->z);										\
+		PFX##_set_dig(p->z, 1);												\
+		p->coord = BASIC;													\
 	}
 
 /**
@@ -250,6 +342,7 @@
 #define TMPL_MAP_SVDW(CUR, PFX, PTR_TY, COPY_COND)							\
 	static void CUR##_map_svdw(CUR##_t p, PFX##_t t) {						\
 		PFX##_t t1, t2, t3, t4;												\
+		int e1, e2;															\
 		PFX##_null(t1);														\
 		PFX##_null(t2);														\
 		PFX##_null(t3);														\
@@ -290,26 +383,28 @@
 			PFX##_mul(t4, t4, t3);											\
 			PFX##_mul(t4, t4, c3);											\
 																			\
-			/* XXX(rsw) this should be constant time */						\
-			/* compute x1 and g(x1) */										\
+			/* compute x1 and g(x1), keep x1 in t1 */						\
 			PFX##_sub(p->x, mUover2, t4);									\
 			CUR##_rhs(p->y, p);												\
+			e1 = (PFX##_smb(p->y) != -1);									\
+			PFX##_copy(t1, p->x);											\
+			/* compute x2 and g(x2) */										\
+			PFX##_add(p->x, mUover2, t4);									\
+			CUR##_rhs(p->y, p);												\
+			e2 = (PFX##_smb(p->y) != -1);									\
+			/* compute x3 in t4 */											\
+			PFX##_sqr(t4, t2);												\
+			PFX##_mul(t4, t4, t3);											\
+			PFX##_sqr(t4, t4);												\
+			PFX##_mul(t4, t4, c4);											\
+			PFX##_add(t4, t4, u);											\
+			/* select the first of x1, x2, x3 with square g(x) */			\
+			COPY_COND(t4, p->x, e2);										\
+			COPY_COND(t4, t1, e1);											\
+			PFX##_copy(p->x, t4);											\
+			CUR##_rhs(p->y, p);												\
 			if (!PFX##_srt(p->y, p->y)) {									\
-				/* compute x2 and g(x2) */									\
-				PFX##_add(p->x, mUover2, t4);								\
-				CUR##_rhs(p->y, p);											\
-				if (!PFX##_srt(p->y, p->y)) {								\
-					/* compute x3 and g(x3) */								\
-					PFX##_sqr(p->x, t2);									\
-					PFX##_mul(p->x, p->x, t3);								\
-					PFX##_sqr(p->x, p->x);									\
-					PFX##_mul(p->x, p->x, c4);								\
-					PFX##_add(p->x, p->x, u);								\
-					CUR##_rhs(p->y, p);										\
-					if (!PFX##_srt(p->y, p->y)) {							\
-						RLC_THROW(ERR_NO_VALID);							\
-					}														\
-				}															\
+				RLC_THROW(ERR_NO_VALID);									\
 			}																\
 			PFX##_set_dig(p->z, 1);											\
 			p->coord = BASIC;												\
@@ -0,0 +1,450 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (C) 2007-2020 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Tests for block ciphers.
+ *
+ * @ingroup test
+ */
+
+#include <stdio.h>
+
+#include "relic.h"
+#include "relic_test.h"
+
+/**
+ * Largest message size used in the tests.
+ */
+#define MSG_SIZE	1000
+
+static int cbc(void) {
+	int code = RLC_ERR, len, out_len;
+	uint8_t key[] = {
+		0x2B, 0x7E, 0x15, 0x16, 0x28, 0xAE, 0xD2, 0xA6, 0xAB, 0xF7, 0x15,
+		0x88, 0x09, 0xCF, 0x4F, 0x3C
+	};
+	uint8_t msg[] = {
+		0x6B, 0xC1, 0xBE, 0xE2, 0x2E, 0x40, 0x9F, 0x96, 0xE9, 0x3D, 0x7E,
+		0x11, 0x73, 0x93, 0x17, 0x2A, 0xAE, 0x2D, 0x8A, 0x57, 0x1E, 0x03,
+		0xAC, 0x9C, 0x9E, 0xB7, 0x6F, 0xAC, 0x45, 0xAF, 0x8E, 0x51, 0x30,
+		0xC8, 0x1C, 0x46, 0xA3, 0x5C, 0xE4, 0x11, 0xE5, 0xFB, 0xC1, 0x19,
+		0x1A, 0x0A, 0x52, 0xEF, 0xF6, 0x9F, 0x24, 0x45, 0xDF, 0x4F, 0x9B,
+		0x17, 0xAD, 0x2B, 0x41, 0x7B, 0xE6, 0x6C, 0x37, 0x10
+	};
+	uint8_t iv[] = {
+		0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A,
+		0x0B, 0x0C, 0x0D, 0x0E, 0x0F
+	};
+	uint8_t result[] = {
+		0x76, 0x49, 0xAB, 0xAC, 0x81, 0x19, 0xB2, 0x46, 0xCE, 0xE9, 0x8E,
+		0x9B, 0x12, 0xE9, 0x19, 0x7D, 0x50, 0x86, 0xCB, 0x9B, 0x50, 0x72,
+		0x19, 0xEE, 0x95, 0xDB, 0x11, 0x3A, 0x91, 0x76, 0x78, 0xB2, 0x73,
+		0xBE, 0xD6, 0xB8, 0xE3, 0xC1, 0x74, 0x3B, 0x71, 0x16, 0xE6, 0x9E,
+		0x22, 0x22, 0x95, 0x16, 0x3F, 0xF1, 0xCA, 0xA1, 0x68, 0x1F, 0xAC,
+		0x09, 0x12, 0x0E, 0xCA, 0x30, 0x75, 0x86, 0xE1, 0xA7, 0x8C, 0xB8,
+		0x28, 0x07, 0x23, 0x0E, 0x13, 0x21, 0xD3, 0xFA, 0xE0, 0x0D, 0x18,
+		0xCC, 0x20, 0x12
+	};
+	uint8_t k[32], in[MSG_SIZE], out[MSG_SIZE + RLC_BC_LEN];
+	uint8_t dec[MSG_SIZE + RLC_BC_LEN];
+
+	TEST_ONCE("aes-128 cbc encryption is correct") {
+		out_len = sizeof(out);
+		TEST_ASSERT(bc_aes_cbc_enc(out, &out_len, msg, sizeof(msg), key,
+						sizeof(key), iv) == RLC_OK, end);
+		TEST_ASSERT(out_len == sizeof(result), end);
+		TEST_ASSERT(memcmp(out, result, sizeof(result)) == 0, end);
+	} TEST_END;
+
+	TEST_BEGIN("aes cbc encryption/decryption is consistent") {
+		for (int j = 16; j <= 32; j += 8) {
+			rand_bytes(k, j);
+			rand_bytes(in, sizeof(in));
+			rand_bytes(iv, sizeof(iv));
+			len = MSG_SIZE - j;
+			out_len = sizeof(out);
+			TEST_ASSERT(bc_aes_cbc_enc(out, &out_len, in, len, k, j,
+							iv) == RLC_OK, end);
+			TEST_ASSERT(out_len == RLC_BC_LEN * (len / RLC_BC_LEN + 1), end);
+			len = sizeof(dec);
+			TEST_ASSERT(bc_aes_cbc_dec(dec, &len, out, out_len, k, j,
+							iv) == RLC_OK, end);
+			TEST_ASSERT(len == MSG_SIZE - j, end);
+			TEST_ASSERT(memcmp(dec, in, len) == 0, end);
+		}
+	} TEST_END;
+
+	TEST_BEGIN("aes cbc encryption/decryption of whole blocks is consistent") {
+		for (int j = 16; j <= 32; j += 8) {
+			rand_bytes(k, j);
+			rand_bytes(in, sizeof(in));
+			rand_bytes(iv, sizeof(iv));
+			len = RLC_BC_LEN * (j / 8);
+			out_len = sizeof(out);
+			TEST_ASSERT(bc_aes_cbc_enc(out, &out_len, in, len, k, j,
+							iv) == RLC_OK, end);
+			TEST_ASSERT(out_len == len + RLC_BC_LEN, end);
+			len = sizeof(dec);
+			TEST_ASSERT(bc_aes_cbc_dec(dec, &len, out, out_len, k, j,
+							iv) == RLC_OK, end);
+			TEST_ASSERT(len == RLC_BC_LEN * (j / 8), end);
+			TEST_ASSERT(memcmp(dec, in, len) == 0, end);
+			/* A single block of padding decrypts to an empty message. */
+			memset(in, RLC_BC_LEN, RLC_BC_LEN);
+			out_len = sizeof(out);
+			TEST_ASSERT(bc_aes_cbc_enc(out, &out_len, in, RLC_BC_LEN, k, j,
+							iv) == RLC_OK, end);
+			len = sizeof(dec);
+			TEST_ASSERT(bc_aes_cbc_dec(dec, &len, out, RLC_BC_LEN, k, j,
+							iv) == RLC_OK, end);
+			TEST_ASSERT(len == 0, end);
+		}
+	} TEST_END;
+
+	code = RLC_OK;
+  end:
+	return code;
+}
+
+/**
+ * Checks that messages encrypted with the accelerated code decrypt with the
+ * portable code and vice versa.
+ */
+static int cbc_paths(void) {
+	int code = RLC_ERR, len, out_len, dec_len;
+	uint8_t k[16], iv[RLC_BC_LEN], in[4 * RLC_BC_LEN];
+	uint8_t out[5 * RLC_BC_LEN], dec[5 * RLC_BC_LEN];
+
+	TEST_BEGIN("aes cbc accelerated and portable code agree") {
+		rand_bytes(k, sizeof(k));
+		rand_bytes(iv, sizeof(iv));
+		rand_bytes(in, sizeof(in));
+		for (int j = 0; j < 2; j++) {
+			for (len = RLC_BC_LEN - 1; len <= 4 * RLC_BC_LEN; len++) {
+				arch_cpu_mask(j == 0 ? 0 : RLC_ARCH_AES);
+				out_len = sizeof(out);
+				TEST_ASSERT(bc_aes_cbc_enc(out, &out_len, in, len, k,
+								sizeof(k), iv) == RLC_OK, end);
+				arch_cpu_mask(j == 0 ? RLC_ARCH_AES : 0);
+				dec_len = sizeof(dec);
+				TEST_ASSERT(bc_aes_cbc_dec(dec, &dec_len, out, out_len, k,
+								sizeof(k), iv) == RLC_OK, end);
+				TEST_ASSERT(dec_len == len, end);
+				TEST_ASSERT(memcmp(dec, in, len) == 0, end);
+			}
+		}
+	} TEST_END;
+
+	code = RLC_OK;
+  end:
+	arch_cpu_mask(0);
+	return code;
+}
+
+/**
+ * Checks that the accelerated and portable code agree on the key schedule and
+ * on the tags of GCM for all key sizes.
+ */
+static int gcm_paths(void) {
+	int code = RLC_ERR, len = 3 * RLC_BC_LEN + 5, out_len[2];
+	uint8_t k[32], n[RLC_BC_GCM_IV], a[20], in[3 * RLC_BC_LEN + 5];
+	uint8_t out[2][3 * RLC_BC_LEN + 5 + RLC_BC_GCM_TAG];
+
+	TEST_BEGIN("aes gcm accelerated and portable code agree") {
+		for (int j = 16; j <= 32; j += 8) {
+			rand_bytes(k, j);
+			rand_bytes(n, sizeof(n));
+			rand_bytes(a, sizeof(a));
+			rand_bytes(in, sizeof(in));
+			for (int l = 0; l < 2; l++) {
+				arch_cpu_mask(l == 0 ? 0 : RLC_ARCH_AES);
+				out_len[l] = sizeof(out[l]);
+				TEST_ASSERT(bc_aes_gcm_enc(out[l], &out_len[l], in, len, k, j,
+								n, a, sizeof(a)) == RLC_OK, end);
+			}
+			TEST_ASSERT(out_len[0] == out_len[1], end);
+			TEST_ASSERT(memcmp(out[0], out[1], out_len[0]) == 0, end);
+		}
+	} TEST_END;
+
+	code = RLC_OK;
+  end:
+	arch_cpu_mask(0);
+	return code;
+}
+
+static int ctr(void) {
+	int code = RLC_ERR, len, out_len;
+	uint8_t key[] = {
+		0x2B, 0x7E, 0x15, 0x16, 0x28, 0xAE, 0xD2, 0xA6, 0xAB, 0xF7, 0x15,
+		0x88, 0x09, 0xCF, 0x4F, 0x3C
+	};
+	uint8_t msg[] = {
+		0x6B, 0xC1, 0xBE, 0xE2, 0x2E, 0x40, 0x9F, 0x96, 0xE9, 0x3D, 0x7E,
+		0x11, 0x73, 0x93, 0x17, 0x2A, 0xAE, 0x2D, 0x8A, 0x57, 0x1E, 0x03,
+		0xAC, 0x9C, 0x9E, 0xB7, 0x6F, 0xAC, 0x45, 0xAF, 0x8E, 0x51, 0x30,
+		0xC8, 0x1C, 0x46, 0xA3, 0x5C, 0xE4, 0x11, 0xE5, 0xFB, 0xC1, 0x19,
+		0x1A, 0x0A, 0x52, 0xEF, 0xF6, 0x9F, 0x24, 0x45, 0xDF, 0x4F, 0x9B,
+		0x17, 0xAD, 0x2B, 0x41, 0x7B, 0xE6, 0x6C, 0x37, 0x10
+	};
+	uint8_t iv[] = {
+		0xF0, 0xF1, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF8, 0xF9, 0xFA,
+		0xFB, 0xFC, 0xFD, 0xFE, 0xFF
+	};
+	uint8_t result[] = {
+		0x87, 0x4D, 0x61, 0x91, 0xB6, 0x20, 0xE3, 0x26, 0x1B, 0xEF, 0x68,
+		0x64, 0x99, 0x0D, 0xB6, 0xCE, 0x98, 0x06, 0xF6, 0x6B, 0x79, 0x70,
+		0xFD, 0xFF, 0x86, 0x17, 0x18, 0x7B, 0xB9, 0xFF, 0xFD, 0xFF, 0x5A,
+		0xE4, 0xDF, 0x3E, 0xDB, 0xD5, 0xD3, 0x5E, 0x5B, 0x4F, 0x09, 0x02,
+		0x0D, 0xB0, 0x3E, 0xAB, 0x1E, 0x03, 0x1D, 0xDA, 0x2F, 0xBE, 0x03,
+		0xD1, 0x79, 0x21, 0x70, 0xA0, 0xF3, 0x00, 0x9C, 0xEE
+	};
+	uint8_t k[32], in[MSG_SIZE], out[MSG_SIZE], dec[MSG_SIZE];
+
+	TEST_ONCE("aes-128 ctr encryption is correct") {
+		out_len = sizeof(out);
+		TEST_ASSERT(bc_aes_ctr_enc(out, &out_len, msg, sizeof(msg), key,
+						sizeof(key), iv) == RLC_OK, end);
+		TEST_ASSERT(out_len == sizeof(result), end);
+		TEST_ASSERT(memcmp(out, result, sizeof(result)) == 0, end);
+		/* Encrypting a suffix must resume from the matching counter. */
+		iv[RLC_BC_LEN - 2] = 0xFF;
+		iv[RLC_BC_LEN - 1] = 0x00;
+		out_len = sizeof(out);
+		TEST_ASSERT(bc_aes_ctr_enc(out, &out_len, msg + RLC_BC_LEN,
+						sizeof(msg) - RLC_BC_LEN, key, sizeof(key), iv) == RLC_OK,
+				end);
+		TEST_ASSERT(memcmp(out, result + RLC_BC_LEN,
+						sizeof(result) - RLC_BC_LEN) == 0, end);
+	} TEST_END;
+
+	TEST_BEGIN("aes ctr encryption/decryption is consistent") {
+		for (int j = 16; j <= 32; j += 8) {
+			rand_bytes(k, j);
+			rand_bytes(in, sizeof(in));
+			rand_bytes(iv, sizeof(iv));
+			/* Make sure the counter carries across several bytes. */
+			memset(iv + 8, 0xFF, 8);
+			len = MSG_SIZE - j;
+			out_len = sizeof(out);
+			TEST_ASSERT(bc_aes_ctr_enc(out, &out_len, in, len, k, j,
+							iv) == RLC_OK, end);
+			TEST_ASSERT(out_len == len, end);
+			TEST_ASSERT(bc_aes_ctr_dec(dec, &len, out, out_len, k, j,
+							iv) == RLC_OK, end);
+			TEST_ASSERT(len == out_len, end);
+			TEST_ASSERT(memcmp(dec, in, len) == 0, end);
+		}
+	} TEST_END;
+
+	code = RLC_OK;
+  end:
+	return code;
+}
+
+static int gcm(void) {
+	int code = RLC_ERR, len, out_len;
+	uint8_t zero[RLC_BC_LEN] = { 0 };
+	uint8_t key[] = {
+		0xFE, 0xFF, 0xE9, 0x92, 0x86, 0x65, 0x73, 0x1C, 0x6D, 0x6A, 0x8F,
+		0x94, 0x67, 0x30, 0x83, 0x08
+	};
+	uint8_t iv[] = {
+		0xCA, 0xFE, 0xBA, 0xBE, 0xFA, 0xCE, 0xDB, 0xAD, 0xDE, 0xCA, 0xF8,
+		0x88
+	};
+	uint8_t msg[] = {
+		0xD9, 0x31, 0x32, 0x25, 0xF8, 0x84, 0x06, 0xE5, 0xA5, 0x59, 0x09,
+		0xC5, 0xAF, 0xF5, 0x26, 0x9A, 0x86, 0xA7, 0xA9, 0x53, 0x15, 0x34,
+		0xF7, 0xDA, 0x2E, 0x4C, 0x30, 0x3D, 0x8A, 0x31, 0x8A, 0x72, 0x1C,
+		0x3C, 0x0C, 0x95, 0x95, 0x68, 0x09, 0x53, 0x2F, 0xCF, 0x0E, 0x24,
+		0x49, 0xA6, 0xB5, 0x25, 0xB1, 0x6A, 0xED, 0xF5, 0xAA, 0x0D, 0xE6,
+		0x57, 0xBA, 0x63, 0x7B, 0x39, 0x1A, 0xAF, 0xD2, 0x55
+	};
+	uint8_t ad[] = {
+		0xFE, 0xED, 0xFA, 0xCE, 0xDE, 0xAD, 0xBE, 0xEF, 0xFE, 0xED, 0xFA,
+		0xCE, 0xDE, 0xAD, 0xBE, 0xEF, 0xAB, 0xAD, 0xDA, 0xD2
+	};
+	uint8_t result[] = {
+		0x42, 0x83, 0x1E, 0xC2, 0x21, 0x77, 0x74, 0x24, 0x4B, 0x72, 0x21,
+		0xB7, 0x84, 0xD0, 0xD4, 0x9C, 0xE3, 0xAA, 0x21, 0x2F, 0x2C, 0x02,
+		0xA4, 0xE0, 0x35, 0xC1, 0x7E, 0x23, 0x29, 0xAC, 0xA1, 0x2E, 0x21,
+		0xD5, 0x14, 0xB2, 0x54, 0x66, 0x93, 0x1C, 0x7D, 0x8F, 0x6A, 0x5A,
+		0xAC, 0x84, 0xAA, 0x05, 0x1B, 0xA3, 0x0B, 0x39, 0x6A, 0x0A, 0xAC,
+		0x97, 0x3D, 0x58, 0xE0, 0x91, 0x47, 0x3F, 0x59, 0x85
+	};
+	uint8_t tag1[] = {
+		0x58, 0xE2, 0xFC, 0xCE, 0xFA, 0x7E, 0x30, 0x61, 0x36, 0x7F, 0x1D,
+		0x57, 0xA4, 0xE7, 0x45, 0x5A
+	};
+	uint8_t res2[] = {
+		0x03, 0x88, 0xDA, 0xCE, 0x60, 0xB6, 0xA3, 0x92, 0xF3, 0x28, 0xC2,
+		0xB9, 0x71, 0xB2, 0xFE, 0x78, 0xAB, 0x6E, 0x47, 0xD4, 0x2C, 0xEC,
+		0x13, 0xBD, 0xF5, 0x3A, 0x67, 0xB2, 0x12, 0x57, 0xBD, 0xDF
+	};
+	uint8_t tag3[] = {
+		0x4D, 0x5C, 0x2A, 0xF3, 0x27, 0xCD, 0x64, 0xA6, 0x2C, 0xF3, 0x5A,
+		0xBD, 0x2B, 0xA6, 0xFA, 0xB4
+	};
+	uint8_t tag4[] = {
+		0x5B, 0xC9, 0x4F, 0xBC, 0x32, 0x21, 0xA5, 0xDB, 0x94, 0xFA, 0xE9,
+		0x5A, 0xE7, 0x12, 0x1A, 0x47
+	};
+	uint8_t k[32], n[RLC_BC_GCM_IV], a[MSG_SIZE], in[MSG_SIZE];
+	uint8_t out[MSG_SIZE + RLC_BC_GCM_TAG], dec[MSG_SIZE];
+
+	TEST_ONCE("aes-128 gcm encryption is correct") {
+		out_len = sizeof(out);
+		TEST_ASSERT(bc_aes_gcm_enc(out, &out_len, NULL, 0, zero, RLC_BC_LEN,
+						zero, NULL, 0) == RLC_OK, end);
+		TEST_ASSERT(out_len == RLC_BC_GCM_TAG, end);
+		TEST_ASSERT(memcmp(out, tag1, RLC_BC_GCM_TAG) == 0, end);
+		out_len = sizeof(out);
+		TEST_ASSERT(bc_aes_gcm_enc(out, &out_len, zero, RLC_BC_LEN, zero,
+						RLC_BC_LEN, zero, NULL, 0) == RLC_OK, end);
+		TEST_ASSERT(out_len == sizeof(res2), end);
+		TEST_ASSERT(memcmp(out, res2, sizeof(res2)) == 0, end);
+		out_len = sizeof(out);
+		TEST_ASSERT(bc_aes_gcm_enc(out, &out_len, msg, sizeof(msg), key,
+						sizeof(key), iv, NULL, 0) == RLC_OK, end);
+		TEST_ASSERT(out_len == sizeof(msg) + RLC_BC_GCM_TAG, end);
+		TEST_ASSERT(memcmp(out, result, sizeof(result)) == 0, end);
+		TEST_ASSERT(memcmp(out + sizeof(msg), tag3, RLC_BC_GCM_TAG) == 0, end);
+		out_len = sizeof(out);
+		TEST_ASSERT(bc_aes_gcm_enc(out, &out_len, msg, sizeof(msg) - 4, key,
+						sizeof(key), iv, ad, sizeof(ad)) == RLC_OK, end);
+		TEST_ASSERT(out_len == sizeof(msg) - 4 + RLC_BC_GCM_TAG, end);
+		TEST_ASSERT(memcmp(out, result, sizeof(result) - 4) == 0, end);
+		TEST_ASSERT(memcmp(out + sizeof(msg) - 4, tag4,
+						RLC_BC_GCM_TAG) == 0, end);
+		len = sizeof(dec);
+		TEST_ASSERT(bc_aes_gcm_dec(dec, &len, out, out_len, key, sizeof(key),
+						iv, ad, sizeof(ad)) == RLC_OK, end);
+		TEST_ASSERT(len == sizeof(msg) - 4, end);
+		TEST_ASSERT(memcmp(dec, msg, len) == 0, end);
+	} TEST_END;
+
+	TEST_BEGIN("aes gcm encryption/decryption is consistent") {
+		for (int j = 16; j <= 32; j += 8) {
+			rand_bytes(k, j);
+			rand_bytes(n, sizeof(n));
+			rand_bytes(a, sizeof(a));
+			rand_bytes(in, sizeof(in));
+			len = MSG_SIZE - j;
+			out_len = sizeof(out);
+			TEST_ASSERT(bc_aes_gcm_enc(out, &out_len, in, len, k, j, n, a,
+							j + 1) == RLC_OK, end);
+			TEST_ASSERT(out_len == len + RLC_BC_GCM_TAG, end);
+			len = sizeof(dec);
+			TEST_ASSERT(bc_aes_gcm_dec(dec, &len, out, out_len, k, j, n, a,
+							j + 1) == RLC_OK, end);
+			TEST_ASSERT(len == out_len - RLC_BC_GCM_TAG, end);
+			TEST_ASSERT(memcmp(dec, in, len) == 0, end);
+		}
+	} TEST_END;
+
+	TEST_BEGIN("aes gcm decryption rejects forgeries") {
+		rand_bytes(k, RLC_BC_LEN);
+		rand_bytes(n, sizeof(n));
+		rand_bytes(a, sizeof(a));
+		rand_bytes(in, sizeof(in));
+		out_len = sizeof(out);
+		TEST_ASSERT(bc_aes_gcm_enc(out, &out_len, in, 100, k, RLC_BC_LEN, n,
+						a, 20) == RLC_OK, end);
+		len = sizeof(dec);
+		a[0] ^= 1;
+		TEST_ASSERT(bc_aes_gcm_dec(dec, &len, out, out_len, k, RLC_BC_LEN, n,
+						a, 20) == RLC_ERR, end);
+		a[0] ^= 1;
+		out[0] ^= 1;
+		TEST_ASSERT(bc_aes_gcm_dec(dec, &len, out, out_len, k, RLC_BC_LEN, n,
+						a, 20) == RLC_ERR, end);
+		out[0] ^= 1;
+		out[out_len - 1] ^= 1;
+		TEST_ASSERT(bc_aes_gcm_dec(dec, &len, out, out_len, k, RLC_BC_LEN, n,
+						a, 20) == RLC_ERR, end);
+		out[out_len - 1] ^= 1;
+		TEST_ASSERT(bc_aes_gcm_dec(dec, &len, out, out_len, k, RLC_BC_LEN, n,
+						a, 20) == RLC_OK, end);
+		TEST_ASSERT(len == 100 && memcmp(dec, in, len) == 0, end);
+	} TEST_END;
+
+	code = RLC_OK;
+  end:
+	return code;
+}
+
+static int aes(void) {
+	if (cbc() != RLC_OK) {
+		return RLC_ERR;
+	}
+	if (ctr() != RLC_OK) {
+		return RLC_ERR;
+	}
+	if (gcm() != RLC_OK) {
+		return RLC_ERR;
+	}
+	return RLC_OK;
+}
+
+int main(void) {
+	if (core_init() != RLC_OK) {
+		core_clean();
+		return 1;
+	}
+
+	util_banner("Tests for the BC module:\n", 0);
+
+	if (aes() != RLC_OK) {
+		core_clean();
+		return 1;
+	}
+
+	/* Run the tests again without the accelerated implementations. */
+	arch_cpu_mask(RLC_ARCH_AES);
+	util_banner("Tests for the BC module (portable code):\n", 0);
+
+	if (aes() != RLC_OK) {
+		arch_cpu_mask(0);
+		core_clean();
+		return 1;
+	}
+	arch_cpu_mask(0);
+
+	if (cbc_paths() != RLC_OK) {
+		core_clean();
+		return 1;
+	}
+
+	if (gcm_paths() != RLC_OK) {
+		core_clean();
+		return 1;
+	}
+
+	util_banner("All tests have passed.\n", 0);
+
+	core_clean();
+	return 0;
+}
@@ -61,6 +61,72 @@ void *tester(void *ptr) {
 	return NULL;
 }
 
+/**
+ * Number of threads sharing the library context, independent of CORES.
+ */
+#define SHARERS		4
+
+typedef struct {
+	ctx_t *ctx;
+	int code;
+} share_t;
+
+void *sharer(void *ptr) {
+	share_t *share = (share_t *)ptr;
+	ep_t p;
+	bn_t k;
+
+	ep_null(p);
+	bn_null(k);
+
+	if (core_attach(share->ctx) != RLC_OK || core_get() != share->ctx) {
+		share->code = RLC_ERR;
+		return NULL;
+	}
+	/* A thread cannot attach while holding a context. */
+	if (core_attach(share->ctx) != RLC_ERR) {
+		share->code = RLC_ERR;
+		core_clean();
+		return NULL;
+	}
+	share->code = RLC_OK;
+	RLC_TRY {
+		ep_new(p);
+		bn_new(k);
+		/* Use the precomputed tables of the shared context. */
+		ep_curve_get_ord(k);
+		bn_rand_mod(k, k);
+		ep_mul_gen(p, k);
+		if (!ep_on_curve(p) || err_get_code() != RLC_OK) {
+			share->code = RLC_ERR;
+		}
+	} RLC_CATCH_ANY {
+		share->code = RLC_ERR;
+	} RLC_FINALLY {
+		ep_free(p);
+		bn_free(k);
+	}
+	/* Errors are kept by the thread and not by the shared context. */
+	RLC_THROW(ERR_NO_MEMORY);
+	if (err_get_code() != RLC_ERR) {
+		share->code = RLC_ERR;
+	}
+	core_clean();
+	return NULL;
+}
+
+void counter(void *args, int i, int c) {
+	int *count = (int *)args;
+	(void)c;
+	/* Shares run with the library context of the caller. */
+	count[i] += (core_get() != NULL);
+}
+
+void nester(void *args, int i, int c) {
+	int (*count)[SHARERS] = (int (*)[SHARERS])args;
+	core_run(counter, count[i], c);
+}
+
 #endif
 
 int main(void) {
@@ -86,12 +152,15 @@ int main(void) {
 		core_set(&new_ctx);
 		/* Reinitialize library with new context. */
 		core_init();
-		/* Run function to manipulate the library context. */
+		TEST_ASSERT(core_get() == &new_ctx, end);
+		/* Run function to manipulate the state of the thread. */
 		RLC_THROW(ERR_NO_MEMORY);
 		core_set(old_ctx);
+		/* The error state belongs to the thread and not to the context. */
+		TEST_ASSERT(core_get() == old_ctx, end);
+		TEST_ASSERT(err_get_code() == RLC_ERR, end);
 		TEST_ASSERT(err_get_code() == RLC_OK, end);
 		core_set(&new_ctx);
-		TEST_ASSERT(err_get_code() == RLC_ERR, end);
 		/* Now we need to finalize the new context. */
 		core_clean();
 		/* And restore the original context. */
@@ -158,6 +227,46 @@ int main(void) {
 		}
 		TEST_ASSERT(code == RLC_OK, end);
 	} TEST_END;
+
+	TEST_ONCE("operations are split among a pool of threads") {
+		int count[SHARERS][SHARERS] = { { 0 } };
+		for (int j = 0; j < 3; j++) {
+			core_run(counter, count[0], SHARERS);
+		}
+		/* Shares can split operations again while the pool is busy. */
+		core_run(nester, count, SHARERS);
+		for (int j = 0; j < SHARERS; j++) {
+			for (int k = 0; k < SHARERS; k++) {
+				TEST_ASSERT(count[j][k] == (j == 0 ? 4 : 1), end);
+			}
+		}
+	} TEST_END;
+
+#if defined(WITH_EP)
+	if (ep_param_set_any() == RLC_OK) {
+		TEST_ONCE("threads can share the library context") {
+			pthread_t thread[SHARERS];
+			share_t share[SHARERS];
+			TEST_ASSERT(core_attach(core_get()) == RLC_ERR, end);
+			for (int j = 0; j < SHARERS; j++) {
+				share[j].ctx = core_get();
+				share[j].code = RLC_ERR;
+				if (pthread_create(&(thread[j]), NULL, sharer, &(share[j]))) {
+					code = RLC_ERR;
+				}
+			}
+			for (int j = 0; j < SHARERS; j++) {
+				if (pthread_join(thread[j], NULL) || share[j].code != RLC_OK) {
+					code = RLC_ERR;
+				}
+			}
+			TEST_ASSERT(code == RLC_OK, end);
+			/* The context survives the threads that shared it. */
+			TEST_ASSERT(core_get() != NULL && core_get()->refs == 1, end);
+			TEST_ASSERT(err_get_code() == RLC_OK, end);
+		} TEST_END;
+	}
+#endif
 #endif
 
 	util_banner("All tests have passed.\n", 0);
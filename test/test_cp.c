@@ -863,20 +863,43 @@ static int bgn(void) {
 }
 
 static int bls(void) {
-	int code = RLC_ERR;
+	int code = RLC_ERR, ok[4], lens[4];
 	bn_t d;
-	g1_t s;
-	g2_t q;
-	uint8_t m[5] = { 0, 1, 2, 3, 4 };
+	g1_t s, _s[4];
+	g2_t q, _q[4];
+	uint8_t m[5] = { 0, 1, 2, 3, 4 }, _m[4][5], *msgs[4];
+#if FP_PRIME < 1536
+	bn_t h;
+	fp_t t;
+	fp2_t u;
+#endif
 
 	bn_null(d);
 	g1_null(s);
 	g2_null(q);
+	for (int i = 0; i < 4; i++) {
+		g1_null(_s[i]);
+		g2_null(_q[i]);
+	}
+#if FP_PRIME < 1536
+	bn_null(h);
+	fp_null(t);
+	fp2_null(u);
+#endif
 
 	RLC_TRY {
 		bn_new(d);
 		g1_new(s);
 		g2_new(q);
+#if FP_PRIME < 1536
+		bn_new(h);
+		fp_new(t);
+		fp2_new(u);
+#endif
+		for (int i = 0; i < 4; i++) {
+			g1_new(_s[i]);
+			g2_new(_q[i]);
+		}
 
 		TEST_BEGIN("boneh-lynn-schacham short signature is correct") {
 			TEST_ASSERT(cp_bls_gen(d, q) == RLC_OK, end);
@@ -884,6 +907,93 @@ static int bls(void) {
 			TEST_ASSERT(cp_bls_ver(s, m, sizeof(m), q) == 1, end);
 		}
 		TEST_END;
+
+		TEST_BEGIN("boneh-lynn-schacham batch verification is correct") {
+			for (int j = 0; j < 4; j++) {
+				rand_bytes(_m[j], sizeof(_m[j]));
+				msgs[j] = _m[j];
+				lens[j] = sizeof(_m[j]);
+				TEST_ASSERT(cp_bls_gen(d, _q[j]) == RLC_OK, end);
+				TEST_ASSERT(cp_bls_sig(_s[j], _m[j], lens[j], d) == RLC_OK, end);
+			}
+			TEST_ASSERT(cp_bls_ver_batch(ok, _s, msgs, lens, _q, 4) == 1, end);
+			for (int j = 0; j < 4; j++) {
+				TEST_ASSERT(ok[j] == 1, end);
+			}
+			/* Replace a signature and check that only it is rejected. */
+			g1_copy(_s[3], _s[0]);
+			TEST_ASSERT(cp_bls_ver_batch(NULL, _s, msgs, lens, _q, 4) == 0,
+					end);
+			TEST_ASSERT(cp_bls_ver_batch(ok, _s, msgs, lens, _q, 4) == 0, end);
+			for (int j = 0; j < 4; j++) {
+				TEST_ASSERT(ok[j] == (j != 3), end);
+			}
+		}
+		TEST_END;
+
+#if FP_PRIME < 1536
+		TEST_BEGIN("boneh-lynn-schacham batch verification checks groups") {
+			for (int j = 0; j < 4; j++) {
+				TEST_ASSERT(cp_bls_gen(d, _q[j]) == RLC_OK, end);
+				TEST_ASSERT(cp_bls_sig(_s[j], _m[j], lens[j], d) == RLC_OK, end);
+			}
+			/* Move a public key out of the subgroup with a twist point. */
+			do {
+				fp2_rand(q->x);
+				fp2_set_dig(q->z, 1);
+				ep2_rhs(u, q);
+			} while (!fp2_srt(q->y, u));
+			q->coord = BASIC;
+			g2_add(_q[1], _q[1], q);
+			g2_norm(_q[1], _q[1]);
+			TEST_ASSERT(cp_bls_ver_batch(ok, _s, msgs, lens, _q, 4) == 0, end);
+			for (int j = 0; j < 4; j++) {
+				TEST_ASSERT(ok[j] == (j != 1), end);
+			}
+			/* Do the same with a signature when G_1 has a cofactor. */
+			ep_curve_get_cof(h);
+			if (bn_cmp_dig(h, 1) != RLC_EQ) {
+				do {
+					fp_rand(s->x);
+					fp_set_dig(s->z, 1);
+					ep_rhs(t, s);
+				} while (!fp_srt(s->y, t));
+				s->coord = BASIC;
+				g1_add(_s[2], _s[2], s);
+				g1_norm(_s[2], _s[2]);
+				TEST_ASSERT(cp_bls_ver_batch(ok, _s, msgs, lens, _q, 4) == 0,
+						end);
+				for (int j = 0; j < 4; j++) {
+					TEST_ASSERT(ok[j] == (j != 1 && j != 2), end);
+				}
+			}
+		}
+		TEST_END;
+#endif
+
+		TEST_BEGIN("boneh-lynn-schacham aggregate signature is correct") {
+			for (int j = 0; j < 4; j++) {
+				rand_bytes(_m[j], sizeof(_m[j]));
+				msgs[j] = _m[j];
+				lens[j] = sizeof(_m[j]);
+				TEST_ASSERT(cp_bls_gen(d, _q[j]) == RLC_OK, end);
+				TEST_ASSERT(cp_bls_sig(_s[j], _m[j], lens[j], d) == RLC_OK, end);
+			}
+			TEST_ASSERT(cp_bls_agg_sig(s, _s, 4) == RLC_OK, end);
+			TEST_ASSERT(cp_bls_agg_ver(s, msgs, lens, _q, 4) == 1, end);
+			TEST_ASSERT(cp_bls_agg_ver(s, msgs, lens, _q, 3) == 0, end);
+			/* Repeated messages are rejected. */
+			msgs[3] = msgs[0];
+			TEST_ASSERT(cp_bls_agg_ver(s, msgs, lens, _q, 4) == 0, end);
+			for (int j = 0; j < 4; j++) {
+				TEST_ASSERT(cp_bls_gen(d, _q[j]) == RLC_OK, end);
+				TEST_ASSERT(cp_bls_sig(_s[j], m, sizeof(m), d) == RLC_OK, end);
+			}
+			TEST_ASSERT(cp_bls_agg_sig(s, _s, 4) == RLC_OK, end);
+			TEST_ASSERT(cp_bls_fast_agg_ver(s, m, sizeof(m), _q, 4) == 1, end);
+			TEST_ASSERT(cp_bls_fast_agg_ver(s, m, sizeof(m), _q, 3) == 0, end);
+		}
+		TEST_END;
 	}
 	RLC_CATCH_ANY {
 		RLC_ERROR(end);
@@ -894,6 +1004,15 @@ static int bls(void) {
 	bn_free(d);
 	g1_free(s);
 	g2_free(q);
+	for (int i = 0; i < 4; i++) {
+		g1_free(_s[i]);
+		g2_free(_q[i]);
+	}
+#if FP_PRIME < 1536
+	bn_free(h);
+	fp_free(t);
+	fp2_free(u);
+#endif
 	return code;
 }
 
@@ -60,19 +60,41 @@ static int memory(void) {
 	return code;
 }
 
+#if MULTI == PTHREAD || MULTI == OPENMP
+
+/**
+ * Initializes the library context of the threads spawned by the library.
+ *
+ * @param[in] ptr			- the unused initializer argument.
+ */
+static void initializer(void *ptr) {
+	(void)ptr;
+	core_init();
+}
+
+#endif
+
 static int util(void) {
 	int l, code = RLC_ERR;
-	ep_t a, b, c;
+	ep_t a, b, c, _a[RLC_EP_READ_MULTI + 1];
 	uint8_t bin[2 * RLC_FP_BYTES + 1];
+	uint8_t _bin[(RLC_EP_READ_MULTI + 1) * (2 * RLC_FP_BYTES + 1)];
+	int r[RLC_EP_READ_MULTI + 1];
 
 	ep_null(a);
 	ep_null(b);
 	ep_null(c);
+	for (int j = 0; j <= RLC_EP_READ_MULTI; j++) {
+		ep_null(_a[j]);
+	}
 
 	RLC_TRY {
 		ep_new(a);
 		ep_new(b);
 		ep_new(c);
+		for (int j = 0; j <= RLC_EP_READ_MULTI; j++) {
+			ep_new(_a[j]);
+		}
 
 		TEST_BEGIN("copy and comparison are consistent") {
 			ep_rand(a);
@@ -167,6 +189,65 @@ static int util(void) {
 			}
 		}
 		TEST_END;
+
+		TEST_BEGIN("batch reading of points is correct") {
+			for (int j = 0; j < 2; j++) {
+				ep_rand(a);
+				l = ep_size_bin(a, j);
+				for (int k = 0; k < 4; k++) {
+					ep_rand(a);
+					ep_write_bin(_bin + k * l, l, a, j);
+				}
+				/* Corrupt the header of the second point. */
+				_bin[l] = 5;
+				/* Encode a point outside the curve as the third one. */
+				ep_set_infty(a);
+				do {
+					fp_rand(a->x);
+					fp_set_dig(a->z, 1);
+					ep_rhs(c->x, a);
+				} while (fp_srt(c->y, c->x));
+				_bin[2 * l] = (j ? 2 : 4);
+				fp_write_bin(_bin + 2 * l + 1, RLC_FP_BYTES, a->x);
+				if (!j) {
+					fp_write_bin(_bin + 2 * l + 1 + RLC_FP_BYTES, RLC_FP_BYTES,
+							a->y);
+				}
+				TEST_ASSERT(ep_read_bin_batch(_a, r, _bin, l, 4) == 2, end);
+				TEST_ASSERT(r[0] && !r[1] && !r[2] && r[3], end);
+				TEST_ASSERT(ep_is_infty(_a[1]) && ep_is_infty(_a[2]), end);
+				ep_read_bin(b, _bin, l);
+				TEST_ASSERT(ep_cmp(_a[0], b) == RLC_EQ, end);
+				ep_read_bin(b, _bin + 3 * l, l);
+				TEST_ASSERT(ep_cmp(_a[3], b) == RLC_EQ, end);
+			}
+		}
+		TEST_END;
+
+		TEST_ONCE("batch reading of many points is correct") {
+			ep_rand(a);
+			l = ep_size_bin(a, 1);
+			for (int j = 0; j <= RLC_EP_READ_MULTI; j++) {
+				ep_rand(a);
+				ep_write_bin(_bin + j * l, l, a, 1);
+			}
+			TEST_ASSERT(ep_read_bin_batch(_a, r, _bin, l, RLC_EP_READ_MULTI + 1) ==
+					RLC_EP_READ_MULTI + 1, end);
+			for (int j = 0; j <= RLC_EP_READ_MULTI; j++) {
+				ep_read_bin(b, _bin + j * l, l);
+				TEST_ASSERT(r[j] && ep_cmp(_a[j], b) == RLC_EQ, end);
+			}
+#if MULTI == PTHREAD || MULTI == OPENMP
+			core_set_thread_initializer(initializer, NULL);
+			TEST_ASSERT(ep_read_bin_batch(_a, r, _bin, l, RLC_EP_READ_MULTI + 1) ==
+					RLC_EP_READ_MULTI + 1, end);
+			core_set_thread_initializer(NULL, NULL);
+			for (int j = 0; j <= RLC_EP_READ_MULTI; j++) {
+				ep_read_bin(b, _bin + j * l, l);
+				TEST_ASSERT(r[j] && ep_cmp(_a[j], b) == RLC_EQ, end);
+			}
+#endif
+		} TEST_END;
 	}
 	RLC_CATCH_ANY {
 		util_print("FATAL ERROR!\n");
@@ -177,18 +258,24 @@ static int util(void) {
 	ep_free(a);
 	ep_free(b);
 	ep_free(c);
+	for (int j = 0; j <= RLC_EP_READ_MULTI; j++) {
+		ep_free(_a[j]);
+	}
 	return code;
 }
 
 static int addition(void) {
 	int code = RLC_ERR;
-	ep_t a, b, c, d, e;
+	ep_t a, b, c, d, e, t[7];
 
 	ep_null(a);
 	ep_null(b);
 	ep_null(c);
 	ep_null(d);
 	ep_null(e);
+	for (int i = 0; i < 7; i++) {
+		ep_null(t[i]);
+	}
 
 	RLC_TRY {
 		ep_new(a);
@@ -196,6 +283,9 @@ static int addition(void) {
 		ep_new(c);
 		ep_new(d);
 		ep_new(e);
+		for (int i = 0; i < 7; i++) {
+			ep_new(t[i]);
+		}
 
 		TEST_BEGIN("point addition is commutative") {
 			ep_rand(a);
@@ -232,6 +322,35 @@ static int addition(void) {
 			TEST_ASSERT(ep_is_infty(e), end);
 		} TEST_END;
 
+		TEST_BEGIN("simultaneous point addition is correct") {
+			ep_rand(a);
+			ep_rand(b);
+			ep_rand(c);
+			ep_dbl(c, c);
+			/* Cover doublings, inverses, infinity and projective inputs. */
+			ep_copy(t[0], a);
+			ep_copy(t[1], b);
+			ep_neg(t[2], b);
+			ep_copy(t[3], a);
+			ep_set_infty(t[4]);
+			ep_copy(t[5], c);
+			ep_copy(t[6], a);
+			ep_add_sim(d, t, 7);
+			ep_dbl(e, a);
+			ep_add(e, e, a);
+			ep_add(e, e, c);
+			ep_norm(e, e);
+			TEST_ASSERT(ep_cmp(d, e) == RLC_EQ, end);
+			ep_add_sim(d, t, 2);
+			ep_add(e, a, b);
+			ep_norm(e, e);
+			TEST_ASSERT(ep_cmp(d, e) == RLC_EQ, end);
+			ep_add_sim(d, t + 1, 2);
+			TEST_ASSERT(ep_is_infty(d), end);
+			ep_add_sim(d, t, 0);
+			TEST_ASSERT(ep_is_infty(d), end);
+		} TEST_END;
+
 #if EP_ADD == BASIC || !defined(STRIP)
 		TEST_BEGIN("point addition in affine coordinates is correct") {
 			ep_rand(a);
@@ -333,6 +452,9 @@ static int addition(void) {
 	ep_free(c);
 	ep_free(d);
 	ep_free(e);
+	for (int i = 0; i < 7; i++) {
+		ep_free(t[i]);
+	}
 	return code;
 }
 
@@ -827,8 +949,14 @@ static int fixed(void) {
 
 static int simultaneous(void) {
 	int code = RLC_ERR;
-	bn_t n, k, l;
-	ep_t p, q, r;
+	bn_t n, k, l, *_k = RLC_ALLOCA(bn_t, RLC_EP_LOT_BASIC);
+	ep_t p, q, r, *_p = RLC_ALLOCA(ep_t, RLC_EP_LOT_BASIC);
+
+	if (_k == NULL || _p == NULL) {
+		RLC_FREE(_k);
+		RLC_FREE(_p);
+		return RLC_ERR;
+	}
 
 	bn_null(n);
 	bn_null(k);
@@ -836,6 +964,10 @@ static int simultaneous(void) {
 	ep_null(p);
 	ep_null(q);
 	ep_null(r);
+	for (int i = 0; i < RLC_EP_LOT_BASIC; i++) {
+		bn_null(_k[i]);
+		ep_null(_p[i]);
+	}
 
 	RLC_TRY {
 		bn_new(n);
@@ -844,6 +976,10 @@ static int simultaneous(void) {
 		ep_new(p);
 		ep_new(q);
 		ep_new(r);
+		for (int i = 0; i < RLC_EP_LOT_BASIC; i++) {
+			bn_new(_k[i]);
+			ep_new(_p[i]);
+		}
 
 		ep_curve_get_gen(p);
 		ep_curve_get_ord(n);
@@ -1044,6 +1180,64 @@ static int simultaneous(void) {
 			ep_mul_sim(q, p, k, q, l);
 			TEST_ASSERT(ep_cmp(q, r) == RLC_EQ, end);
 		} TEST_END;
+
+		TEST_BEGIN("simultaneous multiplication of many points is correct") {
+			for (int i = 0; i < 40; i++) {
+				bn_rand_mod(_k[i], n);
+				if (i % 3 == 1) {
+					bn_neg(_k[i], _k[i]);
+				}
+				ep_rand(_p[i]);
+			}
+			bn_zero(_k[2]);
+			ep_set_infty(_p[3]);
+			ep_mul_sim(q, _p[0], _k[0], _p[1], _k[1]);
+			ep_mul_sim_lot(r, _p, _k, 2);
+			TEST_ASSERT(ep_cmp(q, r) == RLC_EQ, end);
+			for (int i = 2; i < 40; i++) {
+				ep_mul(p, _p[i], _k[i]);
+				ep_add(q, q, p);
+			}
+			ep_norm(q, q);
+			ep_mul_sim_lot(r, _p, _k, 40);
+			TEST_ASSERT(ep_cmp(q, r) == RLC_EQ, end);
+		} TEST_END;
+
+		TEST_ONCE("simultaneous multiplication with buckets is correct") {
+			/* Repeat and negate points to exercise all the bucket cases. */
+			ep_set_infty(q);
+			for (int i = 0; i < RLC_EP_LOT_BASIC; i++) {
+				if (i >= 40) {
+					bn_copy(_k[i], _k[i % 40]);
+					ep_copy(_p[i], _p[i % 40]);
+					if (i % 7 == 0) {
+						ep_neg(_p[i], _p[i]);
+					}
+				}
+				ep_mul(p, _p[i], _k[i]);
+				ep_add(q, q, p);
+			}
+			ep_norm(q, q);
+			ep_mul_sim_lot_projc(r, _p, _k, RLC_EP_LOT_BASIC);
+			TEST_ASSERT(ep_cmp(q, r) == RLC_EQ, end);
+			ep_mul_sim_lot_basic(r, _p, _k, RLC_EP_LOT_BASIC);
+			TEST_ASSERT(ep_cmp(q, r) == RLC_EQ, end);
+			ep_mul_sim_lot(r, _p, _k, RLC_EP_LOT_BASIC);
+			TEST_ASSERT(ep_cmp(q, r) == RLC_EQ, end);
+		} TEST_END;
+
+#if MULTI == PTHREAD || MULTI == OPENMP
+		TEST_ONCE("multithreaded simultaneous multiplication is correct") {
+			core_set_thread_initializer(initializer, NULL);
+			ep_mul_sim_lot_projc(q, _p, _k, RLC_EP_LOT_BASIC);
+			ep_mul_sim_lot(r, _p, _k, RLC_EP_LOT_BASIC);
+			core_set_thread_initializer(NULL, NULL);
+			TEST_ASSERT(ep_cmp(q, r) == RLC_EQ, end);
+			/* Workers attach to the caller context without an initializer. */
+			ep_mul_sim_lot(r, _p, _k, RLC_EP_LOT_BASIC);
+			TEST_ASSERT(ep_cmp(q, r) == RLC_EQ, end);
+		} TEST_END;
+#endif
 	}
 	RLC_CATCH_ANY {
 		util_print("FATAL ERROR!\n");
@@ -1057,6 +1251,12 @@ static int simultaneous(void) {
 	ep_free(p);
 	ep_free(q);
 	ep_free(r);
+	for (int i = 0; i < RLC_EP_LOT_BASIC; i++) {
+		bn_free(_k[i]);
+		ep_free(_p[i]);
+	}
+	RLC_FREE(_k);
+	RLC_FREE(_p);
 	return code;
 }
 
@@ -1098,15 +1298,26 @@ static int hashing(void) {
 	ep_t b;
 	bn_t n;
 	uint8_t msg[5];
+	ep_t _p[RLC_EP_MAP_MULTI + 1];
+	uint8_t _m[RLC_EP_MAP_MULTI + 1][5], *_s[RLC_EP_MAP_MULTI + 1];
+	int _l[RLC_EP_MAP_MULTI + 1];
 
 	ep_null(a);
 	ep_null(b);
 	bn_null(n);
+	for (int j = 0; j <= RLC_EP_MAP_MULTI; j++) {
+		ep_null(_p[j]);
+	}
 
 	RLC_TRY {
 		ep_new(a);
 		ep_new(b);
 		bn_new(n);
+		for (int j = 0; j <= RLC_EP_MAP_MULTI; j++) {
+			ep_new(_p[j]);
+			_s[j] = _m[j];
+			_l[j] = sizeof(_m[j]);
+		}
 
 		ep_curve_get_ord(n);
 
@@ -1120,6 +1331,67 @@ static int hashing(void) {
 			TEST_ASSERT(ep_is_infty(a) == 1, end);
 		}
 		TEST_END;
+
+		TEST_BEGIN("point hashing with prepared tag is correct") {
+			md_xmd_ctx_t ctx;
+			rand_bytes(msg, sizeof(msg));
+			md_xmd_ctx_init(ctx, (const uint8_t *)"RELIC", 5);
+			ep_map_dst_ctx(a, msg, sizeof(msg), ctx);
+			ep_map_dst(b, msg, sizeof(msg), (const uint8_t *)"RELIC", 5);
+			TEST_ASSERT(ep_cmp(a, b) == RLC_EQ, end);
+		}
+		TEST_END;
+
+		TEST_BEGIN("point hashing from a hash state is correct") {
+			md_ctx_t ctx;
+			rand_bytes(msg, sizeof(msg));
+			md_xmd_init(ctx);
+			md_xmd_update(ctx, msg, sizeof(msg) / 2);
+			md_xmd_update(ctx, msg + sizeof(msg) / 2,
+					sizeof(msg) - sizeof(msg) / 2);
+			ep_map_dst_stream(a, ctx, (const uint8_t *)"RELIC", 5);
+			ep_map_dst(b, msg, sizeof(msg), (const uint8_t *)"RELIC", 5);
+			TEST_ASSERT(ep_cmp(a, b) == RLC_EQ, end);
+		}
+		TEST_END;
+
+		TEST_BEGIN("batch point hashing is correct") {
+			for (int j = 0; j < 3; j++) {
+				rand_bytes(_m[j], _l[j]);
+			}
+			ep_map_dst_batch(_p, _s, _l, 3, (const uint8_t *)"RELIC", 5);
+			for (int j = 0; j < 3; j++) {
+				ep_map_dst(a, _m[j], _l[j], (const uint8_t *)"RELIC", 5);
+				TEST_ASSERT(ep_cmp(a, _p[j]) == RLC_EQ, end);
+			}
+		}
+		TEST_END;
+
+		TEST_ONCE("batch hashing of many points is correct") {
+			for (int j = 0; j <= RLC_EP_MAP_MULTI; j++) {
+				rand_bytes(_m[j], _l[j]);
+			}
+			ep_map_dst_batch(_p, _s, _l, RLC_EP_MAP_MULTI + 1,
+					(const uint8_t *)"RELIC", 5);
+			for (int j = 0; j <= RLC_EP_MAP_MULTI; j++) {
+				ep_map_dst(a, _m[j], _l[j], (const uint8_t *)"RELIC", 5);
+				TEST_ASSERT(ep_cmp(a, _p[j]) == RLC_EQ, end);
+			}
+		}
+		TEST_END;
+
+#if MULTI == PTHREAD || MULTI == OPENMP
+		TEST_ONCE("multithreaded batch point hashing is correct") {
+			core_set_thread_initializer(initializer, NULL);
+			ep_map_dst_batch(_p, _s, _l, RLC_EP_MAP_MULTI + 1,
+					(const uint8_t *)"RELIC", 5);
+			core_set_thread_initializer(NULL, NULL);
+			for (int j = 0; j <= RLC_EP_MAP_MULTI; j++) {
+				ep_map_dst(a, _m[j], _l[j], (const uint8_t *)"RELIC", 5);
+				TEST_ASSERT(ep_cmp(a, _p[j]) == RLC_EQ, end);
+			}
+		} TEST_END;
+#endif
 	}
 	RLC_CATCH_ANY {
 		RLC_ERROR(end);
@@ -1129,6 +1401,9 @@ static int hashing(void) {
 	ep_free(a);
 	ep_free(b);
 	bn_free(n);
+	for (int j = 0; j <= RLC_EP_MAP_MULTI; j++) {
+		ep_free(_p[j]);
+	}
 	return code;
 }
 
@@ -60,19 +60,41 @@ static int memory(void) {
 	return code;
 }
 
+#if MULTI == PTHREAD || MULTI == OPENMP
+
+/**
+ * Initializes the library context of the threads spawned by the library.
+ *
+ * @param[in] ptr			- the unused initializer argument.
+ */
+static void initializer(void *ptr) {
+	(void)ptr;
+	core_init();
+}
+
+#endif
+
 static int util(void) {
 	int l, code = RLC_ERR;
-	ep2_t a, b, c;
+	ep2_t a, b, c, _a[RLC_EPX_READ_MULTI + 1];
 	uint8_t bin[4 * RLC_FP_BYTES + 1];
+	uint8_t _bin[(RLC_EPX_READ_MULTI + 1) * (4 * RLC_FP_BYTES + 1)];
+	int r[RLC_EPX_READ_MULTI + 1];
 
 	ep2_null(a);
 	ep2_null(b);
 	ep2_null(c);
+	for (int j = 0; j <= RLC_EPX_READ_MULTI; j++) {
+		ep2_null(_a[j]);
+	}
 
 	RLC_TRY {
 		ep2_new(a);
 		ep2_new(b);
 		ep2_new(c);
+		for (int j = 0; j <= RLC_EPX_READ_MULTI; j++) {
+			ep2_new(_a[j]);
+		}
 
 		TEST_BEGIN("copy and comparison are consistent") {
 			ep2_rand(a);
@@ -166,6 +188,65 @@ static int util(void) {
 			}
 		}
 		TEST_END;
+
+		TEST_BEGIN("batch reading of points is correct") {
+			for (int j = 0; j < 2; j++) {
+				ep2_rand(a);
+				l = ep2_size_bin(a, j);
+				for (int k = 0; k < 4; k++) {
+					ep2_rand(a);
+					ep2_write_bin(_bin + k * l, l, a, j);
+				}
+				/* Corrupt the header of the second point. */
+				_bin[l] = 5;
+				/* Encode a point outside the curve as the third one. */
+				ep2_set_infty(a);
+				do {
+					fp2_rand(a->x);
+					fp2_set_dig(a->z, 1);
+					ep2_rhs(c->x, a);
+				} while (fp2_srt(c->y, c->x));
+				_bin[2 * l] = (j ? 2 : 4);
+				fp2_write_bin(_bin + 2 * l + 1, 2 * RLC_FP_BYTES, a->x, 0);
+				if (!j) {
+					fp2_write_bin(_bin + 2 * l + 1 + 2 * RLC_FP_BYTES,
+							2 * RLC_FP_BYTES, a->y, 0);
+				}
+				TEST_ASSERT(ep2_read_bin_batch(_a, r, _bin, l, 4) == 2, end);
+				TEST_ASSERT(r[0] && !r[1] && !r[2] && r[3], end);
+				TEST_ASSERT(ep2_is_infty(_a[1]) && ep2_is_infty(_a[2]), end);
+				ep2_read_bin(b, _bin, l);
+				TEST_ASSERT(ep2_cmp(_a[0], b) == RLC_EQ, end);
+				ep2_read_bin(b, _bin + 3 * l, l);
+				TEST_ASSERT(ep2_cmp(_a[3], b) == RLC_EQ, end);
+			}
+		}
+		TEST_END;
+
+		TEST_ONCE("batch reading of many points is correct") {
+			ep2_rand(a);
+			l = ep2_size_bin(a, 1);
+			for (int j = 0; j <= RLC_EPX_READ_MULTI; j++) {
+				ep2_rand(a);
+				ep2_write_bin(_bin + j * l, l, a, 1);
+			}
+			TEST_ASSERT(ep2_read_bin_batch(_a, r, _bin, l, RLC_EPX_READ_MULTI + 1) ==
+					RLC_EPX_READ_MULTI + 1, end);
+			for (int j = 0; j <= RLC_EPX_READ_MULTI; j++) {
+				ep2_read_bin(b, _bin + j * l, l);
+				TEST_ASSERT(r[j] && ep2_cmp(_a[j], b) == RLC_EQ, end);
+			}
+#if MULTI == PTHREAD || MULTI == OPENMP
+			core_set_thread_initializer(initializer, NULL);
+			TEST_ASSERT(ep2_read_bin_batch(_a, r, _bin, l, RLC_EPX_READ_MULTI + 1) ==
+					RLC_EPX_READ_MULTI + 1, end);
+			core_set_thread_initializer(NULL, NULL);
+			for (int j = 0; j <= RLC_EPX_READ_MULTI; j++) {
+				ep2_read_bin(b, _bin + j * l, l);
+				TEST_ASSERT(r[j] && ep2_cmp(_a[j], b) == RLC_EQ, end);
+			}
+#endif
+		} TEST_END;
 	}
 	RLC_CATCH_ANY {
 		util_print("FATAL ERROR!\n");
@@ -176,18 +257,24 @@ static int util(void) {
 	ep2_free(a);
 	ep2_free(b);
 	ep2_free(c);
+	for (int j = 0; j <= RLC_EPX_READ_MULTI; j++) {
+		ep2_free(_a[j]);
+	}
 	return code;
 }
 
 static int addition(void) {
 	int code = RLC_ERR;
-	ep2_t a, b, c, d, e;
+	ep2_t a, b, c, d, e, t[7];
 
 	ep2_null(a);
 	ep2_null(b);
 	ep2_null(c);
 	ep2_null(d);
 	ep2_null(e);
+	for (int i = 0; i < 7; i++) {
+		ep2_null(t[i]);
+	}
 
 	RLC_TRY {
 		ep2_new(a);
@@ -195,6 +282,9 @@ static int addition(void) {
 		ep2_new(c);
 		ep2_new(d);
 		ep2_new(e);
+		for (int i = 0; i < 7; i++) {
+			ep2_new(t[i]);
+		}
 
 		TEST_BEGIN("point addition is commutative") {
 			ep2_rand(a);
@@ -231,6 +321,35 @@ static int addition(void) {
 			TEST_ASSERT(ep2_is_infty(e), end);
 		} TEST_END;
 
+		TEST_BEGIN("simultaneous point addition is correct") {
+			ep2_rand(a);
+			ep2_rand(b);
+			ep2_rand(c);
+			ep2_dbl(c, c);
+			/* Cover doublings, inverses, infinity and projective inputs. */
+			ep2_copy(t[0], a);
+			ep2_copy(t[1], b);
+			ep2_neg(t[2], b);
+			ep2_copy(t[3], a);
+			ep2_set_infty(t[4]);
+			ep2_copy(t[5], c);
+			ep2_copy(t[6], a);
+			ep2_add_sim(d, t, 7);
+			ep2_dbl(e, a);
+			ep2_add(e, e, a);
+			ep2_add(e, e, c);
+			ep2_norm(e, e);
+			TEST_ASSERT(ep2_cmp(d, e) == RLC_EQ, end);
+			ep2_add_sim(d, t, 2);
+			ep2_add(e, a, b);
+			ep2_norm(e, e);
+			TEST_ASSERT(ep2_cmp(d, e) == RLC_EQ, end);
+			ep2_add_sim(d, t + 1, 2);
+			TEST_ASSERT(ep2_is_infty(d), end);
+			ep2_add_sim(d, t, 0);
+			TEST_ASSERT(ep2_is_infty(d), end);
+		} TEST_END;
+
 #if EP_ADD == BASIC || !defined(STRIP)
 		TEST_BEGIN("point addition in affine coordinates is correct") {
 			ep2_rand(a);
@@ -292,6 +411,9 @@ static int addition(void) {
 	ep2_free(c);
 	ep2_free(d);
 	ep2_free(e);
+	for (int i = 0; i < 7; i++) {
+		ep2_free(t[i]);
+	}
 	return code;
 }
 
@@ -743,8 +865,14 @@ static int fixed(void) {
 
 static int simultaneous(void) {
 	int code = RLC_ERR;
-	bn_t n, k[2];
-	ep2_t p[2], r;
+	bn_t n, k[2], *_k = RLC_ALLOCA(bn_t, RLC_EPX_LOT_BASIC);
+	ep2_t p[2], r, *_p = RLC_ALLOCA(ep2_t, RLC_EPX_LOT_BASIC);
+
+	if (_k == NULL || _p == NULL) {
+		RLC_FREE(_k);
+		RLC_FREE(_p);
+		return RLC_ERR;
+	}
 
 	bn_null(n);
 	bn_null(k[0]);
@@ -752,6 +880,10 @@ static int simultaneous(void) {
 	ep2_null(p[0]);
 	ep2_null(p[1]);
 	ep2_null(r);
+	for (int i = 0; i < RLC_EPX_LOT_BASIC; i++) {
+		bn_null(_k[i]);
+		ep2_null(_p[i]);
+	}
 
 	RLC_TRY {
 		bn_new(n);
@@ -760,6 +892,10 @@ static int simultaneous(void) {
 		ep2_new(p[0]);
 		ep2_new(p[1]);
 		ep2_new(r);
+		for (int i = 0; i < RLC_EPX_LOT_BASIC; i++) {
+			bn_new(_k[i]);
+			ep2_new(_p[i]);
+		}
 
 		ep2_curve_get_gen(p[0]);
 		ep2_curve_get_ord(n);
@@ -799,6 +935,62 @@ static int simultaneous(void) {
 			TEST_ASSERT(ep2_cmp(p[1], r) == RLC_EQ, end);
 		} TEST_END;
 
+		TEST_BEGIN("simultaneous multiplication of many points is correct") {
+			for (int i = 0; i < 40; i++) {
+				bn_rand_mod(_k[i], n);
+				if (i % 3 == 1) {
+					bn_neg(_k[i], _k[i]);
+				}
+				ep2_rand(_p[i]);
+			}
+			bn_zero(_k[2]);
+			ep2_set_infty(_p[3]);
+			ep2_set_infty(p[1]);
+			for (int i = 0; i < 40; i++) {
+				ep2_mul(r, _p[i], _k[i]);
+				ep2_add(p[1], p[1], r);
+			}
+			ep2_norm(p[1], p[1]);
+			ep2_mul_sim_lot(r, _p, _k, 40);
+			TEST_ASSERT(ep2_cmp(p[1], r) == RLC_EQ, end);
+		} TEST_END;
+
+		TEST_ONCE("simultaneous multiplication with buckets is correct") {
+			/* Repeat and negate points to exercise all the bucket cases. */
+			ep2_set_infty(p[1]);
+			for (int i = 0; i < RLC_EPX_LOT_BASIC; i++) {
+				if (i >= 40) {
+					bn_copy(_k[i], _k[i % 40]);
+					ep2_copy(_p[i], _p[i % 40]);
+					if (i % 7 == 0) {
+						ep2_neg(_p[i], _p[i]);
+					}
+				}
+				ep2_mul(r, _p[i], _k[i]);
+				ep2_add(p[1], p[1], r);
+			}
+			ep2_norm(p[1], p[1]);
+			ep2_mul_sim_lot_projc(r, _p, _k, RLC_EPX_LOT_BASIC);
+			TEST_ASSERT(ep2_cmp(p[1], r) == RLC_EQ, end);
+			ep2_mul_sim_lot_basic(r, _p, _k, RLC_EPX_LOT_BASIC);
+			TEST_ASSERT(ep2_cmp(p[1], r) == RLC_EQ, end);
+			ep2_mul_sim_lot(r, _p, _k, RLC_EPX_LOT_BASIC);
+			TEST_ASSERT(ep2_cmp(p[1], r) == RLC_EQ, end);
+		} TEST_END;
+
+#if MULTI == PTHREAD || MULTI == OPENMP
+		TEST_ONCE("multithreaded simultaneous multiplication is correct") {
+			core_set_thread_initializer(initializer, NULL);
+			ep2_mul_sim_lot_projc(p[1], _p, _k, RLC_EPX_LOT_BASIC);
+			ep2_mul_sim_lot(r, _p, _k, RLC_EPX_LOT_BASIC);
+			core_set_thread_initializer(NULL, NULL);
+			TEST_ASSERT(ep2_cmp(p[1], r) == RLC_EQ, end);
+			/* Workers attach to the caller context without an initializer. */
+			ep2_mul_sim_lot(r, _p, _k, RLC_EPX_LOT_BASIC);
+			TEST_ASSERT(ep2_cmp(p[1], r) == RLC_EQ, end);
+		} TEST_END;
+#endif
+
 #if EP_SIM == BASIC || !defined(STRIP)
 		TEST_BEGIN("basic simultaneous point multiplication is correct") {
 			bn_zero(k[0]);
@@ -976,6 +1168,12 @@ static int simultaneous(void) {
 	ep2_free(p[0]);
 	ep2_free(p[1]);
 	ep2_free(r);
+	for (int i = 0; i < RLC_EPX_LOT_BASIC; i++) {
+		bn_free(_k[i]);
+		ep2_free(_p[i]);
+	}
+	RLC_FREE(_k);
+	RLC_FREE(_p);
 	return code;
 }
 
@@ -1017,15 +1215,26 @@ static int hashing(void) {
 	ep2_t p;
 	ep2_t q;
 	uint8_t msg[5];
+	ep2_t _p[RLC_EPX_MAP_MULTI + 1];
+	uint8_t _m[RLC_EPX_MAP_MULTI + 1][5], *_s[RLC_EPX_MAP_MULTI + 1];
+	int _l[RLC_EPX_MAP_MULTI + 1];
 
 	bn_null(n);
 	ep2_null(p);
 	ep2_null(q);
+	for (int j = 0; j <= RLC_EPX_MAP_MULTI; j++) {
+		ep2_null(_p[j]);
+	}
 
 	RLC_TRY {
 		bn_new(n);
 		ep2_new(p);
 		ep2_new(q);
+		for (int j = 0; j <= RLC_EPX_MAP_MULTI; j++) {
+			ep2_new(_p[j]);
+			_s[j] = _m[j];
+			_l[j] = sizeof(_m[j]);
+		}
 
 		ep2_curve_get_ord(n);
 
@@ -1039,6 +1248,67 @@ static int hashing(void) {
 			TEST_ASSERT(ep2_is_infty(p) == 1, end);
 		}
 		TEST_END;
+
+		TEST_BEGIN("point hashing with prepared tag is correct") {
+			md_xmd_ctx_t ctx;
+			rand_bytes(msg, sizeof(msg));
+			md_xmd_ctx_init(ctx, (const uint8_t *)"RELIC", 5);
+			ep2_map_dst_ctx(p, msg, sizeof(msg), ctx);
+			ep2_map_dst(q, msg, sizeof(msg), (const uint8_t *)"RELIC", 5);
+			TEST_ASSERT(ep2_cmp(p, q) == RLC_EQ, end);
+		}
+		TEST_END;
+
+		TEST_BEGIN("point hashing from a hash state is correct") {
+			md_ctx_t ctx;
+			rand_bytes(msg, sizeof(msg));
+			md_xmd_init(ctx);
+			md_xmd_update(ctx, msg, sizeof(msg) / 2);
+			md_xmd_update(ctx, msg + sizeof(msg) / 2,
+					sizeof(msg) - sizeof(msg) / 2);
+			ep2_map_dst_stream(p, ctx, (const uint8_t *)"RELIC", 5);
+			ep2_map_dst(q, msg, sizeof(msg), (const uint8_t *)"RELIC", 5);
+			TEST_ASSERT(ep2_cmp(p, q) == RLC_EQ, end);
+		}
+		TEST_END;
+
+		TEST_BEGIN("batch point hashing is correct") {
+			for (int j = 0; j < 3; j++) {
+				rand_bytes(_m[j], _l[j]);
+			}
+			ep2_map_dst_batch(_p, _s, _l, 3, (const uint8_t *)"RELIC", 5);
+			for (int j = 0; j < 3; j++) {
+				ep2_map_dst(q, _m[j], _l[j], (const uint8_t *)"RELIC", 5);
+				TEST_ASSERT(ep2_cmp(q, _p[j]) == RLC_EQ, end);
+			}
+		}
+		TEST_END;
+
+		TEST_ONCE("batch hashing of many points is correct") {
+			for (int j = 0; j <= RLC_EPX_MAP_MULTI; j++) {
+				rand_bytes(_m[j], _l[j]);
+			}
+			ep2_map_dst_batch(_p, _s, _l, RLC_EPX_MAP_MULTI + 1,
+					(const uint8_t *)"RELIC", 5);
+			for (int j = 0; j <= RLC_EPX_MAP_MULTI; j++) {
+				ep2_map_dst(q, _m[j], _l[j], (const uint8_t *)"RELIC", 5);
+				TEST_ASSERT(ep2_cmp(q, _p[j]) == RLC_EQ, end);
+			}
+		}
+		TEST_END;
+
+#if MULTI == PTHREAD || MULTI == OPENMP
+		TEST_ONCE("multithreaded batch point hashing is correct") {
+			core_set_thread_initializer(initializer, NULL);
+			ep2_map_dst_batch(_p, _s, _l, RLC_EPX_MAP_MULTI + 1,
+					(const uint8_t *)"RELIC", 5);
+			core_set_thread_initializer(NULL, NULL);
+			for (int j = 0; j <= RLC_EPX_MAP_MULTI; j++) {
+				ep2_map_dst(q, _m[j], _l[j], (const uint8_t *)"RELIC", 5);
+				TEST_ASSERT(ep2_cmp(q, _p[j]) == RLC_EQ, end);
+			}
+		} TEST_END;
+#endif
 	}
 	RLC_CATCH_ANY {
 		util_print("FATAL ERROR!\n");
@@ -1049,6 +1319,9 @@ static int hashing(void) {
 	bn_free(n);
 	ep2_free(p);
 	ep2_free(q);
+	for (int j = 0; j <= RLC_EPX_MAP_MULTI; j++) {
+		ep2_free(_p[j]);
+	}
 	return code;
 }
 
@@ -71,7 +71,7 @@ int main(void) {
 		dummy();
 		if (err_get_code() == RLC_ERR) {
 			err_get_msg(&e, &msg);
-			TEST_ASSERT(msg == core_get()->reason[ERR_NO_MEMORY], end);
+			TEST_ASSERT(msg == core_thr()->reason[ERR_NO_MEMORY], end);
 			TEST_ASSERT(err_get_code() != RLC_ERR, end);
 		}
 	} TEST_END;
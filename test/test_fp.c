@@ -541,6 +541,116 @@ static int squaring(void) {
 	return code;
 }
 
+static int vectorized(void) {
+	int j, code = RLC_ERR;
+	fp_t a[19], b[19], c[19], d[19];
+
+	for (j = 0; j < 19; j++) {
+		fp_null(a[j]);
+		fp_null(b[j]);
+		fp_null(c[j]);
+		fp_null(d[j]);
+	}
+
+	RLC_TRY {
+		for (j = 0; j < 19; j++) {
+			fp_new(a[j]);
+			fp_new(b[j]);
+			fp_new(c[j]);
+			fp_new(d[j]);
+		}
+
+		TEST_BEGIN("vectorized addition is correct") {
+			for (j = 0; j < 19; j++) {
+				fp_rand(a[j]);
+				fp_rand(b[j]);
+				fp_add(c[j], a[j], b[j]);
+			}
+			fp_add_vec(d, (const fp_t *)a, (const fp_t *)b, 19);
+			for (j = 0; j < 19; j++) {
+				TEST_ASSERT(fp_cmp(c[j], d[j]) == RLC_EQ, end);
+			}
+		} TEST_END;
+
+		TEST_BEGIN("vectorized multiplication is correct") {
+			for (j = 0; j < 19; j++) {
+				fp_rand(a[j]);
+				fp_rand(b[j]);
+			}
+			fp_zero(a[0]);
+			fp_set_dig(a[1], 1);
+			fp_neg(a[2], a[1]);
+			fp_neg(b[2], a[1]);
+			fp_neg(a[9], a[1]);
+			for (j = 0; j < 19; j++) {
+				fp_mul(c[j], a[j], b[j]);
+			}
+			for (j = 0; j <= 19; j++) {
+				fp_mul_vec(d, (const fp_t *)a, (const fp_t *)b, j);
+				for (int k = 0; k < j; k++) {
+					TEST_ASSERT(fp_cmp(c[k], d[k]) == RLC_EQ, end);
+				}
+			}
+			fp_mul_vec(a, (const fp_t *)a, (const fp_t *)b, 19);
+			for (j = 0; j < 19; j++) {
+				TEST_ASSERT(fp_cmp(a[j], c[j]) == RLC_EQ, end);
+			}
+		} TEST_END;
+
+		TEST_BEGIN("vectorized squaring is correct") {
+			for (j = 0; j < 19; j++) {
+				fp_rand(a[j]);
+			}
+			fp_zero(a[3]);
+			fp_set_dig(a[4], 1);
+			fp_neg(a[5], a[4]);
+			for (j = 0; j < 19; j++) {
+				fp_sqr(c[j], a[j]);
+			}
+			fp_sqr_vec(d, (const fp_t *)a, 19);
+			for (j = 0; j < 19; j++) {
+				TEST_ASSERT(fp_cmp(c[j], d[j]) == RLC_EQ, end);
+			}
+		} TEST_END;
+
+		TEST_BEGIN("vectorized exponentiation by fixed exponents is correct") {
+			for (j = 0; j < 19; j++) {
+				fp_rand(a[j]);
+			}
+			fp_zero(a[6]);
+			fp_set_dig(a[7], 1);
+			for (int k = 0; k < RLC_FP_EXPS; k++) {
+				for (j = 0; j < 19; j++) {
+					fp_exp_chain(c[j], a[j], k);
+				}
+				fp_exp_chain_vec(d, (const fp_t *)a, k, 19);
+				for (j = 0; j < 19; j++) {
+					TEST_ASSERT(fp_cmp(c[j], d[j]) == RLC_EQ, end);
+				}
+			}
+			for (j = 0; j < 19; j++) {
+				fp_exp_chain(c[j], a[j], RLC_FP_EXP_INV);
+			}
+			fp_exp_chain_vec(a, (const fp_t *)a, RLC_FP_EXP_INV, 19);
+			for (j = 0; j < 19; j++) {
+				TEST_ASSERT(fp_cmp(a[j], c[j]) == RLC_EQ, end);
+			}
+		} TEST_END;
+	}
+	RLC_CATCH_ANY {
+		RLC_ERROR(end);
+	}
+	code = RLC_OK;
+  end:
+	for (j = 0; j < 19; j++) {
+		fp_free(a[j]);
+		fp_free(b[j]);
+		fp_free(c[j]);
+		fp_free(d[j]);
+	}
+	return code;
+}
+
 static int doubling_halving(void) {
 	int code = RLC_ERR;
 	fp_t a, b, c;
@@ -945,6 +1055,35 @@ static int exponentiation(void) {
 		}
 		TEST_END;
 #endif
+
+		TEST_BEGIN("exponentiation by fixed exponents is correct") {
+			fp_rand(a);
+			d->sign = RLC_POS;
+			d->used = RLC_FP_DIGS;
+			dv_copy(d->dp, fp_prime_get(), RLC_FP_DIGS);
+			bn_trim(d);
+			bn_sub_dig(d, d, 2);
+			fp_exp(c, a, d);
+			fp_exp_chain(b, a, RLC_FP_EXP_INV);
+			TEST_ASSERT(fp_cmp(b, c) == RLC_EQ, end);
+			bn_add_dig(d, d, 1);
+			bn_hlv(d, d);
+			fp_exp(c, a, d);
+			fp_exp_chain(b, a, RLC_FP_EXP_LEG);
+			TEST_ASSERT(fp_cmp(b, c) == RLC_EQ, end);
+			bn_add_dig(d, d, 1);
+			bn_hlv(d, d);
+			fp_exp(c, a, d);
+			fp_exp_chain(b, a, RLC_FP_EXP_SRT);
+			TEST_ASSERT(fp_cmp(b, c) == RLC_EQ, end);
+			if (fp_prime_get_mod8() % 4 == 3) {
+				bn_sub_dig(d, d, 1);
+				fp_exp(c, a, d);
+				fp_exp_chain(b, a, RLC_FP_EXP_ISR);
+				TEST_ASSERT(fp_cmp(b, c) == RLC_EQ, end);
+			}
+		}
+		TEST_END;
 	}
 	RLC_CATCH_ANY {
 		RLC_ERROR(end);
@@ -984,6 +1123,41 @@ static int square_root(void) {
 			}
 		}
 		TEST_END;
+
+		TEST_BEGIN("legendre symbol is correct") {
+			fp_zero(a);
+			TEST_ASSERT(fp_smb(a) == 0, end);
+			fp_rand(a);
+			fp_sqr(c, a);
+			TEST_ASSERT(fp_smb(c) == 1, end);
+			fp_set_dig(b, -fp_prime_get_qnr());
+			fp_neg(b, b);
+			fp_mul(c, c, b);
+			TEST_ASSERT(fp_smb(c) == -1, end);
+			fp_rand(a);
+			TEST_ASSERT(fp_smb(a) == (fp_srt(b, a) ? 1 : -1), end);
+		}
+		TEST_END;
+
+#if FP_SMB == BASIC || !defined(STRIP)
+		TEST_BEGIN("basic legendre symbol is correct") {
+			fp_rand(a);
+			TEST_ASSERT(fp_smb_basic(a) == fp_smb(a), end);
+			fp_sqr(a, a);
+			TEST_ASSERT(fp_smb_basic(a) == fp_smb(a), end);
+		}
+		TEST_END;
+#endif
+
+#if FP_SMB == BINAR || !defined(STRIP)
+		TEST_BEGIN("binary legendre symbol is correct") {
+			fp_rand(a);
+			TEST_ASSERT(fp_smb_binar(a) == fp_smb(a), end);
+			fp_sqr(a, a);
+			TEST_ASSERT(fp_smb_binar(a) == fp_smb(a), end);
+		}
+		TEST_END;
+#endif
 	}
 	RLC_CATCH_ANY {
 		RLC_ERROR(end);
@@ -1108,6 +1282,11 @@ int main(void) {
 		return 1;
 	}
 
+	if (vectorized() != RLC_OK) {
+		core_clean();
+		return 1;
+	}
+
 	if (doubling_halving() != RLC_OK) {
 		core_clean();
 		return 1;
@@ -1143,6 +1322,78 @@ int main(void) {
 		return 1;
 	}
 
+#ifdef ARITH_ALT
+	/* Run the arithmetic tests again with the fallback backend. */
+	arch_arith_force(1);
+	util_banner("Arithmetic (fallback backend)", 1);
+	if (addition() != RLC_OK) {
+		arch_arith_force(0);
+		core_clean();
+		return 1;
+	}
+
+	if (subtraction() != RLC_OK) {
+		arch_arith_force(0);
+		core_clean();
+		return 1;
+	}
+
+	if (multiplication() != RLC_OK) {
+		arch_arith_force(0);
+		core_clean();
+		return 1;
+	}
+
+	if (squaring() != RLC_OK) {
+		arch_arith_force(0);
+		core_clean();
+		return 1;
+	}
+
+	if (vectorized() != RLC_OK) {
+		arch_arith_force(0);
+		core_clean();
+		return 1;
+	}
+
+	if (doubling_halving() != RLC_OK) {
+		arch_arith_force(0);
+		core_clean();
+		return 1;
+	}
+
+	if (shifting() != RLC_OK) {
+		arch_arith_force(0);
+		core_clean();
+		return 1;
+	}
+
+	if (reduction() != RLC_OK) {
+		arch_arith_force(0);
+		core_clean();
+		return 1;
+	}
+
+	if (inversion() != RLC_OK) {
+		arch_arith_force(0);
+		core_clean();
+		return 1;
+	}
+
+	if (exponentiation() != RLC_OK) {
+		arch_arith_force(0);
+		core_clean();
+		return 1;
+	}
+
+	if (square_root() != RLC_OK) {
+		arch_arith_force(0);
+		core_clean();
+		return 1;
+	}
+	arch_arith_force(0);
+#endif
+
 	util_banner("All tests have passed.\n", 0);
 
 	core_clean();
@@ -814,6 +814,30 @@ static int square_root2(void) {
 			TEST_ASSERT(fp2_cmp(b, a) == RLC_EQ ||
 					fp2_cmp(c, a) == RLC_EQ, end);
 		} TEST_END;
+
+		TEST_BEGIN("square root of non-square is rejected") {
+			fp2_rand(a);
+			fp2_sqr(c, a);
+			fp2_mul_nor(b, c);
+			TEST_ASSERT(fp2_srt(a, b) == 0, end);
+			fp2_rand(a);
+			if (fp2_srt(b, a)) {
+				fp2_sqr(c, b);
+				TEST_ASSERT(fp2_cmp(c, a) == RLC_EQ, end);
+			}
+		} TEST_END;
+
+		TEST_BEGIN("quadratic character is correct") {
+			fp2_zero(a);
+			TEST_ASSERT(fp2_smb(a) == 0, end);
+			fp2_rand(a);
+			fp2_sqr(c, a);
+			TEST_ASSERT(fp2_smb(c) == 1, end);
+			fp2_mul_nor(b, c);
+			TEST_ASSERT(fp2_smb(b) == -1, end);
+			fp2_rand(a);
+			TEST_ASSERT(fp2_smb(a) == (fp2_srt(b, a) ? 1 : -1), end);
+		} TEST_END;
 	}
 	RLC_CATCH_ANY {
 		util_print("FATAL ERROR!\n");
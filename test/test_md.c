@@ -126,6 +126,21 @@ static int sha224(void) {
 	}
 	TEST_END;
 
+	TEST_ONCE("sha224 incremental hash function is correct") {
+		md_ctx_t ctx;
+		uint8_t msg[300], h1[RLC_MD_LEN_SH224], h2[RLC_MD_LEN_SH224];
+		rand_bytes(msg, sizeof(msg));
+		md_map_sh224(h1, msg, sizeof(msg));
+		for (j = 0; j <= 300; j += 25) {
+			md_init_sh224(ctx);
+			md_update_sh224(ctx, msg, j);
+			md_update_sh224(ctx, msg + j, 300 - j);
+			md_final_sh224(h2, ctx);
+			TEST_ASSERT(memcmp(h1, h2, RLC_MD_LEN_SH224) == 0, end);
+		}
+	}
+	TEST_END;
+
 	TEST_ONCE("sha224 xmd function is correct") {
 		uint8_t buf[75] = {0,};
 		md_xmd_sh224(buf, 16, (uint8_t *)TEST1, strlen(TEST1), (uint8_t *)"", 0);
@@ -209,6 +224,21 @@ static int sha256(void) {
 	}
 	TEST_END;
 
+	TEST_ONCE("sha256 incremental hash function is correct") {
+		md_ctx_t ctx;
+		uint8_t msg[300], h1[RLC_MD_LEN_SH256], h2[RLC_MD_LEN_SH256];
+		rand_bytes(msg, sizeof(msg));
+		md_map_sh256(h1, msg, sizeof(msg));
+		for (j = 0; j <= 300; j += 25) {
+			md_init_sh256(ctx);
+			md_update_sh256(ctx, msg, j);
+			md_update_sh256(ctx, msg + j, 300 - j);
+			md_final_sh256(h2, ctx);
+			TEST_ASSERT(memcmp(h1, h2, RLC_MD_LEN_SH256) == 0, end);
+		}
+	}
+	TEST_END;
+
 	TEST_ONCE("sha256 xmd function is correct") {
 		uint8_t buf[75] = {0,};
 		md_xmd_sh256(buf, 16, (uint8_t *)TEST1, strlen(TEST1), (uint8_t *)"", 0);
@@ -222,6 +252,92 @@ static int sha256(void) {
 	}
 	TEST_END;
 
+	TEST_ONCE("xmd function with prepared tag is correct") {
+		md_xmd_ctx_t ctx;
+		uint8_t dst[255], buf[255], buf2[255];
+		rand_bytes(dst, sizeof(dst));
+		rand_bytes(message, 100);
+		for (j = 0; j <= 255; j += 17) {
+			md_xmd_ctx_init(ctx, dst, j);
+			md_xmd(buf, 255 - j, message, j % 100, dst, j);
+			md_xmd_ctx_run(buf2, 255 - j, message, j % 100, ctx);
+			TEST_ASSERT(memcmp(buf, buf2, 255 - j) == 0, end);
+		}
+#if MD_MAP == SH256
+		md_xmd_ctx_init(ctx, (uint8_t *)TEST4b, strlen(TEST4b));
+		md_xmd_ctx_run(buf, 75, (uint8_t *)TEST4a, strlen(TEST4a), ctx);
+		TEST_ASSERT(memcmp(buf, result_xmd_sha256[3], 75) == 0, end);
+#endif
+	}
+	TEST_END;
+
+	TEST_ONCE("incremental xmd function is correct") {
+		md_ctx_t ctx;
+		uint8_t msg[300], buf[200], buf2[200];
+		rand_bytes(msg, sizeof(msg));
+		md_xmd(buf, sizeof(buf), msg, sizeof(msg), (uint8_t *)TEST4b,
+				strlen(TEST4b));
+		for (j = 0; j <= 300; j += 60) {
+			md_xmd_init(ctx);
+			md_xmd_update(ctx, msg, j);
+			md_xmd_update(ctx, msg + j, 300 - j);
+			md_xmd_final(buf2, sizeof(buf2), ctx, (uint8_t *)TEST4b,
+					strlen(TEST4b));
+			TEST_ASSERT(memcmp(buf, buf2, sizeof(buf)) == 0, end);
+		}
+	}
+	TEST_END;
+
+	/* Hide the SHA extensions to reach the AVX2 code, then hide both to reach
+	 * the portable code. */
+	for (int k = 0; k < 3; k++) {
+		const int mask[] = {
+			0, RLC_ARCH_SHA, RLC_ARCH_SHA | RLC_ARCH_AVX2
+		};
+
+		if (k == 1 && !arch_cpu_has(RLC_ARCH_AVX2)) {
+			continue;
+		}
+
+		TEST_ONCE("sha256 hash function of many messages is correct") {
+			const int lens[] = { 0, 1, 55, 56, 63, 64, 65, 119, 120, 128, 200 };
+			const uint8_t *msgs[11];
+			uint8_t msg[11][200], hashes[11 * 32];
+			for (j = 0; j < 11; j++) {
+				rand_bytes(msg[j], sizeof(msg[j]));
+				msgs[j] = msg[j];
+			}
+			arch_cpu_mask(mask[k]);
+			md_map_sh256_many(hashes, msgs, lens, 11);
+			arch_cpu_mask(0);
+			for (j = 0; j < 11; j++) {
+				md_map_sh256(digest, msg[j], lens[j]);
+				TEST_ASSERT(memcmp(digest, hashes + 32 * j, 32) == 0, end);
+			}
+		}
+		TEST_END;
+
+		TEST_ONCE("sha256 xmd function of many messages is correct") {
+			const int lens[] = { 0, 3, 32, 64, 100, 16, 1, 55, 128 };
+			const uint8_t *msgs[9];
+			uint8_t msg[9][128], buf[75], bufs[9 * 75];
+			for (j = 0; j < 9; j++) {
+				rand_bytes(msg[j], sizeof(msg[j]));
+				msgs[j] = msg[j];
+			}
+			arch_cpu_mask(mask[k]);
+			md_xmd_sh256_many(bufs, 75, msgs, lens, 9, (uint8_t *)TEST4b,
+					strlen(TEST4b));
+			arch_cpu_mask(0);
+			for (j = 0; j < 9; j++) {
+				md_xmd_sh256(buf, 75, msg[j], lens[j], (uint8_t *)TEST4b,
+						strlen(TEST4b));
+				TEST_ASSERT(memcmp(buf, bufs + 75 * j, 75) == 0, end);
+			}
+		}
+		TEST_END;
+	}
+
 	code = RLC_OK;
 
   end:
@@ -306,6 +422,21 @@ static int sha384(void) {
 	}
 	TEST_END;
 
+	TEST_ONCE("sha384 incremental hash function is correct") {
+		md_ctx_t ctx;
+		uint8_t msg[300], h1[RLC_MD_LEN_SH384], h2[RLC_MD_LEN_SH384];
+		rand_bytes(msg, sizeof(msg));
+		md_map_sh384(h1, msg, sizeof(msg));
+		for (j = 0; j <= 300; j += 25) {
+			md_init_sh384(ctx);
+			md_update_sh384(ctx, msg, j);
+			md_update_sh384(ctx, msg + j, 300 - j);
+			md_final_sh384(h2, ctx);
+			TEST_ASSERT(memcmp(h1, h2, RLC_MD_LEN_SH384) == 0, end);
+		}
+	}
+	TEST_END;
+
 	TEST_ONCE("sha384 xmd function is correct") {
 		uint8_t buf[75] = {0,};
 		md_xmd_sh384(buf, 16, (uint8_t *)TEST1, strlen(TEST1), (uint8_t *)"", 0);
@@ -401,6 +532,21 @@ static int sha512(void) {
 	}
 	TEST_END;
 
+	TEST_ONCE("sha512 incremental hash function is correct") {
+		md_ctx_t ctx;
+		uint8_t msg[300], h1[RLC_MD_LEN_SH512], h2[RLC_MD_LEN_SH512];
+		rand_bytes(msg, sizeof(msg));
+		md_map_sh512(h1, msg, sizeof(msg));
+		for (j = 0; j <= 300; j += 25) {
+			md_init_sh512(ctx);
+			md_update_sh512(ctx, msg, j);
+			md_update_sh512(ctx, msg + j, 300 - j);
+			md_final_sh512(h2, ctx);
+			TEST_ASSERT(memcmp(h1, h2, RLC_MD_LEN_SH512) == 0, end);
+		}
+	}
+	TEST_END;
+
 	TEST_ONCE("sha512 xmd function is correct") {
 		uint8_t buf[75] = {0,};
 		md_xmd_sh512(buf, 16, (uint8_t *)TEST1, strlen(TEST1), (uint8_t *)"", 0);
@@ -422,6 +568,47 @@ static int sha512(void) {
 
 #endif
 
+#if MD_MAP == B2S160 || MD_MAP == B2S256 || !defined(STRIP)
+
+static int blake2s(void) {
+	int code = RLC_ERR, j;
+	md_ctx_t ctx;
+	uint8_t msg[300], h1[RLC_MD_LEN_B2S256], h2[RLC_MD_LEN_B2S256];
+
+	TEST_ONCE("blake2s-160 incremental hash function is correct") {
+		rand_bytes(msg, sizeof(msg));
+		md_map_b2s160(h1, msg, sizeof(msg));
+		for (j = 0; j <= 300; j += 25) {
+			md_init_b2s160(ctx);
+			md_update_b2s160(ctx, msg, j);
+			md_update_b2s160(ctx, msg + j, 300 - j);
+			md_final_b2s160(h2, ctx);
+			TEST_ASSERT(memcmp(h1, h2, RLC_MD_LEN_B2S160) == 0, end);
+		}
+	}
+	TEST_END;
+
+	TEST_ONCE("blake2s-256 incremental hash function is correct") {
+		rand_bytes(msg, sizeof(msg));
+		md_map_b2s256(h1, msg, sizeof(msg));
+		for (j = 0; j <= 300; j += 25) {
+			md_init_b2s256(ctx);
+			md_update_b2s256(ctx, msg, j);
+			md_update_b2s256(ctx, msg + j, 300 - j);
+			md_final_b2s256(h2, ctx);
+			TEST_ASSERT(memcmp(h1, h2, RLC_MD_LEN_B2S256) == 0, end);
+		}
+	}
+	TEST_END;
+
+	code = RLC_OK;
+
+  end:
+	return code;
+}
+
+#endif
+
 #if MD_MAP == SH256
 
 /* Test vector #1, ANSI X9.63 */
@@ -461,7 +648,7 @@ static int kdf(void) {
 }
 
 static int hmac(void) {
-	int code = RLC_ERR;
+	int code = RLC_ERR, j;
 	uint8_t mac[RLC_MD_LEN];
 
 #if MD_MAP == SH256
@@ -526,6 +713,22 @@ static int hmac(void) {
 	TEST_END;
 #endif
 
+	TEST_ONCE("incremental hmac is correct") {
+		md_hmac_ctx_t ctx;
+		uint8_t msg[300], k[200], mac1[RLC_MD_LEN], mac2[RLC_MD_LEN];
+		rand_bytes(msg, sizeof(msg));
+		rand_bytes(k, sizeof(k));
+		for (j = 0; j <= 200; j += 50) {
+			md_hmac(mac1, msg, sizeof(msg), k, j);
+			md_hmac_init(ctx, k, j);
+			md_hmac_update(ctx, msg, j);
+			md_hmac_update(ctx, msg + j, 300 - j);
+			md_hmac_final(mac2, ctx);
+			TEST_ASSERT(memcmp(mac1, mac2, RLC_MD_LEN) == 0, end);
+		}
+	}
+	TEST_END;
+
 	code = RLC_OK;
 
   end:
@@ -568,6 +771,13 @@ int main(void) {
 	}
 #endif
 
+#if MD_MAP == B2S160 || MD_MAP == B2S256 || !defined(STRIP)
+	if (blake2s() != RLC_OK) {
+		core_clean();
+		return 1;
+	}
+#endif
+
 	if (kdf() != RLC_OK) {
 		core_clean();
 		return 1;
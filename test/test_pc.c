@@ -549,14 +549,44 @@ static int simultaneous1(void) {
 	return code;
 }
 
+#if MULTI == PTHREAD || MULTI == OPENMP
+
+/**
+ * Initializes the library context of the threads spawned by the library.
+ *
+ * @param[in] ptr			- the unused initializer argument.
+ */
+static void initializer(void *ptr) {
+	(void)ptr;
+	core_init();
+}
+
+#endif
+
 static int validity1(void) {
-	int code = RLC_ERR;
-	g1_t a;
+	int l, code = RLC_ERR;
+	g1_t a, b, _a[RLC_EP_READ_MULTI + 1];
+	uint8_t bin[(RLC_EP_READ_MULTI + 1) * (RLC_FP_BYTES + 1)];
+	int r[RLC_EP_READ_MULTI + 1];
+	fp_t t;
+	bn_t h;
 
 	g1_null(a);
+	g1_null(b);
+	fp_null(t);
+	bn_null(h);
+	for (int j = 0; j <= RLC_EP_READ_MULTI; j++) {
+		g1_null(_a[j]);
+	}
 
 	RLC_TRY {
 		g1_new(a);
+		g1_new(b);
+		fp_new(t);
+		bn_new(h);
+		for (int j = 0; j <= RLC_EP_READ_MULTI; j++) {
+			g1_new(_a[j]);
+		}
 
 		TEST_BEGIN("validity test is correct") {
 			g1_set_infty(a);
@@ -566,6 +596,63 @@ static int validity1(void) {
 		}
 		TEST_END;
 
+		TEST_BEGIN("validity test rejects points outside the subgroup") {
+			/* Sample a point on the curve without clearing the cofactor. */
+			do {
+				fp_rand(a->x);
+				fp_set_dig(a->z, 1);
+				ep_rhs(t, a);
+			} while (!fp_srt(a->y, t));
+			a->coord = BASIC;
+			ep_curve_get_cof(h);
+			if (bn_cmp_dig(h, 1) == RLC_EQ) {
+				TEST_ASSERT(g1_is_valid(a), end);
+			} else {
+				TEST_ASSERT(!g1_is_valid(a), end);
+				g1_rand(b);
+				g1_add(b, b, a);
+				TEST_ASSERT(!g1_is_valid(b), end);
+			}
+		}
+		TEST_END;
+
+		TEST_ONCE("batch reading and validation are correct") {
+			g1_rand(a);
+			l = g1_size_bin(a, 1);
+			for (int j = 0; j <= RLC_EP_READ_MULTI; j++) {
+				g1_rand(a);
+				g1_write_bin(bin + j * l, l, a, 1);
+			}
+			/* Replace the second point by one outside the subgroup. */
+			do {
+				fp_rand(a->x);
+				fp_set_dig(a->z, 1);
+				ep_rhs(t, a);
+			} while (!fp_srt(a->y, t));
+			a->coord = BASIC;
+			g1_write_bin(bin + l, l, a, 1);
+			ep_curve_get_cof(h);
+			int k = (bn_cmp_dig(h, 1) == RLC_EQ);
+			TEST_ASSERT(g1_read_bin_batch(_a, r, bin, l, RLC_EP_READ_MULTI + 1)
+					== RLC_EP_READ_MULTI + k, end);
+			TEST_ASSERT(r[1] == k, end);
+			for (int j = 0; j <= RLC_EP_READ_MULTI; j++) {
+				g1_read_bin(b, bin + j * l, l);
+				TEST_ASSERT(!r[j] || g1_cmp(_a[j], b) == RLC_EQ, end);
+			}
+#if MULTI == PTHREAD || MULTI == OPENMP
+			core_set_thread_initializer(initializer, NULL);
+			TEST_ASSERT(g1_read_bin_batch(_a, r, bin, l, RLC_EP_READ_MULTI + 1)
+					== RLC_EP_READ_MULTI + k, end);
+			core_set_thread_initializer(NULL, NULL);
+			TEST_ASSERT(r[1] == k, end);
+			for (int j = 0; j <= RLC_EP_READ_MULTI; j++) {
+				g1_read_bin(b, bin + j * l, l);
+				TEST_ASSERT(!r[j] || g1_cmp(_a[j], b) == RLC_EQ, end);
+			}
+#endif
+		} TEST_END;
+
 		TEST_BEGIN("blinding is consistent") {
 			g1_rand(a);
 			g1_blind(a, a);
@@ -578,6 +665,12 @@ static int validity1(void) {
 	code = RLC_OK;
   end:
 	g1_free(a);
+	g1_free(b);
+	fp_free(t);
+	bn_free(h);
+	for (int j = 0; j <= RLC_EP_READ_MULTI; j++) {
+		g1_free(_a[j]);
+	}
 	return code;
 }
 
@@ -1131,12 +1224,32 @@ static int simultaneous2(void) {
 
 static int validity2(void) {
 	int code = RLC_ERR;
-	g2_t a;
+	g2_t a, b;
+#if FP_PRIME < 1536
+	int l, r[RLC_EPX_READ_MULTI + 1];
+	uint8_t bin[(RLC_EPX_READ_MULTI + 1) * (2 * RLC_FP_BYTES + 1)];
+	g2_t _a[RLC_EPX_READ_MULTI + 1];
+	fp2_t t;
+#endif
 
 	g2_null(a);
+	g2_null(b);
+#if FP_PRIME < 1536
+	fp2_null(t);
+	for (int j = 0; j <= RLC_EPX_READ_MULTI; j++) {
+		g2_null(_a[j]);
+	}
+#endif
 
 	RLC_TRY {
 		g2_new(a);
+		g2_new(b);
+#if FP_PRIME < 1536
+		fp2_new(t);
+		for (int j = 0; j <= RLC_EPX_READ_MULTI; j++) {
+			g2_new(_a[j]);
+		}
+#endif
 
 		TEST_BEGIN("validity test is correct") {
 			g2_set_infty(a);
@@ -1146,6 +1259,67 @@ static int validity2(void) {
 		}
 		TEST_END;
 
+#if FP_PRIME < 1536
+		TEST_BEGIN("validity test rejects points outside the subgroup") {
+			/* Sample a point on the twist without clearing the cofactor. */
+			do {
+				fp2_rand(a->x);
+				fp2_set_dig(a->z, 1);
+				ep2_rhs(t, a);
+			} while (!fp2_srt(a->y, t));
+			a->coord = BASIC;
+			TEST_ASSERT(!g2_is_valid(a), end);
+			g2_rand(b);
+			g2_add(b, b, a);
+			TEST_ASSERT(!g2_is_valid(b), end);
+		}
+		TEST_END;
+
+		TEST_BEGIN("validity test rejects points outside the curve") {
+			g2_rand(a);
+			g2_norm(a, a);
+			fp2_set_dig(t, 1);
+			fp2_add(a->y, a->y, t);
+			TEST_ASSERT(!g2_is_valid(a), end);
+		}
+		TEST_END;
+
+		TEST_ONCE("batch reading and validation are correct") {
+			g2_rand(a);
+			l = g2_size_bin(a, 1);
+			for (int j = 0; j <= RLC_EPX_READ_MULTI; j++) {
+				g2_rand(a);
+				g2_write_bin(bin + j * l, l, a, 1);
+			}
+			/* Replace the second point by one outside the subgroup. */
+			do {
+				fp2_rand(a->x);
+				fp2_set_dig(a->z, 1);
+				ep2_rhs(t, a);
+			} while (!fp2_srt(a->y, t));
+			a->coord = BASIC;
+			g2_write_bin(bin + l, l, a, 1);
+			TEST_ASSERT(g2_read_bin_batch(_a, r, bin, l, RLC_EPX_READ_MULTI + 1)
+					== RLC_EPX_READ_MULTI, end);
+			TEST_ASSERT(!r[1] && g2_is_infty(_a[1]), end);
+			for (int j = 0; j <= RLC_EPX_READ_MULTI; j++) {
+				g2_read_bin(b, bin + j * l, l);
+				TEST_ASSERT(!r[j] || g2_cmp(_a[j], b) == RLC_EQ, end);
+			}
+#if MULTI == PTHREAD || MULTI == OPENMP
+			core_set_thread_initializer(initializer, NULL);
+			TEST_ASSERT(g2_read_bin_batch(_a, r, bin, l, RLC_EPX_READ_MULTI + 1)
+					== RLC_EPX_READ_MULTI, end);
+			core_set_thread_initializer(NULL, NULL);
+			TEST_ASSERT(!r[1] && g2_is_infty(_a[1]), end);
+			for (int j = 0; j <= RLC_EPX_READ_MULTI; j++) {
+				g2_read_bin(b, bin + j * l, l);
+				TEST_ASSERT(!r[j] || g2_cmp(_a[j], b) == RLC_EQ, end);
+			}
+#endif
+		} TEST_END;
+#endif
+
 		TEST_BEGIN("blinding is consistent") {
 			g2_rand(a);
 			g2_blind(a, a);
@@ -1158,6 +1332,13 @@ static int validity2(void) {
 	code = RLC_OK;
   end:
 	g2_free(a);
+	g2_free(b);
+#if FP_PRIME < 1536
+	fp2_free(t);
+	for (int j = 0; j <= RLC_EPX_READ_MULTI; j++) {
+		g2_free(_a[j]);
+	}
+#endif
 	return code;
 }
 
@@ -1502,8 +1683,23 @@ static int validity(void) {
 		TEST_BEGIN("validity check is correct") {
 			gt_rand(a);
 			TEST_ASSERT(gt_is_valid(a) == 1, end);
+			gt_set_unity(a);
+			TEST_ASSERT(gt_is_valid(a) == 1, end);
+			gt_zero(a);
+			TEST_ASSERT(gt_is_valid(a) == 0, end);
+		}
+		TEST_END;
+
+#if FP_PRIME < 1536
+		TEST_BEGIN("validity check rejects elements outside the subgroup") {
+			fp12_rand(a);
+			TEST_ASSERT(gt_is_valid(a) == 0, end);
+			/* Move to the cyclotomic subgroup without the final power. */
+			fp12_conv_cyc(a, a);
+			TEST_ASSERT(gt_is_valid(a) == 0, end);
 		}
 		TEST_END;
+#endif
 	}
 	RLC_CATCH_ANY {
 		RLC_ERROR(end);
@@ -1065,12 +1065,27 @@ static int addition12(void) {
 	return code;
 }
 
+#if MULTI == PTHREAD || MULTI == OPENMP
+
+/**
+ * Initializes the library context of the threads spawned by the library.
+ *
+ * @param[in] ptr			- the unused initializer argument.
+ */
+static void initializer(void *ptr) {
+	(void)ptr;
+	core_init();
+}
+
+#endif
+
 static int pairing12(void) {
-	int j, code = RLC_ERR;
+	int j, l, code = RLC_ERR;
 	bn_t k, n;
-	ep_t p[2];
-	ep2_t q[2], r;
+	ep_t p[2], _p[RLC_PP_MAP_MULTI + 1];
+	ep2_t q[2], r, _q[RLC_PP_MAP_MULTI + 1];
 	fp12_t e1, e2;
+	fp2_t *t[2];
 
 	bn_null(k);
 	bn_null(n);
@@ -1090,6 +1105,21 @@ static int pairing12(void) {
 			ep2_null(q[j]);
 			ep_new(p[j]);
 			ep2_new(q[j]);
+			t[j] = RLC_ALLOCA(fp2_t, RLC_PP_TABLE_K12);
+			if (t[j] == NULL) {
+				RLC_THROW(ERR_NO_MEMORY);
+			}
+			for (l = 0; l < RLC_PP_TABLE_K12; l++) {
+				fp2_null(t[j][l]);
+				fp2_new(t[j][l]);
+			}
+		}
+
+		for (j = 0; j <= RLC_PP_MAP_MULTI; j++) {
+			ep_null(_p[j]);
+			ep2_null(_q[j]);
+			ep_new(_p[j]);
+			ep2_new(_q[j]);
 		}
 
 		ep_curve_get_ord(n);
@@ -1345,6 +1375,54 @@ static int pairing12(void) {
 			pp_map_sim_oatep_k12(e2, p, q, 2);
 			TEST_ASSERT(fp12_cmp(e1, e2) == RLC_EQ, end);
 		} TEST_END;
+
+		TEST_BEGIN("optimal ate pairing with precomputation is correct") {
+			ep_rand(p[0]);
+			ep2_rand(q[0]);
+			pp_map_oatep_k12(e1, p[0], q[0]);
+			pp_map_pre_k12(t[0], q[0]);
+			pp_map_sim_oatep_k12_pre(e2, p, t, 1);
+			TEST_ASSERT(fp12_cmp(e1, e2) == RLC_EQ, end);
+			ep_rand(p[1]);
+			ep2_rand(q[1]);
+			pp_map_pre_k12(t[1], q[1]);
+			pp_map_sim_oatep_k12(e1, p, q, 2);
+			pp_map_sim_oatep_k12_pre(e2, p, t, 2);
+			TEST_ASSERT(fp12_cmp(e1, e2) == RLC_EQ, end);
+			ep_set_infty(p[0]);
+			pp_map_oatep_k12(e1, p[1], q[1]);
+			pp_map_sim_oatep_k12_pre(e2, p, t, 2);
+			TEST_ASSERT(fp12_cmp(e1, e2) == RLC_EQ, end);
+			ep2_set_infty(q[1]);
+			pp_map_pre_k12(t[1], q[1]);
+			pp_map_sim_oatep_k12_pre(e2, p, t, 2);
+			TEST_ASSERT(fp12_cmp_dig(e2, 1) == RLC_EQ, end);
+		} TEST_END;
+
+		TEST_ONCE("optimal ate multi-pairing of many points is correct") {
+			fp12_set_dig(e1, 1);
+			for (j = 0; j <= RLC_PP_MAP_MULTI; j++) {
+				ep_rand(_p[j]);
+				ep2_rand(_q[j]);
+				pp_map_oatep_k12(e2, _p[j], _q[j]);
+				fp12_mul(e1, e1, e2);
+			}
+			pp_map_sim_oatep_k12(e2, _p, _q, RLC_PP_MAP_MULTI + 1);
+			TEST_ASSERT(fp12_cmp(e1, e2) == RLC_EQ, end);
+#if MULTI == PTHREAD || MULTI == OPENMP
+			core_set_thread_initializer(initializer, NULL);
+			pp_map_sim_oatep_k12(e2, _p, _q, RLC_PP_MAP_MULTI + 1);
+			TEST_ASSERT(fp12_cmp(e1, e2) == RLC_EQ, end);
+			core_set_threads(RLC_PP_MAP_MULTI + 1);
+			pp_map_sim_oatep_k12(e2, _p, _q, RLC_PP_MAP_MULTI + 1);
+			core_set_threads(CORES);
+			core_set_thread_initializer(NULL, NULL);
+			TEST_ASSERT(fp12_cmp(e1, e2) == RLC_EQ, end);
+			/* Workers attach to the caller context without an initializer. */
+			pp_map_sim_oatep_k12(e2, _p, _q, RLC_PP_MAP_MULTI + 1);
+			TEST_ASSERT(fp12_cmp(e1, e2) == RLC_EQ, end);
+#endif
+		} TEST_END;
 #endif
 	}
 	RLC_CATCH_ANY {
@@ -1362,6 +1440,14 @@ static int pairing12(void) {
 	for (j = 0; j < 2; j++) {
 		ep_free(p[j]);
 		ep2_free(q[j]);
+		for (l = 0; l < RLC_PP_TABLE_K12; l++) {
+			fp2_free(t[j][l]);
+		}
+		RLC_FREE(t[j]);
+	}
+	for (j = 0; j <= RLC_PP_MAP_MULTI; j++) {
+		ep_free(_p[j]);
+		ep2_free(_q[j]);
 	}
 	return code;
 }
@@ -340,6 +340,101 @@ static int test(void) {
 	return code;
 }
 
+#elif RAND == CTRDR
+
+/*
+ * Test vectors for CTR_DRBG with AES-256 and the derivation function, where
+ * each request to the generator produces RLC_RAND_BUF bytes. The first seed
+ * is the entropy input followed by the nonce.
+ */
+
+uint8_t result1[] = {
+	0x7A, 0xD7, 0xF0, 0x61, 0x2B, 0x3E, 0xEF, 0x3E, 0x51, 0xF8,
+	0xB3, 0x51, 0x7D, 0xEC, 0xA5, 0x8D, 0xF1, 0xDB, 0xB9, 0x77,
+	0x83, 0xE8, 0xB2, 0x93, 0x03, 0x34, 0xC5, 0xC7, 0x6C, 0xD7,
+	0x16, 0x12, 0x68, 0xF0, 0x55, 0xE6, 0x4D, 0xC8, 0x11, 0xDA,
+	0x09, 0x3A, 0xF4, 0xD3, 0x6C, 0x94, 0x39, 0x82, 0xE7, 0x35,
+	0x34, 0x53, 0x32, 0x39, 0xDD, 0xCD, 0xE7, 0x2C, 0x40, 0x66,
+	0x2E, 0x15, 0x11, 0x79, 0x4E, 0x85, 0x49, 0x1D, 0x38, 0x69,
+	0xA7, 0x65, 0x88, 0x95, 0x6F, 0x67, 0x71, 0x18, 0xC9, 0xC0,
+	0x59, 0x86, 0x1A, 0x16, 0x1C, 0x47, 0x7C, 0x23, 0xE5, 0x4F,
+	0x72, 0x6B, 0xC9, 0xB7, 0x7F, 0xCE, 0x32, 0x4D, 0x8B, 0xB6,
+	0xFB, 0xA4, 0x1E, 0xCA, 0x9E, 0x48, 0xD9, 0xC3, 0x5C, 0xF5,
+	0x23, 0x67, 0x0D, 0x39, 0xED, 0x0D, 0x84, 0xC1, 0x25, 0x2F,
+	0x5E, 0xF6, 0xF6, 0x2F, 0x74, 0xA3, 0xE5, 0x13
+};
+
+uint8_t result2[] = {
+	0x02, 0xBD, 0x96, 0x87, 0x72, 0x7B, 0x5F, 0xE9, 0xBA, 0x74,
+	0x07, 0x6B, 0x3B, 0xD4, 0xB1, 0xB9, 0x78, 0x7B, 0xB9, 0xF5,
+	0x47, 0x0C, 0x56, 0x1B, 0x55, 0xCF, 0xC7, 0x0A, 0xE2, 0xD1,
+	0x19, 0x26, 0x53, 0xD9, 0x4F, 0xAE, 0xCB, 0xDA, 0xE0, 0xAA,
+	0x57, 0x76, 0xC4, 0x9A, 0xAD, 0x9A, 0xA1, 0x96, 0xD9, 0x80,
+	0xC5, 0x8D, 0x4C, 0x47, 0x3C, 0x48, 0xE6, 0x87, 0x1A, 0x92,
+	0x73, 0x41, 0xB8, 0x3D
+};
+
+static int test(void) {
+	int len = sizeof(result2), code = RLC_ERR;
+	uint8_t seed1[48], seed2[32], out[RLC_RAND_BUF];
+
+	for (int j = 0; j < sizeof(seed1); j++) {
+		seed1[j] = j;
+	}
+	for (int j = 0; j < sizeof(seed2); j++) {
+		seed2[j] = 0x80 + j;
+	}
+
+	TEST_ONCE("ctr-drbg (aes-256) random generator is correct") {
+		rand_clean();
+		rand_seed(seed1, sizeof(seed1));
+		rand_bytes(out, len);
+		TEST_ASSERT(memcmp(out, result1, len) == 0, end);
+		/* Consume the rest of the buffer to force a new request. */
+		rand_bytes(out, RLC_RAND_BUF - len);
+		rand_bytes(out, len);
+		TEST_ASSERT(memcmp(out, result1 + len, len) == 0, end);
+	}
+	TEST_END;
+
+	TEST_ONCE("ctr-drbg (aes-256) reseeding is correct") {
+		rand_clean();
+		rand_seed(seed1, sizeof(seed1));
+		rand_bytes(out, RLC_RAND_BUF);
+		TEST_ASSERT(memcmp(out, result1, len) == 0, end);
+		rand_seed(seed2, sizeof(seed2));
+		rand_bytes(out, len);
+		TEST_ASSERT(memcmp(out, result2, len) == 0, end);
+	}
+	TEST_END;
+
+	TEST_BEGIN("ctr-drbg (aes-256) buffered output is consistent") {
+		uint8_t buf[2 * RLC_RAND_BUF];
+		int k = 0;
+		rand_bytes(seed1, sizeof(seed1));
+		rand_clean();
+		rand_seed(seed1, sizeof(seed1));
+		rand_bytes(out, RLC_RAND_BUF);
+		memcpy(buf, out, RLC_RAND_BUF);
+		rand_bytes(out, RLC_RAND_BUF);
+		memcpy(buf + RLC_RAND_BUF, out, RLC_RAND_BUF);
+		rand_clean();
+		rand_seed(seed1, sizeof(seed1));
+		/* Small requests must read the same stream in order. */
+		for (int j = 1; k + j <= sizeof(buf); j += 7) {
+			rand_bytes(out, j);
+			TEST_ASSERT(memcmp(out, buf + k, j) == 0, end);
+			k += j;
+		}
+	}
+	TEST_END;
+
+	code = RLC_OK;
+
+  end:
+	return code;
+}
+
 #elif RAND == UDEV
 
 static int test(void) {